@@ -104,17 +104,27 @@ int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const
   if (!data->kernMatrix) {
     return 0;
   }
-  const uint8_t lc = lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
+  const uint8_t lc = data->kernLeftDirect && leftCp < EPD_DIRECT_LOOKUP_LIMIT
+                         ? data->kernLeftDirect[leftCp]
+                         : lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
   if (lc == 0) return 0;
-  const uint8_t rc = lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
+  const uint8_t rc = data->kernRightDirect && rightCp < EPD_DIRECT_LOOKUP_LIMIT
+                         ? data->kernRightDirect[rightCp]
+                         : lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
   if (rc == 0) return 0;
   return data->kernMatrix[(lc - 1) * data->kernRightClassCount + (rc - 1)];
 }
 
+// False only if leftCp is known not to start any ligature pair
+static bool mayStartLigature(const EpdFontData* data, const uint32_t leftCp) {
+  return !data->ligatureStartBits || leftCp >= EPD_DIRECT_LOOKUP_LIMIT ||
+         (data->ligatureStartBits[leftCp / 32] >> (leftCp % 32)) & 1;
+}
+
 uint32_t EpdFont::getLigature(const uint32_t leftCp, const uint32_t rightCp) const {
   const auto* pairs = data->ligaturePairs;
   const auto count = data->ligaturePairCount;
-  if (!pairs || count == 0 || leftCp > 0xFFFF || rightCp > 0xFFFF) {
+  if (!pairs || count == 0 || leftCp > 0xFFFF || rightCp > 0xFFFF || !mayStartLigature(data, leftCp)) {
     return 0;
   }
 
@@ -137,7 +147,7 @@ uint32_t EpdFont::applyLigatures(uint32_t cp, const char*& text) const {
   if (!data->ligaturePairs || data->ligaturePairCount == 0) {
     return cp;
   }
-  while (true) {
+  while (mayStartLigature(data, cp)) {
     const auto saved = reinterpret_cast<const uint8_t*>(text);
     const uint32_t nextCp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text));
     if (nextCp == 0) break;
@@ -107,6 +107,10 @@ typedef struct {
   uint32_t ligatureCp;  ///< Codepoint of the replacement ligature glyph
 } __attribute__((packed)) EpdLigaturePair;
 
+/// Codepoints below this (Latin, Greek, Cyrillic) can be looked up in the
+/// direct-indexed kern class arrays and ligature-start bitset of EpdFontData.
+constexpr uint32_t EPD_DIRECT_LOOKUP_LIMIT = 0x500;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -130,11 +134,18 @@ typedef struct {
   const EpdLigaturePair* ligaturePairs;  ///< Sorted ligature pair table (nullptr if none)
   uint32_t ligaturePairCount;            ///< Number of entries in ligaturePairs
 
+  /// Optional direct-indexed copies of the tables above for codepoints below
+  /// EPD_DIRECT_LOOKUP_LIMIT, so the common case skips the binary searches.
+  /// nullptr falls back to the sorted tables.
+  const uint8_t* kernLeftDirect;      ///< Left class ID per codepoint (0 = no kerning)
+  const uint8_t* kernRightDirect;     ///< Right class ID per codepoint (0 = no kerning)
+  const uint32_t* ligatureStartBits;  ///< Bit per codepoint, set if it is the left side of a ligature pair
+
   /// On-demand glyph loading for fonts that don't keep all glyphs in RAM (e.g. SD card fonts).
   /// Called by getGlyph() when a codepoint is not found in the interval table.
   /// Returns a valid EpdGlyph* with correct metadata, or nullptr to fall back to the
-  /// replacement glyph.  The returned pointer is valid until the next glyphMissHandler
-  /// call that causes a ring-buffer eviction — callers must consume it (measure or draw)
+  /// replacement glyph.  The returned pointer is valid until a later glyphMissHandler call
+  /// evicts it from the font's glyph store — callers must consume it (measure or draw)
   /// before requesting another missed glyph.
   const EpdGlyph* (*glyphMissHandler)(void* ctx, uint32_t codepoint);
 
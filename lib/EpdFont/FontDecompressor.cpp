@@ -4,7 +4,9 @@
 #include <Logging.h>
 #include <Utf8.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 
 FontDecompressor::~FontDecompressor() { deinit(); }
 
@@ -16,6 +18,7 @@ bool FontDecompressor::init() {
 void FontDecompressor::deinit() {
   freePageBuffer();
   freeHotGroup();
+  trimGlyphCache();
 }
 
 void FontDecompressor::clearCache() {
@@ -41,6 +44,68 @@ void FontDecompressor::freeHotGroup() {
   hotGlyphBuf.shrink_to_fit();
 }
 
+// --- Glyph cache ---
+
+template <typename Entries>
+static auto glyphCacheLowerBound(Entries& entries, const EpdFontData* fontData, const uint32_t glyphIndex) {
+  return std::lower_bound(entries.begin(), entries.end(), std::make_pair(fontData, glyphIndex),
+                          [](const auto& entry, const auto& key) {
+                            if (entry.fontData != key.first) {
+                              return std::less<const EpdFontData*>()(entry.fontData, key.first);
+                            }
+                            return entry.glyphIndex < key.second;
+                          });
+}
+
+const uint8_t* FontDecompressor::findCachedGlyph(const EpdFontData* fontData, const uint32_t glyphIndex) {
+  const auto it = glyphCacheLowerBound(glyphCache, fontData, glyphIndex);
+  if (it == glyphCache.end() || it->fontData != fontData || it->glyphIndex != glyphIndex) {
+    return nullptr;
+  }
+  it->lastUsed = ++glyphCacheClock;
+  return it->bitmap;
+}
+
+void FontDecompressor::cacheGlyph(const EpdFontData* fontData, const uint32_t glyphIndex, const uint8_t* bitmap) {
+  const uint32_t size = fontData->glyph[glyphIndex].dataLength;
+  if (size == 0 || size > GLYPH_CACHE_BUDGET) return;
+  const auto it = glyphCacheLowerBound(glyphCache, fontData, glyphIndex);
+  if (it != glyphCache.end() && it->fontData == fontData && it->glyphIndex == glyphIndex) return;
+
+  auto* copy = static_cast<uint8_t*>(malloc(size));
+  if (!copy) {
+    // Short on heap: make room for whatever needed it more
+    trimGlyphCache(glyphCacheBytes / 2);
+    return;
+  }
+  memcpy(copy, bitmap, size);
+  glyphCache.insert(it, {fontData, glyphIndex, copy, ++glyphCacheClock});
+  glyphCacheBytes += size;
+  if (glyphCacheBytes > GLYPH_CACHE_BUDGET) {
+    trimGlyphCache(GLYPH_CACHE_BUDGET);
+  }
+  stats.glyphCacheBytes = glyphCacheBytes;
+}
+
+void FontDecompressor::trimGlyphCache(const uint32_t maxBytes) {
+  if (maxBytes == 0) {
+    for (auto& entry : glyphCache) {
+      free(entry.bitmap);
+    }
+    glyphCache.clear();
+    glyphCache.shrink_to_fit();
+    glyphCacheBytes = 0;
+  }
+  while (glyphCacheBytes > maxBytes) {
+    const auto oldest = std::min_element(glyphCache.begin(), glyphCache.end(),
+                                         [](const auto& a, const auto& b) { return a.lastUsed < b.lastUsed; });
+    glyphCacheBytes -= oldest->fontData->glyph[oldest->glyphIndex].dataLength;
+    free(oldest->bitmap);
+    glyphCache.erase(oldest);
+  }
+  stats.glyphCacheBytes = glyphCacheBytes;
+}
+
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex) {
   // O(1) path for frequency-grouped fonts with glyphToGroup mapping
   if (fontData->glyphToGroup != nullptr) {
@@ -62,6 +127,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   const EpdFontGroup& group = fontData->groups[groupIndex];
 
   const uint32_t tDecomp = millis();
+  stats.groupsDecompressed++;
   inflateReader.init(false);
   inflateReader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
   if (!inflateReader.read(outBuf, outSize)) {
@@ -161,6 +227,16 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
     break;  // Found the right slot but glyph wasn't in it; don't check other slots
   }
 
+  // Glyphs the page buffer doesn't have (past the prewarm caps, or drawn without a prewarm) may be in the glyph cache
+  if (glyph->dataLength > 0) {
+    if (const uint8_t* cached = findCachedGlyph(fontData, glyphIndex)) {
+      stats.glyphCacheHits++;
+      stats.getBitmapTimeUs += micros() - tStart;
+      return cached;
+    }
+    stats.glyphCacheMisses++;
+  }
+
   // Fallback: hot group slot
   uint16_t groupIndex = getGroupIndex(fontData, glyphIndex);
   if (groupIndex >= fontData->groupCount) {
@@ -210,6 +286,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
 
   uint32_t alignedOff = getAlignedOffset(fontData, groupIndex, glyphIndex);
   compactSingleGlyph(&hotGroup[alignedOff], hotGlyphBuf.data(), glyph->width, glyph->height);
+  cacheGlyph(fontData, glyphIndex, hotGlyphBuf.data());
   stats.getBitmapTimeUs += micros() - tStart;
   return hotGlyphBuf.data();
 }
@@ -245,13 +322,6 @@ int32_t FontDecompressor::findGlyphIndex(const EpdFontData* fontData, uint32_t c
 int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8Text) {
   if (!fontData || !fontData->groups || !utf8Text) return 0;
 
-  // Allocate the next available slot (caller must call freePageBuffer/clearCache to reset)
-  if (pageSlotCount >= MAX_PAGE_SLOTS) {
-    LOG_ERR("FDC", "All %u page buffer slots full, cannot prewarm fontData=%p", MAX_PAGE_SLOTS, (void*)fontData);
-    return -1;
-  }
-  PageSlot& slot = pageSlots[pageSlotCount];
-
   // Step 1: Collect unique glyph indices needed for this page
   uint32_t neededGlyphs[MAX_PAGE_GLYPHS];
   uint16_t glyphCount = 0;
@@ -321,44 +391,42 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     }
   }
 
-  if (glyphCount == 0) return 0;
+  return prewarmGlyphs(fontData, neededGlyphs, glyphCount);
+}
 
-  // Step 2: Compute total buffer size and collect unique groups
-  uint32_t totalBytes = 0;
-  uint16_t neededGroups[128];
-  uint8_t groupCount = 0;
-  bool groupCapWarned = false;
+int FontDecompressor::prewarmGlyphs(const EpdFontData* fontData, const uint32_t* neededGlyphs,
+                                    const uint16_t glyphCount) {
+  if (!fontData || !fontData->groups || glyphCount == 0) return 0;
 
+  // Allocate the next available slot (caller must call freePageBuffer/clearCache to reset)
+  if (pageSlotCount >= MAX_PAGE_SLOTS) {
+    LOG_ERR("FDC", "All %u page buffer slots full, cannot prewarm fontData=%p", MAX_PAGE_SLOTS, (void*)fontData);
+    return -1;
+  }
+  PageSlot& slot = pageSlots[pageSlotCount];
+
+  // Step 2: Compute total buffer size
+  uint32_t totalBytes = 0;
   for (uint16_t i = 0; i < glyphCount; i++) {
     totalBytes += fontData->glyph[neededGlyphs[i]].dataLength;
-    uint16_t gi = getGroupIndex(fontData, neededGlyphs[i]);
-    bool found = false;
-    for (uint8_t j = 0; j < groupCount; j++) {
-      if (neededGroups[j] == gi) {
-        found = true;
-        break;
-      }
+  }
+
+  // Step 3: Allocate page buffer and lookup table for this slot, giving up the glyph cache if the heap is short
+  for (int attempt = 0; attempt < 2 && !slot.buffer; attempt++) {
+    if (attempt > 0) {
+      if (glyphCache.empty()) break;
+      trimGlyphCache();
     }
-    if (!found) {
-      if (groupCount < 128) {
-        neededGroups[groupCount++] = gi;
-      } else if (!groupCapWarned) {
-        LOG_DBG("FDC", "Group cap (128) reached during prewarm; some groups will use hot-group fallback");
-        groupCapWarned = true;
-      }
+    slot.buffer = static_cast<uint8_t*>(malloc(totalBytes));
+    slot.glyphs = static_cast<PageGlyphEntry*>(malloc(glyphCount * sizeof(PageGlyphEntry)));
+    if (!slot.buffer || !slot.glyphs) {
+      free(slot.buffer);
+      free(slot.glyphs);
+      slot = {};
     }
   }
-
-  stats.uniqueGroupsAccessed = groupCount;
-
-  // Step 3: Allocate page buffer and lookup table for this slot
-  slot.buffer = static_cast<uint8_t*>(malloc(totalBytes));
-  slot.glyphs = static_cast<PageGlyphEntry*>(malloc(glyphCount * sizeof(PageGlyphEntry)));
-  if (!slot.buffer || !slot.glyphs) {
+  if (!slot.buffer) {
     LOG_ERR("FDC", "Failed to allocate page buffer (%u bytes, %u glyphs)", totalBytes, glyphCount);
-    free(slot.buffer);
-    free(slot.glyphs);
-    slot = {};
     return glyphCount;
   }
   stats.pageBufferBytes += totalBytes;
@@ -384,11 +452,52 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     slot.glyphs[j + 1] = key;
   }
 
+  // Step 3a: Copy the glyphs the glyph cache holds (and place empty ones), and collect the groups of the rest
+  uint32_t writeOffset = 0;
+  uint16_t neededGroups[128];
+  uint8_t groupCount = 0;
+  bool groupCapWarned = false;
+
+  for (uint16_t i = 0; i < slot.glyphCount; i++) {
+    const uint32_t glyphIndex = slot.glyphs[i].glyphIndex;
+    const uint32_t dataLength = fontData->glyph[glyphIndex].dataLength;
+    const uint8_t* cached = dataLength > 0 ? findCachedGlyph(fontData, glyphIndex) : nullptr;
+    if (dataLength == 0 || cached) {
+      if (cached) {
+        memcpy(&slot.buffer[writeOffset], cached, dataLength);
+        stats.glyphCacheHits++;
+      }
+      slot.glyphs[i].bufferOffset = writeOffset;
+      writeOffset += dataLength;
+      continue;
+    }
+    stats.glyphCacheMisses++;
+
+    uint16_t gi = getGroupIndex(fontData, glyphIndex);
+    bool found = false;
+    for (uint8_t j = 0; j < groupCount; j++) {
+      if (neededGroups[j] == gi) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      if (groupCount < 128) {
+        neededGroups[groupCount++] = gi;
+      } else if (!groupCapWarned) {
+        LOG_DBG("FDC", "Group cap (128) reached during prewarm; some groups will use hot-group fallback");
+        groupCapWarned = true;
+      }
+    }
+  }
+
+  stats.uniqueGroupsAccessed = groupCount;
+
   // Step 3b: Pre-scan to compute each needed glyph's byte-aligned offset within its group.
   // This avoids recomputing aligned offsets per group during extraction in step 4.
   uint32_t groupAlignedTracker[128] = {};  // running byte-aligned offset for each needed group
 
-  if (fontData->glyphToGroup) {
+  if (fontData->glyphToGroup && groupCount > 0) {
     // Frequency-grouped: single O(totalGlyphs) pass through glyphToGroup
     const auto& lastInterval = fontData->intervals[fontData->intervalCount - 1];
     const uint32_t totalGlyphs = lastInterval.offset + (lastInterval.last - lastInterval.first + 1);
@@ -454,8 +563,8 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     }
   }
 
-  // Step 4: For each unique group, decompress to temp buffer and extract needed glyphs
-  uint32_t writeOffset = 0;
+  // Step 4: For each unique group, decompress to temp buffer and extract needed glyphs into the page buffer and the
+  // glyph cache
   int missed = 0;
 
   for (uint8_t g = 0; g < groupCount; g++) {
@@ -463,6 +572,10 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
     const EpdFontGroup& group = fontData->groups[groupIdx];
 
     auto* tempBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+    if (!tempBuf && !glyphCache.empty()) {
+      trimGlyphCache();
+      tempBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+    }
     if (!tempBuf) {
       LOG_ERR("FDC", "Failed to allocate temp buffer (%u bytes) for group %u", group.uncompressedSize, groupIdx);
       missed++;
@@ -486,6 +599,7 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
 
       const EpdGlyph& glyph = fontData->glyph[slot.glyphs[i].glyphIndex];
       compactSingleGlyph(&tempBuf[slot.glyphs[i].alignedOffset], &slot.buffer[writeOffset], glyph.width, glyph.height);
+      cacheGlyph(fontData, slot.glyphs[i].glyphIndex, &slot.buffer[writeOffset]);
       slot.glyphs[i].bufferOffset = writeOffset;
       writeOffset += glyph.dataLength;
     }
@@ -501,13 +615,19 @@ int FontDecompressor::prewarmCache(const EpdFontData* fontData, const char* utf8
 
 // --- Stats ---
 
-void FontDecompressor::resetStats() { stats = Stats{}; }
+void FontDecompressor::resetStats() {
+  stats = Stats{};
+  stats.glyphCacheBytes = glyphCacheBytes;
+}
 
 void FontDecompressor::logStats(const char* label) {
   const uint32_t total = stats.cacheHits + stats.cacheMisses;
   LOG_DBG("FDC", "[%s] hits=%lu misses=%lu (%.1f%% hit rate)", label, stats.cacheHits, stats.cacheMisses,
           total > 0 ? 100.0f * stats.cacheHits / total : 0.0f);
-  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u", label, stats.decompressTimeMs, stats.uniqueGroupsAccessed);
+  LOG_DBG("FDC", "[%s] decompress=%lums groups_accessed=%u groups_inflated=%lu", label, stats.decompressTimeMs,
+          stats.uniqueGroupsAccessed, stats.groupsDecompressed);
+  LOG_DBG("FDC", "[%s] glyph cache: hits=%lu misses=%lu bytes=%lu", label, stats.glyphCacheHits,
+          stats.glyphCacheMisses, stats.glyphCacheBytes);
   LOG_DBG("FDC", "[%s] mem: pageBuf=%lu pageGlyphs=%lu hotGroup=%lu peakTemp=%lu", label, stats.pageBufferBytes,
           stats.pageGlyphsBytes, stats.hotGroupBytes, stats.peakTempBytes);
   if (stats.getBitmapCalls > 0) {
@@ -10,6 +10,9 @@ class FontDecompressor {
  public:
   static constexpr uint16_t MAX_PAGE_GLYPHS = 512;
   static constexpr uint8_t MAX_PAGE_SLOTS = 4;  // One per font style (R/B/I/BI)
+  // Glyph cache: decompressed glyphs kept across pages, least recently used dropped first past this many bytes of
+  // bitmaps. Consecutive pages share nearly all their glyphs, so a page turn rarely needs to inflate a group.
+  static constexpr uint32_t GLYPH_CACHE_BUDGET = 16 * 1024;
 
   FontDecompressor() = default;
   ~FontDecompressor();
@@ -21,13 +24,19 @@ class FontDecompressor {
   // Checks the page buffer (from prewarm) first, then falls back to the hot group slot.
   const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint32_t glyphIndex);
 
-  // Free all cached data (page buffer + hot group).
+  // Free the page buffer and hot group. The glyph cache is kept for the next page.
   void clearCache();
+  // Drop least recently used glyphs from the glyph cache until its bitmaps take at most maxBytes; 0 empties it.
+  // Called when an allocation fails, and by anything about to need a lot of heap.
+  void trimGlyphCache(uint32_t maxBytes = 0);
 
   // Pre-scan UTF-8 text and extract needed glyph bitmaps into a flat page buffer.
-  // Each group is decompressed once into a temp buffer; only needed glyphs are kept.
+  // Glyphs in the glyph cache are copied from there; each group holding the rest is decompressed once into a temp
+  // buffer and only needed glyphs are kept (and added to the glyph cache).
   // Returns the number of glyphs that couldn't be loaded (0 on full success).
   int prewarmCache(const EpdFontData* fontData, const char* utf8Text);
+  // Same for glyphs already resolved to indexes (no duplicates, at most MAX_PAGE_GLYPHS), e.g. from a display list.
+  int prewarmGlyphs(const EpdFontData* fontData, const uint32_t* glyphIndexes, uint16_t glyphCount);
 
   struct Stats {
     uint32_t cacheHits = 0;
@@ -40,6 +49,10 @@ class FontDecompressor {
     uint32_t peakTempBytes = 0;    // largest temp buffer in prewarm
     uint32_t getBitmapTimeUs = 0;  // cumulative getBitmap time (micros)
     uint32_t getBitmapCalls = 0;   // number of getBitmap calls
+    uint32_t glyphCacheHits = 0;   // glyphs found in the glyph cache (prewarm and fallback path)
+    uint32_t glyphCacheMisses = 0;
+    uint32_t groupsDecompressed = 0;  // groups inflated, by prewarm and the hot group
+    uint32_t glyphCacheBytes = 0;     // glyph cache bitmaps, as of the last change
   };
   void logStats(const char* label = "FDC");
   void resetStats();
@@ -75,8 +88,21 @@ class FontDecompressor {
   // Valid until the next getBitmap() call.
   std::vector<uint8_t> hotGlyphBuf;
 
+  // Glyph cache entries sorted by (fontData, glyphIndex) for binary search. lastUsed orders them for eviction.
+  struct CachedGlyph {
+    const EpdFontData* fontData;
+    uint32_t glyphIndex;
+    uint8_t* bitmap;
+    uint32_t lastUsed;
+  };
+  std::vector<CachedGlyph> glyphCache;
+  uint32_t glyphCacheBytes = 0;
+  uint32_t glyphCacheClock = 0;
+
   void freePageBuffer();
   void freeHotGroup();
+  const uint8_t* findCachedGlyph(const EpdFontData* fontData, uint32_t glyphIndex);
+  void cacheGlyph(const EpdFontData* fontData, uint32_t glyphIndex, const uint8_t* bitmap);
   uint16_t getGroupIndex(const EpdFontData* fontData, uint32_t glyphIndex);
   uint32_t getAlignedOffset(const EpdFontData* fontData, uint16_t groupIndex, uint32_t glyphIndex);
   bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, uint8_t* outBuf, uint32_t outSize);
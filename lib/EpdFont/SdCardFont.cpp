@@ -2,6 +2,7 @@
 
 #include <HalStorage.h>
 #include <Logging.h>
+#include <Trace.h>
 #include <Utf8.h>
 
 #include <algorithm>
@@ -34,6 +35,8 @@ static constexpr char CPFONT_MAGIC[8] = {'C', 'P', 'F', 'O', 'N', 'T', '\0', '\0
 // stringified into FONT_MANIFEST_URL.
 static constexpr uint32_t HEADER_SIZE = 32;
 static constexpr uint32_t STYLE_TOC_ENTRY_SIZE = 32;
+// v5 hot block index entry: codepoint(4) + bitmap length(2) + reserved(2)
+static constexpr uint32_t HOT_INDEX_ENTRY_SIZE = 8;
 
 // Helper to read little-endian values from byte buffer
 static inline uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
@@ -42,6 +45,64 @@ static inline uint32_t readU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (
 
 SdCardFont::~SdCardFont() { freeAll(); }
 
+// --- Coalesced SD reads ---
+
+// Neighbouring ranges closer than READ_MERGE_GAP bytes are fetched with one
+// read through a READ_SCRATCH_SIZE buffer: reading the gap costs far less than
+// another seek + read call on the SD card. The buffer is sized so the part of
+// a v5 hot block a typical page touches takes one or two reads.
+static constexpr uint32_t READ_SCRATCH_SIZE = 4096;
+static constexpr uint32_t READ_MERGE_GAP = 128;
+
+struct ReadSpan {
+  uint32_t fileOffset;
+  uint32_t length;
+  uint8_t* dest;
+};
+
+// Read every span (sorted by fileOffset, non-empty) into its destination.
+// Spans ending before denseEnd (the hot block) are merged whatever the gap,
+// since a page uses most of that region anyway. Returns false on a failed
+// seek or short read.
+static bool readCoalesced(FsFile& file, const ReadSpan* spans, uint32_t count, uint8_t* scratch, uint32_t denseEnd,
+                          uint32_t& seeks, uint32_t& reads) {
+  // UINT32_MAX: file position unknown, so the first read always seeks
+  uint32_t position = UINT32_MAX;
+  uint32_t i = 0;
+  while (i < count) {
+    const uint32_t start = spans[i].fileOffset;
+    uint32_t end = start + spans[i].length;
+    uint32_t next = i + 1;
+    if (spans[i].length <= READ_SCRATCH_SIZE) {
+      while (next < count) {
+        const uint32_t nextEnd = spans[next].fileOffset + spans[next].length;
+        const bool close = spans[next].fileOffset <= end + READ_MERGE_GAP || nextEnd <= denseEnd;
+        if (!close || nextEnd - start > READ_SCRATCH_SIZE) break;
+        end = std::max(end, nextEnd);
+        next++;
+      }
+    }
+
+    if (start != position) {
+      if (!file.seekSet(start)) return false;
+      seeks++;
+    }
+    reads++;
+    if (next == i + 1 && spans[i].length > READ_SCRATCH_SIZE) {
+      // Too big for the scratch buffer: read straight into place
+      if (file.read(spans[i].dest, spans[i].length) != static_cast<int>(spans[i].length)) return false;
+    } else {
+      if (file.read(scratch, end - start) != static_cast<int>(end - start)) return false;
+      for (uint32_t j = i; j < next; j++) {
+        memcpy(spans[j].dest, scratch + (spans[j].fileOffset - start), spans[j].length);
+      }
+    }
+    position = end;
+    i = next;
+  }
+  return true;
+}
+
 // --- Per-style free/cleanup ---
 
 void SdCardFont::freeStyleMiniData(PerStyle& s) {
@@ -65,6 +126,8 @@ void SdCardFont::freeStyleKernLigatureData(PerStyle& s) {
   s.kernRightClasses = nullptr;
   delete[] s.ligaturePairs;
   s.ligaturePairs = nullptr;
+  delete[] s.ligatureStartBits;
+  s.ligatureStartBits = nullptr;
   s.kernLigLoaded = false;
 }
 
@@ -85,6 +148,10 @@ void SdCardFont::freeStyleAll(PerStyle& s) {
   freeStyleMiniData(s);
   delete[] s.fullIntervals;
   s.fullIntervals = nullptr;
+  delete[] s.hotGlyphs;
+  s.hotGlyphs = nullptr;
+  s.hotBlockSize = 0;
+  s.hotIndexLoaded = false;
   freeStyleKernLigatureData(s);
   s.present = false;
 }
@@ -92,7 +159,6 @@ void SdCardFont::freeStyleAll(PerStyle& s) {
 // --- Global free/cleanup ---
 
 void SdCardFont::freeAll() {
-  clearOverflow();
   clearPersistentCache();
   for (uint8_t i = 0; i < MAX_STYLES; i++) {
     freeStyleAll(styles_[i]);
@@ -102,16 +168,6 @@ void SdCardFont::freeAll() {
   loaded_ = false;
 }
 
-void SdCardFont::clearOverflow() {
-  for (uint32_t i = 0; i < overflowCount_; i++) {
-    delete[] overflow_[i].bitmap;
-    overflow_[i].bitmap = nullptr;
-    overflow_[i].codepoint = 0;
-  }
-  overflowCount_ = 0;
-  overflowNext_ = 0;
-}
-
 // --- Per-style kern/ligature ---
 
 void SdCardFont::applyKernLigaturePointers(PerStyle& s, EpdFontData& data) const {
@@ -127,6 +183,7 @@ void SdCardFont::applyKernLigaturePointers(PerStyle& s, EpdFontData& data) const
   // Ligatures are small (typically < 1KB) so they stay resident.
   data.ligaturePairs = s.ligaturePairs;
   data.ligaturePairCount = s.header.ligaturePairCount;
+  data.ligatureStartBits = s.ligatureStartBits;
 }
 
 bool SdCardFont::loadStyleKernLigatureData(PerStyle& s) {
@@ -175,7 +232,8 @@ bool SdCardFont::loadStyleKernLigatureData(PerStyle& s) {
 
   if (hasLig) {
     s.ligaturePairs = new (std::nothrow) EpdLigaturePair[s.header.ligaturePairCount];
-    if (!s.ligaturePairs) {
+    s.ligatureStartBits = new (std::nothrow) uint32_t[EPD_DIRECT_LOOKUP_LIMIT / 32]();
+    if (!s.ligaturePairs || !s.ligatureStartBits) {
       LOG_ERR("SDCF", "Failed to allocate ligature pairs");
       freeStyleKernLigatureData(s);
       return false;
@@ -191,6 +249,11 @@ bool SdCardFont::loadStyleKernLigatureData(PerStyle& s) {
       freeStyleKernLigatureData(s);
       return false;
     }
+    // Lets EpdFont skip the pair search for characters that never start a ligature
+    for (uint32_t i = 0; i < s.header.ligaturePairCount; i++) {
+      const uint32_t leftCp = s.ligaturePairs[i].pair >> 16;
+      if (leftCp < EPD_DIRECT_LOOKUP_LIMIT) s.ligatureStartBits[leftCp / 32] |= 1u << (leftCp % 32);
+    }
   }
 
   s.kernLigLoaded = true;
@@ -200,12 +263,78 @@ bool SdCardFont::loadStyleKernLigatureData(PerStyle& s) {
   // applyKernLigaturePointers() after buildMiniKernMatrix() runs.
   s.stubData.ligaturePairs = s.ligaturePairs;
   s.stubData.ligaturePairCount = s.header.ligaturePairCount;
+  s.stubData.ligatureStartBits = s.ligatureStartBits;
 
   LOG_DBG("SDCF", "Kern classes + lig loaded: kernL=%u, kernR=%u, ligs=%u", s.header.kernLeftEntryCount,
           s.header.kernRightEntryCount, s.header.ligaturePairCount);
   return true;
 }
 
+// --- Per-style hot block index (v5) ---
+
+bool SdCardFont::loadStyleHotIndex(PerStyle& s) {
+  if (s.hotIndexLoaded) return s.hotGlyphs != nullptr;
+  s.hotIndexLoaded = true;  // a file without (or with a broken) hot block prewarms the v4 way
+  const uint16_t count = s.header.hotGlyphCount;
+  if (count == 0) return false;
+
+  const size_t rawSize = count * HOT_INDEX_ENTRY_SIZE;
+  std::unique_ptr<uint8_t[]> raw(new (std::nothrow) uint8_t[rawSize]);
+  std::unique_ptr<HotGlyph[]> hot(new (std::nothrow) HotGlyph[count]);
+  if (!raw || !hot) {
+    LOG_ERR("SDCF", "Failed to allocate hot index (%u glyphs)", count);
+    return false;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("SDCF", filePath_, file)) {
+    LOG_ERR("SDCF", "Failed to open .cpfont for hot index: %s", filePath_);
+    return false;
+  }
+  if (!file.seekSet(s.hotIndexFileOffset) || file.read(raw.get(), rawSize) != static_cast<int>(rawSize)) {
+    LOG_ERR("SDCF", "Failed to read hot index");
+    return false;
+  }
+
+  // The index lists the hot block in file order: each record is directly
+  // followed by its bitmap, so entry offsets accumulate.
+  uint32_t entryOffset = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    const uint8_t* entry = raw.get() + i * HOT_INDEX_ENTRY_SIZE;
+    hot[i].codepoint = readU32(entry);
+    hot[i].dataLength = readU16(entry + 4);
+    hot[i].entryOffset = entryOffset;
+    entryOffset += sizeof(EpdGlyph) + hot[i].dataLength;
+    if (findGlobalGlyphIndex(s, hot[i].codepoint) < 0) {
+      LOG_ERR("SDCF", "Hot glyph U+%04lX is outside the font's intervals",
+              static_cast<unsigned long>(hot[i].codepoint));
+      return false;
+    }
+  }
+  std::sort(hot.get(), hot.get() + count,
+            [](const HotGlyph& a, const HotGlyph& b) { return a.codepoint < b.codepoint; });
+  for (uint16_t i = 1; i < count; i++) {
+    if (hot[i].codepoint == hot[i - 1].codepoint) {
+      LOG_ERR("SDCF", "Duplicate hot glyph U+%04lX", static_cast<unsigned long>(hot[i].codepoint));
+      return false;
+    }
+  }
+
+  s.hotGlyphs = hot.release();
+  s.hotBlockSize = entryOffset;
+  LOG_DBG("SDCF", "Hot index loaded: %u glyphs, %u byte block", count, entryOffset);
+  return true;
+}
+
+const SdCardFont::HotGlyph* SdCardFont::findHotGlyph(const PerStyle& s, uint32_t codepoint) const {
+  if (!s.hotGlyphs) return nullptr;
+  const HotGlyph* begin = s.hotGlyphs;
+  const HotGlyph* end = begin + s.header.hotGlyphCount;
+  const HotGlyph* it =
+      std::lower_bound(begin, end, codepoint, [](const HotGlyph& g, uint32_t cp) { return g.codepoint < cp; });
+  return (it != end && it->codepoint == codepoint) ? it : nullptr;
+}
+
 // --- Per-page mini kern matrix ---
 
 // Local copy of EpdFont.cpp's lookupKernClass (that one is file-static there).
@@ -373,9 +502,12 @@ void SdCardFont::applyGlyphMissCallback(uint8_t styleIdx) {
 
 // --- Compute per-style file offsets from a base data offset ---
 
-void SdCardFont::computeStyleFileOffsets(PerStyle& s, uint32_t baseOffset) {
+void SdCardFont::computeStyleFileOffsets(PerStyle& s, uint32_t baseOffset, uint16_t version) {
   s.intervalsFileOffset = baseOffset;
-  s.glyphsFileOffset = s.intervalsFileOffset + s.header.intervalCount * sizeof(EpdUnicodeInterval);
+  // v5 puts the hot block index between the intervals and the glyph table
+  s.hotIndexFileOffset = s.intervalsFileOffset + s.header.intervalCount * sizeof(EpdUnicodeInterval);
+  const uint32_t hotIndexSize = version >= 5 ? s.header.hotGlyphCount * HOT_INDEX_ENTRY_SIZE : 0;
+  s.glyphsFileOffset = s.hotIndexFileOffset + hotIndexSize;
   s.kernLeftFileOffset = s.glyphsFileOffset + s.header.glyphCount * sizeof(EpdGlyph);
   s.kernRightFileOffset = s.kernLeftFileOffset + s.header.kernLeftEntryCount * sizeof(EpdKernClassEntry);
   s.kernMatrixFileOffset = s.kernRightFileOffset + s.header.kernRightEntryCount * sizeof(EpdKernClassEntry);
@@ -414,8 +546,8 @@ bool SdCardFont::load(const char* path) {
   }
 
   uint16_t fileVersion = readU16(headerBuf + 8);
-  if (fileVersion != CPFONT_VERSION) {
-    LOG_ERR("SDCF", "Unsupported version: %u (expected %u)", fileVersion, CPFONT_VERSION);
+  if (fileVersion < CPFONT_MIN_VERSION || fileVersion > CPFONT_VERSION) {
+    LOG_ERR("SDCF", "Unsupported version: %u (expected %u-%u)", fileVersion, CPFONT_MIN_VERSION, CPFONT_VERSION);
     return false;
   }
 
@@ -462,6 +594,7 @@ bool SdCardFont::load(const char* path) {
     s.header.kernLeftClassCount = tocBuf[21];
     s.header.kernRightClassCount = tocBuf[22];
     s.header.ligaturePairCount = tocBuf[23];
+    s.header.hotGlyphCount = fileVersion >= 5 ? readU16(tocBuf + 28) : 0;
     s.header.is2Bit = is2Bit;
 
     // Sanity-check counts to reject malformed files before allocating.
@@ -470,17 +603,20 @@ bool SdCardFont::load(const char* path) {
     static constexpr uint32_t MAX_INTERVALS = 4096;
     static constexpr uint32_t MAX_GLYPHS = 65536;
     static constexpr uint32_t MAX_KERN_ENTRIES = 4096;
+    static constexpr uint32_t MAX_HOT_GLYPHS = 1024;
     if (s.header.intervalCount > MAX_INTERVALS || s.header.glyphCount > MAX_GLYPHS ||
-        s.header.kernLeftEntryCount > MAX_KERN_ENTRIES || s.header.kernRightEntryCount > MAX_KERN_ENTRIES) {
-      LOG_ERR("SDCF", "Style %u: unreasonable counts (iv=%u, gl=%u, kL=%u, kR=%u)", styleId, s.header.intervalCount,
-              s.header.glyphCount, s.header.kernLeftEntryCount, s.header.kernRightEntryCount);
+        s.header.kernLeftEntryCount > MAX_KERN_ENTRIES || s.header.kernRightEntryCount > MAX_KERN_ENTRIES ||
+        s.header.hotGlyphCount > MAX_HOT_GLYPHS) {
+      LOG_ERR("SDCF", "Style %u: unreasonable counts (iv=%u, gl=%u, kL=%u, kR=%u, hot=%u)", styleId,
+              s.header.intervalCount, s.header.glyphCount, s.header.kernLeftEntryCount, s.header.kernRightEntryCount,
+              s.header.hotGlyphCount);
       file.close();
       freeAll();
       return false;
     }
 
     uint32_t dataOffset = readU32(tocBuf + 24);
-    computeStyleFileOffsets(s, dataOffset);
+    computeStyleFileOffsets(s, dataOffset, fileVersion);
   }
 
   styleCount_ = styleCount;
@@ -555,13 +691,14 @@ bool SdCardFont::load(const char* path) {
 
   loaded_ = true;
 
-  LOG_DBG("SDCF", "Loaded: %s (v%u, %u styles)", path, CPFONT_VERSION, styleCount_);
+  LOG_DBG("SDCF", "Loaded: %s (v%u, %u styles)", path, fileVersion, styleCount_);
   for (uint8_t i = 0; i < MAX_STYLES; i++) {
     if (!styles_[i].present) continue;
     const auto& h = styles_[i].header;
-    LOG_DBG("SDCF", "  style[%u]: %u intervals, %u glyphs, advY=%u, asc=%d, desc=%d, kernL=%u, kernR=%u, ligs=%u", i,
+    LOG_DBG("SDCF",
+            "  style[%u]: %u intervals, %u glyphs, advY=%u, asc=%d, desc=%d, kernL=%u, kernR=%u, ligs=%u, hot=%u", i,
             h.intervalCount, h.glyphCount, h.advanceY, h.ascender, h.descender, h.kernLeftEntryCount,
-            h.kernRightEntryCount, h.ligaturePairCount);
+            h.kernRightEntryCount, h.ligaturePairCount, h.hotGlyphCount);
   }
   return true;
 }
@@ -692,14 +829,17 @@ int SdCardFont::prewarm(const char* utf8Text, uint8_t styleMask, bool metadataOn
 }
 
 int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint32_t cpCount, bool metadataOnly) {
+  TRACE_SPAN("sd_font_prewarm_read");
   auto& s = styles_[styleIdx];
 
   // Map codepoints to global glyph indices for this style
   struct CpGlyphMapping {
     uint32_t codepoint;
     int32_t globalIndex;
+    const GlyphStoreEntry* stored;  // glyph store entry with everything this prewarm needs, else nullptr
+    const HotGlyph* hot;            // record to read from the hot block along with the bitmap, else nullptr
   };
-  CpGlyphMapping* mappings = new (std::nothrow) CpGlyphMapping[cpCount];
+  std::unique_ptr<CpGlyphMapping[]> mappings(new (std::nothrow) CpGlyphMapping[cpCount]);
   if (!mappings) {
     LOG_ERR("SDCF", "Failed to allocate mapping array for style %u", styleIdx);
     return static_cast<int>(cpCount);
@@ -711,6 +851,8 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
     if (idx >= 0) {
       mappings[validCount].codepoint = codepoints[i];
       mappings[validCount].globalIndex = idx;
+      mappings[validCount].stored = nullptr;
+      mappings[validCount].hot = nullptr;
       validCount++;
     }
   }
@@ -718,7 +860,6 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
 
   if (validCount == 0) {
     freeStyleMiniData(s);
-    delete[] mappings;
     s.epdFont.data = &s.stubData;
     return missed;
   }
@@ -730,7 +871,6 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
   s.miniIntervals = new (std::nothrow) EpdUnicodeInterval[intervalCapacity];
   if (!s.miniIntervals) {
     LOG_ERR("SDCF", "Failed to allocate mini intervals for style %u", styleIdx);
-    delete[] mappings;
     return static_cast<int>(cpCount);
   }
 
@@ -746,135 +886,152 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
     }
   }
 
-  // Allocate mini glyph array
+  // Allocate mini glyph array, plus the read list (a record and a bitmap per
+  // glyph at most) and buffer for SD reads
   s.miniGlyphCount = validCount;
   s.miniGlyphs = new (std::nothrow) EpdGlyph[s.miniGlyphCount];
-  if (!s.miniGlyphs) {
+  std::unique_ptr<ReadSpan[]> spans(new (std::nothrow) ReadSpan[validCount * 2]);
+  std::unique_ptr<uint8_t[]> scratch(new (std::nothrow) uint8_t[READ_SCRATCH_SIZE]);
+  if (!s.miniGlyphs || !spans || !scratch) {
     LOG_ERR("SDCF", "Failed to allocate mini glyphs for style %u", styleIdx);
-    delete[] mappings;
     freeStyleMiniData(s);
     return static_cast<int>(cpCount);
   }
 
-  // Build sorted read order for sequential I/O
-  uint32_t* readOrder = new (std::nothrow) uint32_t[validCount];
-  if (!readOrder) {
-    LOG_ERR("SDCF", "Failed to allocate read order for style %u", styleIdx);
-    delete[] mappings;
-    freeStyleMiniData(s);
-    return static_cast<int>(cpCount);
+  // Copy glyphs seen on earlier pages from the glyph store; only the rest are
+  // read from SD. A stored record whose bitmap was never loaded (metadata-only
+  // prewarm) still saves the record read. Records of hot glyphs come from the
+  // hot block, and for a full prewarm are read later together with their
+  // bitmaps.
+  loadStyleHotIndex(s);
+  uint32_t spanCount = 0;
+  for (uint32_t i = 0; i < validCount; i++) {
+    const GlyphStoreEntry* entry = findStoredGlyph(glyphStoreKey(styleIdx, mappings[i].codepoint));
+    const HotGlyph* hot = entry ? nullptr : findHotGlyph(s, mappings[i].codepoint);
+    if (entry) {
+      s.miniGlyphs[i] = entry->glyph;
+      if (metadataOnly || hasGlyphBitmap(*entry)) {
+        mappings[i].stored = entry;
+      }
+    } else if (hot && !metadataOnly) {
+      mappings[i].hot = hot;
+    } else {
+      const uint32_t fileOff =
+          hot ? s.bitmapFileOffset + hot->entryOffset
+              : s.glyphsFileOffset + static_cast<uint32_t>(mappings[i].globalIndex) * sizeof(EpdGlyph);
+      spans[spanCount++] = {fileOff, sizeof(EpdGlyph), reinterpret_cast<uint8_t*>(&s.miniGlyphs[i])};
+    }
+    if (mappings[i].stored) {
+      stats_.storeHits++;
+    } else {
+      stats_.storeMisses++;
+    }
   }
-  for (uint32_t i = 0; i < validCount; i++) readOrder[i] = i;
-  std::sort(readOrder, readOrder + validCount,
-            [&](uint32_t a, uint32_t b) { return mappings[a].globalIndex < mappings[b].globalIndex; });
 
   FsFile file;
-  if (!Storage.openFileForRead("SDCF", filePath_, file)) {
-    LOG_ERR("SDCF", "Failed to reopen .cpfont for prewarm (style %u)", styleIdx);
-    delete[] readOrder;
-    delete[] mappings;
-    freeStyleMiniData(s);
-    return static_cast<int>(cpCount);
-  }
-
   unsigned long sdStart = millis();
   uint32_t seekCount = 0;
-
-  // Read glyph metadata. lastReadIndex tracks sequential reads to skip redundant
-  // seeks; INT32_MIN guarantees the first iteration always seeks to the correct
-  // offset (otherwise when gIdx == 0, the "gIdx != lastReadIndex + 1" check would
-  // be false and we'd read from the file's current position — the header — which
-  // decodes to a garbage EpdGlyph with a massive advanceX, inflating any word
-  // containing that codepoint beyond page width).
-  int32_t lastReadIndex = INT32_MIN;
-  for (uint32_t i = 0; i < validCount; i++) {
-    uint32_t mapIdx = readOrder[i];
-    int32_t gIdx = mappings[mapIdx].globalIndex;
-
-    uint32_t fileOff = s.glyphsFileOffset + static_cast<uint32_t>(gIdx) * sizeof(EpdGlyph);
-    if (gIdx != lastReadIndex + 1) {
-      if (!file.seekSet(fileOff)) {
-        LOG_ERR("SDCF", "Prewarm: failed to seek to glyph %d (style %u)", gIdx, styleIdx);
-        file.close();
-        delete[] readOrder;
-        delete[] mappings;
-        freeStyleMiniData(s);
-        return static_cast<int>(cpCount);
-      }
-      seekCount++;
+  uint32_t readCount = 0;
+  const auto readSpans = [&](const char* what) {
+    if (spanCount == 0) return true;
+    if (!file.isOpen() && !Storage.openFileForRead("SDCF", filePath_, file)) {
+      LOG_ERR("SDCF", "Failed to reopen .cpfont for prewarm (style %u)", styleIdx);
+      return false;
     }
-    if (file.read(reinterpret_cast<uint8_t*>(&s.miniGlyphs[mapIdx]), sizeof(EpdGlyph)) != sizeof(EpdGlyph)) {
-      LOG_ERR("SDCF", "Prewarm: short glyph read (style %u, glyph %d)", styleIdx, gIdx);
-      delete[] readOrder;
-      delete[] mappings;
-      freeStyleMiniData(s);
-      return static_cast<int>(cpCount);
+    std::sort(spans.get(), spans.get() + spanCount,
+              [](const ReadSpan& a, const ReadSpan& b) { return a.fileOffset < b.fileOffset; });
+    const uint32_t hotBlockEnd = s.bitmapFileOffset + s.hotBlockSize;
+    if (!readCoalesced(file, spans.get(), spanCount, scratch.get(), hotBlockEnd, seekCount, readCount)) {
+      LOG_ERR("SDCF", "Prewarm: failed to read %u %s (style %u)", spanCount, what, styleIdx);
+      return false;
     }
-    lastReadIndex = gIdx;
+    return true;
+  };
+
+  // Read missing glyph records, merging neighbouring records into one read
+  if (!readSpans("glyph records")) {
+    freeStyleMiniData(s);
+    return static_cast<int>(cpCount);
   }
 
   uint32_t totalBitmapSize = 0;
 
+  // Bitmap size of each glyph: hot records aren't read yet, but the hot index has it
+  const auto bitmapLength = [&](uint32_t i) -> uint32_t {
+    return mappings[i].hot ? mappings[i].hot->dataLength : s.miniGlyphs[i].dataLength;
+  };
+
   if (!metadataOnly) {
     // Compute total bitmap size
     for (uint32_t i = 0; i < validCount; i++) {
-      totalBitmapSize += s.miniGlyphs[i].dataLength;
+      totalBitmapSize += bitmapLength(i);
     }
 
     s.miniBitmap = new (std::nothrow) uint8_t[totalBitmapSize > 0 ? totalBitmapSize : 1];
     if (!s.miniBitmap) {
       LOG_ERR("SDCF", "Failed to allocate mini bitmap (%u bytes) for style %u", totalBitmapSize, styleIdx);
-      delete[] readOrder;
-      delete[] mappings;
       freeStyleMiniData(s);
       return static_cast<int>(cpCount);
     }
 
-    // Read bitmap data sorted by file offset
-    std::sort(readOrder, readOrder + validCount,
-              [&](uint32_t a, uint32_t b) { return s.miniGlyphs[a].dataOffset < s.miniGlyphs[b].dataOffset; });
-
+    // Lay the bitmaps out in codepoint order; stored ones are copied, the rest
+    // are read sorted by file offset with neighbouring bitmaps merged. A hot
+    // glyph's record sits right before its bitmap, so both go in one read.
+    spanCount = 0;
     uint32_t miniBitmapOffset = 0;
-    uint32_t lastBitmapEnd = UINT32_MAX;
     for (uint32_t i = 0; i < validCount; i++) {
-      uint32_t mapIdx = readOrder[i];
-      EpdGlyph& glyph = s.miniGlyphs[mapIdx];
-
-      if (glyph.dataLength == 0) {
-        glyph.dataOffset = miniBitmapOffset;
+      const uint32_t length = bitmapLength(i);
+      if (mappings[i].hot) {
+        const uint32_t entryOff = s.bitmapFileOffset + mappings[i].hot->entryOffset;
+        spans[spanCount++] = {entryOff, sizeof(EpdGlyph), reinterpret_cast<uint8_t*>(&s.miniGlyphs[i])};
+        if (length > 0) {
+          spans[spanCount++] = {entryOff + static_cast<uint32_t>(sizeof(EpdGlyph)), length,
+                                s.miniBitmap + miniBitmapOffset};
+        }
+      } else if (length == 0) {
         continue;
+      } else if (mappings[i].stored) {
+        memcpy(s.miniBitmap + miniBitmapOffset, mappings[i].stored->bitmap, length);
+      } else {
+        spans[spanCount++] = {s.bitmapFileOffset + s.miniGlyphs[i].dataOffset, length,
+                              s.miniBitmap + miniBitmapOffset};
       }
+      miniBitmapOffset += length;
+    }
 
-      uint32_t fileOff = s.bitmapFileOffset + glyph.dataOffset;
-      if (fileOff != lastBitmapEnd) {
-        if (!file.seekSet(fileOff)) {
-          LOG_ERR("SDCF", "Prewarm: failed to seek to bitmap (style %u)", styleIdx);
-          file.close();
-          delete[] readOrder;
-          delete[] mappings;
-          freeStyleMiniData(s);
-          return static_cast<int>(cpCount);
-        }
-        seekCount++;
-      }
-      if (file.read(s.miniBitmap + miniBitmapOffset, glyph.dataLength) != static_cast<int>(glyph.dataLength)) {
-        LOG_ERR("SDCF", "Prewarm: short bitmap read (style %u)", styleIdx);
-        delete[] readOrder;
-        delete[] mappings;
+    if (!readSpans("bitmaps")) {
+      freeStyleMiniData(s);
+      return static_cast<int>(cpCount);
+    }
+
+    // The bitmap space was laid out from the hot index, so its records must agree
+    for (uint32_t i = 0; i < validCount; i++) {
+      if (mappings[i].hot && s.miniGlyphs[i].dataLength != mappings[i].hot->dataLength) {
+        LOG_ERR("SDCF", "Prewarm: hot block record for U+%04lX doesn't match its index (style %u)",
+                static_cast<unsigned long>(mappings[i].codepoint), styleIdx);
         freeStyleMiniData(s);
         return static_cast<int>(cpCount);
       }
-      lastBitmapEnd = fileOff + glyph.dataLength;
+    }
+  }
 
+  uint32_t sdTime = millis() - sdStart;
+
+  // Keep what was read for later pages, then point the glyphs at the mini
+  // bitmap. Metadata-only glyphs keep their file-relative dataOffset.
+  uint32_t miniBitmapOffset = 0;
+  for (uint32_t i = 0; i < validCount; i++) {
+    EpdGlyph& glyph = s.miniGlyphs[i];
+    if (!mappings[i].stored) {
+      storeGlyph(glyphStoreKey(styleIdx, mappings[i].codepoint), glyph,
+                 metadataOnly ? nullptr : s.miniBitmap + miniBitmapOffset);
+    }
+    if (!metadataOnly) {
       glyph.dataOffset = miniBitmapOffset;
       miniBitmapOffset += glyph.dataLength;
     }
   }
 
-  uint32_t sdTime = millis() - sdStart;
-  delete[] readOrder;
-  delete[] mappings;
-
   // Full render prewarm: load the persistent kern classes + ligatures (one-time
   // per style, small — the big matrix is NOT loaded here) and then build the
   // per-page mini kern matrix restricted to class pairs reachable from this
@@ -908,7 +1065,9 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
   // Accumulate stats
   stats_.sdReadTimeMs += sdTime;
   stats_.seekCount += seekCount;
+  stats_.readCount += readCount;
   stats_.uniqueGlyphs += validCount;
+  stats_.storeBytes = glyphStoreBytes_;
   stats_.bitmapBytes += totalBitmapSize;
 
   return missed;
@@ -917,10 +1076,9 @@ int SdCardFont::prewarmStyle(uint8_t styleIdx, const uint32_t* codepoints, uint3
 // --- Cache management ---
 
 void SdCardFont::clearCache() {
-  clearOverflow();
-  // Note: advance table is intentionally preserved here. It persists across
-  // layout passes so repeated section indexing amortizes SD reads. Use
-  // clearPersistentCache() to wipe it.
+  // Note: the advance table and glyph store are intentionally preserved here.
+  // They persist across layout passes and pages so repeated section indexing
+  // and page turns amortize SD reads. Use clearPersistentCache() to wipe them.
   for (uint8_t i = 0; i < MAX_STYLES; i++) {
     if (!styles_[i].present) continue;
     freeStyleMiniData(styles_[i]);
@@ -936,6 +1094,7 @@ void SdCardFont::clearPersistentCache() {
     advanceTable_[i] = nullptr;
     advanceTableSize_[i] = 0;
   }
+  clearGlyphStore();
 }
 
 bool SdCardFont::advanceTableLookup(uint8_t styleIdx, uint32_t codepoint, uint16_t* outAdvance) const {
@@ -1184,11 +1343,17 @@ int SdCardFont::buildAdvanceTable(const char* utf8Text, uint8_t styleMask) {
 // --- Stats ---
 
 void SdCardFont::logStats(const char* label) {
-  LOG_DBG("SDCF", "[%s] total=%ums sd_read=%ums seeks=%u glyphs=%u bitmap=%u bytes", label, stats_.prewarmTotalMs,
-          stats_.sdReadTimeMs, stats_.seekCount, stats_.uniqueGlyphs, stats_.bitmapBytes);
+  LOG_DBG("SDCF", "[%s] total=%ums sd_read=%ums seeks=%u reads=%u glyphs=%u bitmap=%u bytes", label,
+          stats_.prewarmTotalMs, stats_.sdReadTimeMs, stats_.seekCount, stats_.readCount, stats_.uniqueGlyphs,
+          stats_.bitmapBytes);
+  LOG_DBG("SDCF", "[%s] store: hits=%u misses=%u size=%u/%u bytes", label, stats_.storeHits, stats_.storeMisses,
+          stats_.storeBytes, GLYPH_STORE_BUDGET);
 }
 
-void SdCardFont::resetStats() { stats_ = Stats{}; }
+void SdCardFont::resetStats() {
+  stats_ = Stats{};
+  stats_.storeBytes = glyphStoreBytes_;
+}
 
 // --- Public accessors ---
 
@@ -1229,9 +1394,120 @@ uint8_t SdCardFont::resolveStyleMask(uint8_t styleMask) const {
   return resolvedMask;
 }
 
-// --- On-demand glyph loading (overflow buffer) ---
+// --- Glyph store ---
+
+// Empty slots carry a key no codepoint can produce
+static constexpr uint32_t FREE_STORE_KEY = UINT32_MAX;
+
+SdCardFont::GlyphStoreEntry* SdCardFont::findStoredGlyph(uint32_t key) {
+  if (!glyphStore_) return nullptr;
+  uint16_t* end = glyphStoreOrder_ + glyphStoreCount_;
+  uint16_t* it = std::lower_bound(glyphStoreOrder_, end, key,
+                                        [this](uint16_t slot, uint32_t k) { return glyphStore_[slot].key < k; });
+  if (it == end || glyphStore_[*it].key != key) return nullptr;
+  glyphStore_[*it].lastUsed = ++glyphStoreClock_;
+  return &glyphStore_[*it];
+}
+
+void SdCardFont::evictStoredGlyph() {
+  // Linear scan for the least recently used entry: the store is small and
+  // evictions only happen while reading new glyphs from SD anyway.
+  uint16_t victim = 0;
+  for (uint16_t i = 1; i < glyphStoreCount_; i++) {
+    if (glyphStore_[glyphStoreOrder_[i]].lastUsed < glyphStore_[glyphStoreOrder_[victim]].lastUsed) {
+      victim = i;
+    }
+  }
+  GlyphStoreEntry& entry = glyphStore_[glyphStoreOrder_[victim]];
+  if (entry.bitmap) {
+    glyphStoreBytes_ -= entry.glyph.dataLength;
+    delete[] entry.bitmap;
+    entry.bitmap = nullptr;
+  }
+  entry.key = FREE_STORE_KEY;
+  memmove(glyphStoreOrder_ + victim, glyphStoreOrder_ + victim + 1,
+          (glyphStoreCount_ - victim - 1) * sizeof(glyphStoreOrder_[0]));
+  glyphStoreCount_--;
+}
+
+SdCardFont::GlyphStoreEntry* SdCardFont::storeGlyph(uint32_t key, const EpdGlyph& glyph, const uint8_t* bitmap) {
+  const uint32_t bytes = bitmap ? glyph.dataLength : 0;
+  if (bytes > GLYPH_STORE_BUDGET) return nullptr;
+
+  if (!glyphStore_) {
+    glyphStore_ = new (std::nothrow) GlyphStoreEntry[GLYPH_STORE_CAPACITY];
+    glyphStoreOrder_ = new (std::nothrow) uint16_t[GLYPH_STORE_CAPACITY];
+    if (!glyphStore_ || !glyphStoreOrder_) {
+      LOG_ERR("SDCF", "Failed to allocate glyph store (%u entries)", GLYPH_STORE_CAPACITY);
+      clearGlyphStore();
+      return nullptr;
+    }
+    for (uint16_t i = 0; i < GLYPH_STORE_CAPACITY; i++) glyphStore_[i].key = FREE_STORE_KEY;
+  }
+
+  // Already stored: records never change, so all that can be added is the bitmap.
+  // The lookup marks the entry as most recently used, so evicting below never
+  // picks it while older entries remain.
+  GlyphStoreEntry* entry = findStoredGlyph(key);
+  if (entry && (bytes == 0 || entry->bitmap)) return entry;
+
+  while (glyphStoreCount_ > 0 && ((!entry && glyphStoreCount_ == GLYPH_STORE_CAPACITY) ||
+                                  glyphStoreBytes_ + bytes > GLYPH_STORE_BUDGET)) {
+    evictStoredGlyph();
+  }
+
+  uint8_t* bitmapCopy = nullptr;
+  if (bytes > 0) {
+    bitmapCopy = new (std::nothrow) uint8_t[bytes];
+    if (!bitmapCopy) {
+      LOG_ERR("SDCF", "Failed to allocate %u bytes for stored glyph", bytes);
+      return entry;
+    }
+    memcpy(bitmapCopy, bitmap, bytes);
+    glyphStoreBytes_ += bytes;
+  }
+
+  if (entry) {
+    entry->bitmap = bitmapCopy;
+    return entry;
+  }
+
+  uint16_t slot = 0;
+  while (glyphStore_[slot].key != FREE_STORE_KEY) slot++;
+  entry = &glyphStore_[slot];
+  entry->glyph = glyph;
+  entry->bitmap = bitmapCopy;
+  entry->key = key;
+  entry->lastUsed = ++glyphStoreClock_;
+
+  uint16_t* end = glyphStoreOrder_ + glyphStoreCount_;
+  uint16_t* it = std::lower_bound(glyphStoreOrder_, end, key,
+                                  [this](uint16_t s, uint32_t k) { return glyphStore_[s].key < k; });
+  memmove(it + 1, it, (end - it) * sizeof(glyphStoreOrder_[0]));
+  *it = slot;
+  glyphStoreCount_++;
+  return entry;
+}
+
+void SdCardFont::clearGlyphStore() {
+  if (glyphStore_) {
+    for (uint16_t i = 0; i < GLYPH_STORE_CAPACITY; i++) {
+      delete[] glyphStore_[i].bitmap;
+    }
+  }
+  delete[] glyphStore_;
+  glyphStore_ = nullptr;
+  delete[] glyphStoreOrder_;
+  glyphStoreOrder_ = nullptr;
+  glyphStoreCount_ = 0;
+  glyphStoreBytes_ = 0;
+  stats_.storeBytes = 0;
+}
+
+// --- On-demand glyph loading (glyph store) ---
 
 const EpdGlyph* SdCardFont::onGlyphMiss(void* ctx, uint32_t codepoint) {
+  TRACE_SPAN("sd_font_glyph_read");
   auto* oc = static_cast<OverflowContext*>(ctx);
   auto* self = oc->self;
   uint8_t styleIdx = oc->styleIdx;
@@ -1240,95 +1516,93 @@ const EpdGlyph* SdCardFont::onGlyphMiss(void* ctx, uint32_t codepoint) {
   const auto& s = self->styles_[styleIdx];
   if (!s.fullIntervals) return nullptr;
 
-  // Check overflow cache first (matching both codepoint and style)
-  for (uint32_t i = 0; i < self->overflowCount_; i++) {
-    if (self->overflow_[i].codepoint == codepoint && self->overflow_[i].styleIdx == styleIdx) {
-      return &self->overflow_[i].glyph;
-    }
+  // Check the glyph store first (the key covers both codepoint and style)
+  const uint32_t key = glyphStoreKey(styleIdx, codepoint);
+  const GlyphStoreEntry* stored = self->findStoredGlyph(key);
+  if (stored && hasGlyphBitmap(*stored)) {
+    self->stats_.storeHits++;
+    return &stored->glyph;
   }
+  self->stats_.storeMisses++;
 
   // Look up global glyph index via full intervals
   int32_t globalIdx = self->findGlobalGlyphIndex(s, codepoint);
   if (globalIdx < 0) return nullptr;
 
-  // Pick overflow slot (ring buffer). Read into temporaries first so the
-  // existing slot stays valid if SD I/O fails. Bookkeeping (count/next)
-  // is deferred until after all I/O succeeds to avoid inconsistent state.
-  uint32_t slot = self->overflowNext_;
-  bool wasAtCapacity = (self->overflowCount_ == OVERFLOW_CAPACITY);
-
-  // Read glyph metadata into temporary
+  // Read into temporaries first so the store only changes once all SD I/O
+  // has succeeded.
   FsFile file;
   if (!Storage.openFileForRead("SDCF", self->filePath_, file)) {
-    LOG_ERR("SDCF", "Overflow: failed to open .cpfont");
+    LOG_ERR("SDCF", "Glyph miss: failed to open .cpfont");
     return nullptr;
   }
 
+  // A stored record without its bitmap (from a metadata-only prewarm) only needs the bitmap read
   EpdGlyph tempGlyph = {};
-  uint32_t glyphFileOff = s.glyphsFileOffset + static_cast<uint32_t>(globalIdx) * sizeof(EpdGlyph);
-  if (!file.seekSet(glyphFileOff)) {
-    LOG_ERR("SDCF", "Overflow: failed to seek to glyph for U+%04X style %u", codepoint, styleIdx);
-    file.close();
-    return nullptr;
-  }
-  if (file.read(reinterpret_cast<uint8_t*>(&tempGlyph), sizeof(EpdGlyph)) != sizeof(EpdGlyph)) {
-    LOG_ERR("SDCF", "Overflow: failed to read glyph metadata for U+%04X style %u", codepoint, styleIdx);
-    return nullptr;
+  if (stored) {
+    tempGlyph = stored->glyph;
+  } else {
+    uint32_t glyphFileOff = s.glyphsFileOffset + static_cast<uint32_t>(globalIdx) * sizeof(EpdGlyph);
+    if (!file.seekSet(glyphFileOff)) {
+      LOG_ERR("SDCF", "Glyph miss: failed to seek to glyph for U+%04X style %u", codepoint, styleIdx);
+      file.close();
+      return nullptr;
+    }
+    if (file.read(reinterpret_cast<uint8_t*>(&tempGlyph), sizeof(EpdGlyph)) != sizeof(EpdGlyph)) {
+      LOG_ERR("SDCF", "Glyph miss: failed to read glyph metadata for U+%04X style %u", codepoint, styleIdx);
+      return nullptr;
+    }
+    self->stats_.seekCount++;
+    self->stats_.readCount++;
   }
 
   // Read bitmap data into temporary (if any)
-  uint8_t* tempBitmap = nullptr;
+  std::unique_ptr<uint8_t[]> tempBitmap;
   if (tempGlyph.dataLength > 0) {
-    tempBitmap = new (std::nothrow) uint8_t[tempGlyph.dataLength];
+    tempBitmap.reset(new (std::nothrow) uint8_t[tempGlyph.dataLength]);
     if (!tempBitmap) {
-      LOG_ERR("SDCF", "Overflow: failed to allocate %u bytes for U+%04X bitmap", tempGlyph.dataLength, codepoint);
+      LOG_ERR("SDCF", "Glyph miss: failed to allocate %u bytes for U+%04X bitmap", tempGlyph.dataLength, codepoint);
       return nullptr;
     }
     if (!file.seekSet(s.bitmapFileOffset + tempGlyph.dataOffset)) {
-      LOG_ERR("SDCF", "Overflow: failed to seek to bitmap for U+%04X", codepoint);
-      delete[] tempBitmap;
+      LOG_ERR("SDCF", "Glyph miss: failed to seek to bitmap for U+%04X", codepoint);
       file.close();
       return nullptr;
     }
-    if (file.read(tempBitmap, tempGlyph.dataLength) != static_cast<int>(tempGlyph.dataLength)) {
-      LOG_ERR("SDCF", "Overflow: failed to read bitmap for U+%04X", codepoint);
-      delete[] tempBitmap;
+    if (file.read(tempBitmap.get(), tempGlyph.dataLength) != static_cast<int>(tempGlyph.dataLength)) {
+      LOG_ERR("SDCF", "Glyph miss: failed to read bitmap for U+%04X", codepoint);
       return nullptr;
     }
+    self->stats_.seekCount++;
+    self->stats_.readCount++;
   }
 
-  // All reads succeeded — commit to slot and advance ring buffer
-  if (wasAtCapacity) {
-    delete[] self->overflow_[slot].bitmap;
-  } else {
-    self->overflowCount_++;
+  // All reads succeeded — store the glyph. The returned entry stays put until
+  // it is evicted as the least recently used.
+  const GlyphStoreEntry* entry = self->storeGlyph(key, tempGlyph, tempBitmap ? tempBitmap.get() : nullptr);
+  if (!entry || !hasGlyphBitmap(*entry)) {
+    LOG_ERR("SDCF", "Glyph miss: failed to store U+%04X style %u", codepoint, styleIdx);
+    return nullptr;
   }
-  self->overflowNext_ = (slot + 1) % OVERFLOW_CAPACITY;
-  self->overflow_[slot].glyph = tempGlyph;
-  self->overflow_[slot].bitmap = tempBitmap;
-  self->overflow_[slot].codepoint = codepoint;
-  self->overflow_[slot].styleIdx = styleIdx;
+  self->stats_.storeBytes = self->glyphStoreBytes_;
 
-  LOG_DBG("SDCF", "Overflow: loaded U+%04X style %u on demand (slot %u/%u)", codepoint, styleIdx, slot,
-          OVERFLOW_CAPACITY);
+  LOG_DBG("SDCF", "Glyph store: loaded U+%04X style %u on demand (%u glyphs, %u bytes)", codepoint, styleIdx,
+          self->glyphStoreCount_, self->glyphStoreBytes_);
 
-  return &self->overflow_[slot].glyph;
+  return &entry->glyph;
 }
 
 bool SdCardFont::isOverflowGlyph(const EpdGlyph* glyph) const {
-  for (uint32_t i = 0; i < overflowCount_; i++) {
-    if (&overflow_[i].glyph == glyph) return true;
-  }
-  return false;
+  if (!glyphStore_) return false;
+  const auto* p = reinterpret_cast<const uint8_t*>(glyph);
+  return p >= reinterpret_cast<const uint8_t*>(glyphStore_) &&
+         p < reinterpret_cast<const uint8_t*>(glyphStore_ + GLYPH_STORE_CAPACITY);
 }
 
 const uint8_t* SdCardFont::getOverflowBitmap(const EpdGlyph* glyph) const {
-  for (uint32_t i = 0; i < overflowCount_; i++) {
-    if (&overflow_[i].glyph == glyph) {
-      return overflow_[i].bitmap;
-    }
-  }
-  return nullptr;
+  if (!isOverflowGlyph(glyph)) return nullptr;
+  const auto offset = reinterpret_cast<const uint8_t*>(glyph) - reinterpret_cast<const uint8_t*>(glyphStore_);
+  return glyphStore_[offset / sizeof(GlyphStoreEntry)].bitmap;
 }
 
 SdCardFont* SdCardFont::fromMissCtx(void* ctx) { return static_cast<OverflowContext*>(ctx)->self; }
@@ -13,8 +13,10 @@
 // The canonical version for the build tooling lives in
 // lib/EpdFont/scripts/cpfont_version.py. This firmware-side copy must be
 // bumped manually when the firmware is updated to support a new format.
-// Reader enforcement: SdCardFont::load().
-#define CPFONT_VERSION 4
+// Reader enforcement: SdCardFont::load(), which also still accepts files as
+// old as CPFONT_MIN_VERSION.
+#define CPFONT_VERSION 5
+#define CPFONT_MIN_VERSION 4
 
 class SdCardFont {
  public:
@@ -31,7 +33,7 @@ class SdCardFont {
   SdCardFont& operator=(SdCardFont&&) = delete;
 
   // Load .cpfont file: reads header + intervals into RAM, records file layout offsets.
-  // Supports v4 (multi-style) format.
+  // Supports v4 (multi-style) and v5 (multi-style + hot glyph block) formats.
   // Returns true on success.
   bool load(const char* path);
 
@@ -60,10 +62,14 @@ class SdCardFont {
   // preserves the persistent advance cache (reused across passes).
   void clearCache();
 
-  // Drop the persistent advance cache. Call when unloading the SD font or
-  // when font/size/family/glyph-table state changes.
+  // Drop the persistent advance cache and glyph store. Call when unloading the
+  // SD font or when font/size/family/glyph-table state changes.
   void clearPersistentCache();
 
+  // Free every glyph in the persistent glyph store (e.g. before a
+  // memory-hungry activity). Glyphs are re-read from SD on next use.
+  void clearGlyphStore();
+
   // Returns pointer to the managed EpdFont for a given style.
   // Returns nullptr if the style is not present.
   EpdFont* getEpdFont(uint8_t style = 0);
@@ -81,7 +87,8 @@ class SdCardFont {
   // Number of styles present in this font file.
   uint8_t styleCount() const { return styleCount_; }
 
-  // Returns true if the glyph pointer points into the overflow buffer.
+  // Returns true if the glyph pointer points into the glyph store, i.e. it was
+  // handed out by the glyph miss handler rather than from the prewarmed tables.
   bool isOverflowGlyph(const EpdGlyph* glyph) const;
 
   // Returns the bitmap for an on-demand-loaded (overflow) glyph.
@@ -91,12 +98,22 @@ class SdCardFont {
   // Used by GfxRenderer::getGlyphBitmap() to recover the SdCardFont from EpdFontData::glyphMissCtx.
   static SdCardFont* fromMissCtx(void* ctx);
 
+  // Glyph store bounds: at most GLYPH_STORE_CAPACITY glyphs whose bitmaps
+  // total at most GLYPH_STORE_BUDGET bytes. Least recently used glyphs are
+  // evicted first.
+  static constexpr uint16_t GLYPH_STORE_CAPACITY = 256;
+  static constexpr uint32_t GLYPH_STORE_BUDGET = 12 * 1024;
+
   struct Stats {
     uint32_t prewarmTotalMs = 0;
     uint32_t sdReadTimeMs = 0;
     uint32_t seekCount = 0;
+    uint32_t readCount = 0;
     uint32_t uniqueGlyphs = 0;
     uint32_t bitmapBytes = 0;
+    uint32_t storeHits = 0;
+    uint32_t storeMisses = 0;
+    uint32_t storeBytes = 0;  // current glyph store bitmap bytes (not reset by resetStats)
   };
   void logStats(const char* label = "SDCF");
   void resetStats();
@@ -120,6 +137,19 @@ class SdCardFont {
     uint8_t kernLeftClassCount = 0;
     uint8_t kernRightClassCount = 0;
     uint8_t ligaturePairCount = 0;
+    uint16_t hotGlyphCount = 0;  // v5 only
+  };
+
+  // A glyph in a v5 file's hot block: the style's most frequent glyphs, each
+  // stored as its EpdGlyph record directly followed by its bitmap, at the head
+  // of the bitmap section. A page of common text then prewarms from one or two
+  // contiguous stretches of the file instead of records and bitmaps scattered
+  // in codepoint order. The main glyph table still covers these glyphs; its
+  // records point at the same bitmaps.
+  struct HotGlyph {
+    uint32_t codepoint;
+    uint32_t entryOffset;  // record position, relative to bitmapFileOffset
+    uint16_t dataLength;   // bitmap bytes following the record
   };
 
   // All per-style data: file offsets, intervals, kern/lig, prewarm cache, EpdFont
@@ -128,6 +158,7 @@ class SdCardFont {
 
     // File layout offsets for this style's data sections
     uint32_t intervalsFileOffset = 0;
+    uint32_t hotIndexFileOffset = 0;
     uint32_t glyphsFileOffset = 0;
     uint32_t kernLeftFileOffset = 0;
     uint32_t kernRightFileOffset = 0;
@@ -147,8 +178,15 @@ class SdCardFont {
     EpdKernClassEntry* kernLeftClasses = nullptr;
     EpdKernClassEntry* kernRightClasses = nullptr;
     EpdLigaturePair* ligaturePairs = nullptr;
+    uint32_t* ligatureStartBits = nullptr;  // EpdFontData::ligatureStartBits, built from ligaturePairs
     bool kernLigLoaded = false;
 
+    // Hot block index sorted by codepoint (lazy-loaded on first prewarm,
+    // nullptr for v4 files or if it couldn't be loaded)
+    HotGlyph* hotGlyphs = nullptr;
+    uint32_t hotBlockSize = 0;  // bytes at the start of the bitmap section
+    bool hotIndexLoaded = false;
+
     // Stub EpdFontData returned when not prewarmed
     EpdFontData stubData{};
 
@@ -192,17 +230,34 @@ class SdCardFont {
   };
   OverflowContext overflowCtx_[MAX_STYLES] = {};
 
-  // Shared on-demand overflow buffer (ring buffer of glyphs loaded via glyphMissHandler)
-  static constexpr uint32_t OVERFLOW_CAPACITY = 8;
-  struct OverflowEntry {
-    EpdGlyph glyph;
-    uint8_t* bitmap = nullptr;
-    uint32_t codepoint = 0;
-    uint8_t styleIdx = 0;
+  // Persistent glyph store shared by all styles. Holds glyph records (and
+  // their bitmaps once a full prewarm or a glyph miss has needed them) across
+  // pages, so prewarm only reads codepoints it has not seen recently from SD.
+  // It also serves glyphs loaded on demand by onGlyphMiss(): entries live in a
+  // fixed array, so a pointer handed out stays valid until that entry is
+  // evicted. glyphStoreOrder_ lists the used slots sorted by key for lookup.
+  struct GlyphStoreEntry {
+    EpdGlyph glyph;             // dataOffset is relative to the style's bitmap section
+    uint8_t* bitmap = nullptr;  // nullptr until loaded (or for empty glyphs)
+    uint32_t key = 0;           // glyphStoreKey(styleIdx, codepoint)
+    uint32_t lastUsed = 0;
   };
-  OverflowEntry overflow_[OVERFLOW_CAPACITY] = {};
-  uint32_t overflowCount_ = 0;
-  uint32_t overflowNext_ = 0;
+  GlyphStoreEntry* glyphStore_ = nullptr;
+  uint16_t* glyphStoreOrder_ = nullptr;
+  uint16_t glyphStoreCount_ = 0;
+  uint32_t glyphStoreBytes_ = 0;
+  uint32_t glyphStoreClock_ = 0;
+
+  static uint32_t glyphStoreKey(uint8_t styleIdx, uint32_t codepoint) {
+    return (static_cast<uint32_t>(styleIdx) << 24) | (codepoint & 0xFFFFFF);
+  }
+  static bool hasGlyphBitmap(const GlyphStoreEntry& e) { return e.bitmap || e.glyph.dataLength == 0; }
+  GlyphStoreEntry* findStoredGlyph(uint32_t key);
+  // Insert or update the entry for key, evicting least recently used glyphs to
+  // stay within the store's bounds. bitmap (glyph.dataLength bytes, or nullptr
+  // for metadata only) is copied. Returns nullptr if the glyph can't be stored.
+  GlyphStoreEntry* storeGlyph(uint32_t key, const EpdGlyph& glyph, const uint8_t* bitmap);
+  void evictStoredGlyph();
 
   // Compact advance-only table for layout measurement (per-style).
   // Built by buildAdvanceTable(), queried by getAdvance().
@@ -232,6 +287,8 @@ class SdCardFont {
   void freeStyleKernLigatureData(PerStyle& s);
   void freeStyleMiniKern(PerStyle& s);
   bool loadStyleKernLigatureData(PerStyle& s);
+  bool loadStyleHotIndex(PerStyle& s);
+  const HotGlyph* findHotGlyph(const PerStyle& s, uint32_t codepoint) const;
   bool buildMiniKernMatrix(PerStyle& s, const uint32_t* codepoints, uint32_t cpCount);
   void applyKernLigaturePointers(PerStyle& s, EpdFontData& data) const;
   void applyGlyphMissCallback(uint8_t styleIdx);
@@ -240,8 +297,7 @@ class SdCardFont {
 
   // Global helpers
   void freeAll();
-  void clearOverflow();
-  static void computeStyleFileOffsets(PerStyle& s, uint32_t baseOffset);
+  static void computeStyleFileOffsets(PerStyle& s, uint32_t baseOffset, uint16_t version);
 
   // Static callback for EpdFontData::glyphMissHandler (per-style via OverflowContext)
   static const EpdGlyph* onGlyphMiss(void* ctx, uint32_t codepoint);
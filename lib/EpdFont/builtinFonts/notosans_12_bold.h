@@ -3842,6 +3842,100 @@ static const EpdLigaturePair notosans_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_12_boldKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, // U+0020
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 9, 13, 0, 0, 10, 14, 10, 15, 0, 16, 17, 18, 18, 9, 19, 20, 3, 0, 0, 0, 21, // U+0040
+    0, 22, 23, 24, 0, 23, 25, 0, 22, 0, 0, 0, 0, 22, 22, 23, 23, 0, 26, 0, 24, 0, 27, 27, 28, 27, 0, 3, 0, 0, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 32, // U+00A0
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0, 10, 0, 10, 10, 10, 10, 10, 0, 10, 17, 17, 17, 17, 19, 14, 0, // U+00C0
+    22, 22, 22, 22, 22, 22, 23, 0, 23, 23, 23, 23, 0, 0, 33, 33, 23, 0, 23, 23, 23, 23, 23, 0, 23, 0, 0, 0, 0, 27, 23, 27, // U+00E0
+    7, 22, 7, 22, 34, 22, 9, 0, 9, 0, 9, 0, 9, 0, 10, 35, 10, 0, 11, 23, 11, 23, 11, 23, 11, 23, 11, 23, 0, 0, 0, 0, // U+0100
+    0, 0, 0, 0, 0, 22, 0, 0, 0, 36, 0, 33, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 9, 0, 28, 13, 0, 13, 0, 13, 35, 13, // U+0120
+    0, 13, 0, 0, 22, 0, 22, 0, 0, 22, 0, 22, 10, 23, 10, 23, 10, 23, 11, 23, 0, 26, 0, 26, 0, 26, 0, 0, 0, 0, 0, 0, // U+0140
+    0, 0, 16, 24, 16, 38, 16, 24, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 18, 27, 19, 27, 19, 20, 0, 20, 0, 20, 0, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 22, 11, 23, 10, 0, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 24, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    43, 43, 44, 45, 46, 47, 0, 0, 0, 48, 48, 44, 49, 0, 50, 0, 51, 52, 53, 45, 54, 43, 49, 53, 0, 0, 49, 0, 0, 0, 55, 0, // U+0400
+    56, 46, 45, 50, 57, 49, 54, 0, 0, 54, 48, 0, 48, 55, 55, 0, 58, 59, 60, 61, 62, 63, 64, 60, 65, 65, 64, 65, 65, 65, 63, 65, // U+0420
+    63, 66, 61, 67, 63, 64, 62, 65, 65, 62, 68, 65, 68, 63, 63, 65, 63, 63, 69, 70, 66, 71, 0, 72, 73, 68, 68, 74, 64, 65, 67, 65, // U+0440
+    55, 75, 76, 68, 46, 66, 51, 77, 51, 77, 0, 0, 0, 0, 78, 0, 0, 63, 55, 63, 50, 75, 50, 75, 67, 67, 55, 63, 55, 63, 55, 75, // U+0460
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 62, 76, 68, 56, 63, 79, 80, 81, 82, 0, 0, 83, 84, 78, 60, 83, 84, 49, 64, 49, 64, // U+0480
+    49, 64, 54, 62, 81, 80, 0, 0, 0, 63, 46, 66, 79, 80, 85, 86, 85, 86, 83, 84, 54, 62, 54, 62, 0, 0, 0, 0, 87, 88, 87, 88, // U+04A0
+    0, 49, 64, 0, 0, 54, 62, 0, 0, 54, 62, 0, 0, 54, 62, 0, 51, 58, 51, 58, 43, 88, 43, 88, 55, 63, 55, 63, 49, 64, 78, 60, // U+04C0
+    0, 0, 0, 65, 0, 65, 55, 63, 55, 63, 55, 63, 55, 63, 50, 67, 50, 67, 50, 67, 0, 65, 79, 80, 0, 65, 81, 82, 83, 84, 49, 84, // U+04E0
+};
+
+static const uint8_t notosans_12_boldKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8, // U+0020
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 11, 12, 0, 0, 0, 0, 10, 0, 10, 0, 0, 13, 14, 15, 15, 16, 17, 18, 0, 0, 4, 0, 0, // U+0040
+    0, 19, 20, 21, 21, 21, 22, 23, 20, 0, 24, 20, 20, 25, 25, 21, 25, 21, 25, 26, 22, 25, 27, 27, 27, 27, 28, 0, 0, 4, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, // U+00A0
+    9, 9, 9, 9, 9, 9, 31, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 14, 14, 14, 14, 17, 0, 0, // U+00C0
+    21, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21, 21, 0, 21, 25, 25, 25, 25, 27, 20, 27, // U+00E0
+    9, 19, 9, 19, 9, 19, 10, 21, 10, 21, 10, 21, 10, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 10, 23, 10, 23, // U+0100
+    10, 23, 10, 23, 0, 20, 0, 32, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 20, 0, 20, 0, 20, 0, // U+0120
+    20, 0, 0, 0, 25, 0, 25, 0, 0, 0, 0, 25, 10, 21, 10, 21, 10, 21, 10, 21, 0, 25, 0, 25, 0, 0, 0, 26, 0, 0, 0, 26, // U+0140
+    0, 0, 13, 22, 13, 22, 13, 22, 14, 25, 14, 25, 14, 25, 14, 25, 14, 25, 14, 25, 15, 27, 17, 27, 17, 18, 28, 18, 28, 18, 28, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    10, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 31, 19, 10, 21, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 13, 22, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 34, 0, 35, 36, 0, 0, 37, 38, 0, 34, 0, 0, 39, 0, 40, 0, 0, 0, 41, 0, 42, 43, 0, 0, 0, 38, 0, 0, 35, 0, // U+0400
+    0, 35, 34, 39, 44, 42, 0, 45, 0, 0, 34, 0, 0, 43, 0, 46, 47, 48, 49, 49, 50, 51, 52, 53, 49, 49, 49, 54, 49, 49, 51, 49, // U+0420
+    49, 51, 55, 56, 51, 52, 49, 57, 49, 49, 55, 49, 49, 53, 49, 58, 51, 51, 59, 49, 51, 60, 0, 61, 62, 54, 49, 59, 49, 49, 56, 49, // U+0440
+    63, 64, 65, 0, 0, 66, 40, 50, 0, 66, 0, 0, 0, 66, 43, 0, 45, 0, 63, 47, 67, 64, 67, 64, 63, 47, 63, 47, 63, 47, 63, 64, // U+0460
+    63, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 65, 59, 0, 66, 0, 66, 65, 0, 0, 66, 42, 52, 43, 53, 0, 66, 0, 66, 0, 59, // U+0480
+    68, 55, 0, 66, 0, 66, 0, 66, 63, 47, 63, 47, 34, 55, 69, 70, 69, 70, 42, 52, 68, 55, 45, 57, 45, 57, 0, 66, 71, 72, 71, 72, // U+04A0
+    0, 42, 52, 0, 66, 73, 50, 0, 66, 0, 66, 45, 57, 0, 66, 0, 40, 74, 40, 74, 40, 74, 0, 47, 75, 74, 75, 74, 42, 52, 43, 53, // U+04C0
+    0, 0, 0, 49, 0, 49, 63, 47, 63, 47, 63, 47, 43, 53, 39, 56, 39, 56, 39, 56, 45, 57, 0, 66, 0, 49, 65, 0, 42, 52, 42, 52, // U+04E0
+};
+
+static const uint32_t notosans_12_boldLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
@@ -3863,4 +3957,7 @@ static const EpdFontData notosans_12_bold = {
     76,
     notosans_12_boldLigaturePairs,
     5,
+    notosans_12_boldKernLeftDirect,
+    notosans_12_boldKernRightDirect,
+    notosans_12_boldLigatureStartBits,
 };
@@ -4552,6 +4552,100 @@ static const EpdLigaturePair notosans_14_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_14_bolditalicKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    1, 0, 2, 0, 0, 0, 3, 2, 4, 0, 0, 0, 5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0020
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 13, 14, 0, 0, 10, 15, 10, 16, 0, 17, 18, 19, 19, 13, 20, 21, 4, 0, 0, 0, 22, // U+0040
+    0, 23, 24, 25, 0, 24, 26, 0, 0, 0, 0, 27, 0, 0, 0, 24, 24, 0, 28, 0, 29, 0, 30, 30, 27, 30, 0, 4, 0, 0, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 34, // U+00A0
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0, 10, 0, 10, 10, 10, 10, 10, 0, 10, 18, 18, 18, 18, 20, 15, 0, // U+00C0
+    23, 23, 23, 23, 23, 23, 24, 0, 24, 24, 24, 24, 0, 0, 0, 35, 24, 0, 24, 24, 24, 24, 24, 0, 24, 0, 0, 0, 0, 30, 24, 30, // U+00E0
+    7, 23, 7, 23, 7, 23, 9, 0, 9, 0, 9, 0, 9, 0, 10, 36, 10, 0, 11, 24, 11, 24, 11, 24, 11, 24, 11, 24, 0, 0, 0, 0, // U+0100
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 35, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 13, 27, 27, 14, 0, 14, 0, 14, 36, 14, // U+0120
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 24, 10, 24, 10, 24, 11, 24, 0, 28, 0, 28, 0, 28, 0, 0, 0, 0, 0, 0, // U+0140
+    0, 0, 17, 29, 17, 39, 17, 29, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 19, 30, 20, 30, 20, 21, 0, 21, 0, 21, 0, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 23, 11, 24, 10, 24, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 29, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 44, 45, 46, 47, 0, 0, 48, 44, 44, 49, 50, 0, 51, 0, 52, 53, 54, 45, 55, 0, 50, 54, 0, 0, 50, 0, 0, 0, 56, 0, // U+0400
+    57, 46, 45, 51, 58, 50, 55, 0, 0, 55, 44, 0, 44, 56, 56, 0, 59, 60, 61, 62, 63, 62, 64, 61, 59, 59, 65, 59, 59, 59, 66, 67, // U+0420
+    66, 64, 67, 68, 66, 65, 69, 59, 59, 69, 70, 59, 70, 66, 66, 59, 62, 62, 71, 62, 64, 72, 0, 73, 74, 70, 70, 67, 65, 59, 75, 59, // U+0440
+    51, 76, 77, 70, 46, 0, 52, 78, 52, 78, 0, 0, 0, 0, 54, 61, 0, 0, 56, 66, 51, 76, 51, 76, 68, 68, 56, 66, 56, 66, 51, 76, // U+0460
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 63, 77, 70, 57, 66, 79, 80, 81, 82, 0, 83, 84, 85, 54, 61, 84, 85, 50, 64, 50, 64, // U+0480
+    50, 64, 55, 63, 81, 80, 0, 83, 0, 66, 46, 0, 79, 63, 86, 87, 86, 87, 84, 85, 55, 63, 55, 63, 0, 0, 0, 83, 88, 62, 88, 62, // U+04A0
+    0, 50, 64, 0, 64, 55, 63, 0, 0, 55, 63, 0, 0, 55, 63, 0, 52, 23, 52, 23, 0, 62, 0, 62, 56, 66, 56, 66, 50, 64, 54, 61, // U+04C0
+    0, 0, 0, 0, 0, 0, 56, 66, 56, 66, 56, 66, 56, 66, 51, 68, 51, 68, 51, 68, 0, 59, 79, 80, 0, 59, 81, 82, 84, 85, 50, 85, // U+04E0
+};
+
+static const uint8_t notosans_14_bolditalicKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8, // U+0020
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 11, 12, 0, 0, 0, 0, 10, 0, 10, 0, 13, 14, 15, 16, 16, 17, 18, 19, 0, 0, 4, 0, 0, // U+0040
+    0, 20, 0, 21, 21, 21, 22, 23, 0, 0, 24, 0, 0, 25, 25, 21, 25, 21, 25, 26, 27, 25, 28, 28, 0, 28, 29, 0, 0, 4, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, // U+00A0
+    9, 9, 9, 9, 9, 9, 32, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 15, 15, 15, 15, 18, 0, 24, // U+00C0
+    21, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 25, 21, 21, 21, 21, 21, 0, 21, 25, 25, 25, 25, 28, 0, 28, // U+00E0
+    9, 20, 9, 20, 9, 20, 10, 21, 10, 21, 10, 21, 10, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 0, 21, 10, 23, 10, 23, // U+0100
+    10, 23, 10, 23, 0, 0, 0, 33, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, // U+0120
+    0, 0, 0, 0, 25, 0, 25, 0, 25, 0, 0, 25, 10, 21, 10, 21, 10, 21, 10, 21, 0, 25, 0, 25, 0, 0, 0, 26, 0, 26, 0, 26, // U+0140
+    0, 26, 14, 27, 14, 27, 14, 27, 15, 25, 15, 25, 15, 25, 15, 25, 15, 25, 15, 25, 16, 28, 18, 28, 18, 19, 29, 19, 29, 19, 29, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    10, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 20, 32, 20, 10, 21, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 14, 27, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 35, 0, 36, 37, 0, 0, 38, 39, 0, 35, 0, 0, 40, 0, 41, 0, 0, 0, 42, 0, 43, 44, 0, 0, 0, 39, 0, 0, 36, 0, // U+0400
+    0, 36, 35, 40, 45, 43, 0, 46, 0, 0, 35, 0, 0, 44, 0, 47, 48, 49, 48, 50, 51, 48, 52, 50, 53, 53, 54, 55, 54, 54, 48, 54, // U+0420
+    54, 48, 54, 56, 48, 57, 53, 58, 53, 53, 59, 53, 53, 52, 54, 60, 48, 48, 61, 50, 48, 62, 0, 63, 64, 55, 54, 61, 54, 53, 65, 53, // U+0440
+    66, 67, 68, 0, 0, 69, 41, 70, 0, 69, 0, 0, 0, 69, 44, 50, 46, 69, 71, 72, 66, 67, 66, 67, 71, 72, 71, 72, 71, 72, 66, 67, // U+0460
+    71, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 68, 61, 0, 69, 0, 69, 68, 0, 0, 69, 43, 50, 44, 50, 0, 69, 0, 69, 68, 61, // U+0480
+    73, 59, 0, 69, 0, 69, 0, 69, 71, 72, 71, 72, 35, 69, 74, 75, 74, 75, 43, 52, 73, 59, 46, 58, 46, 58, 0, 69, 76, 77, 76, 77, // U+04A0
+    0, 43, 52, 0, 69, 78, 70, 0, 69, 0, 69, 46, 58, 0, 69, 0, 41, 79, 41, 79, 41, 79, 0, 72, 80, 50, 80, 50, 43, 52, 44, 50, // U+04C0
+    0, 0, 0, 69, 0, 69, 71, 72, 71, 72, 71, 72, 44, 52, 40, 56, 40, 56, 40, 56, 46, 58, 0, 69, 0, 53, 68, 0, 43, 52, 43, 52, // U+04E0
+};
+
+static const uint32_t notosans_14_bolditalicLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData notosans_14_bolditalic = {
     notosans_14_bolditalicBitmaps,
     notosans_14_bolditalicGlyphs,
@@ -4573,4 +4667,7 @@ static const EpdFontData notosans_14_bolditalic = {
     83,
     notosans_14_bolditalicLigaturePairs,
     5,
+    notosans_14_bolditalicKernLeftDirect,
+    notosans_14_bolditalicKernRightDirect,
+    notosans_14_bolditalicLigatureStartBits,
 };
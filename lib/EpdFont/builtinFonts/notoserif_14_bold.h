@@ -4219,6 +4219,100 @@ static const EpdLigaturePair notoserif_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notoserif_14_boldKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 3, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0020
+    5, 6, 7, 0, 8, 9, 10, 11, 0, 0, 0, 12, 13, 0, 14, 8, 3, 8, 15, 16, 17, 18, 19, 20, 21, 22, 0, 0, 0, 0, 0, 0, // U+0040
+    0, 23, 24, 0, 0, 25, 26, 27, 23, 0, 0, 28, 0, 23, 23, 24, 24, 0, 29, 30, 0, 0, 31, 32, 0, 33, 0, 0, 0, 0, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, // U+00A0
+    36, 36, 36, 36, 36, 36, 9, 0, 9, 9, 9, 9, 0, 0, 0, 0, 8, 14, 8, 8, 8, 8, 8, 0, 8, 18, 18, 18, 18, 22, 8, 24, // U+00C0
+    23, 23, 23, 23, 23, 23, 25, 0, 25, 25, 25, 25, 0, 0, 0, 0, 24, 23, 24, 24, 24, 24, 24, 0, 24, 0, 0, 0, 0, 33, 24, 33, // U+00E0
+    6, 0, 36, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 37, 8, 0, 9, 25, 9, 25, 9, 25, 9, 25, 9, 25, 11, 0, 11, 0, // U+0100
+    11, 0, 11, 0, 0, 23, 0, 23, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 28, 28, 13, 0, 13, 0, 0, 37, 0, // U+0120
+    0, 13, 0, 14, 23, 14, 23, 14, 23, 23, 0, 23, 8, 24, 8, 24, 8, 24, 9, 25, 15, 29, 15, 29, 15, 29, 16, 30, 16, 30, 16, 30, // U+0140
+    16, 30, 17, 0, 17, 39, 17, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 20, 32, 22, 33, 22, 0, 0, 0, 0, 0, 0, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 9, 25, 8, 24, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 30, 17, 0, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 44, 0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0400
+    0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 45, 0, 45, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, // U+0420
+    48, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, // U+0440
+    51, 0, 52, 0, 0, 53, 54, 0, 54, 0, 55, 0, 55, 0, 56, 24, 0, 0, 51, 48, 57, 0, 57, 0, 33, 58, 51, 48, 51, 24, 51, 0, // U+0460
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 24, 59, 48, 60, 61, 0, 61, 62, 0, 55, 63, 56, 48, 55, 63, 55, 63, 55, 63, // U+0480
+    55, 63, 0, 64, 60, 61, 62, 0, 51, 0, 0, 53, 60, 61, 0, 0, 0, 0, 65, 63, 0, 64, 0, 64, 0, 0, 62, 0, 51, 48, 51, 48, // U+04A0
+    0, 0, 0, 62, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 23, 54, 23, 66, 48, 66, 48, 51, 48, 51, 48, 0, 0, 0, 0, // U+04C0
+    56, 0, 0, 0, 0, 0, 51, 48, 51, 48, 51, 48, 0, 48, 46, 58, 46, 58, 46, 58, 0, 0, 60, 61, 0, 0, 0, 61, 65, 63, 65, 63, // U+04E0
+};
+
+static const uint8_t notoserif_14_boldKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 5, 0, 6, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 9, // U+0020
+    10, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14, 12, 12, 12, 12, 13, 12, 13, 12, 15, 16, 17, 18, 19, 20, 21, 22, 0, 0, 4, 0, 0, // U+0040
+    0, 23, 24, 25, 25, 25, 0, 26, 24, 27, 0, 24, 24, 27, 27, 25, 27, 25, 27, 28, 29, 30, 31, 32, 33, 34, 35, 0, 0, 4, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 36, 0, 0, 0, 0, // U+00A0
+    11, 11, 11, 11, 11, 11, 38, 13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 0, 13, 17, 17, 17, 17, 21, 12, 0, // U+00C0
+    23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 39, 27, 39, 39, 25, 27, 25, 25, 25, 25, 25, 0, 25, 30, 30, 30, 30, 34, 24, 34, // U+00E0
+    11, 23, 11, 23, 11, 23, 13, 25, 13, 25, 13, 25, 13, 25, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25, 13, 25, 13, 25, // U+0100
+    13, 25, 13, 25, 12, 24, 12, 24, 12, 40, 12, 39, 12, 39, 12, 27, 12, 0, 12, 27, 14, 0, 12, 24, 27, 12, 24, 12, 24, 12, 24, 12, // U+0120
+    24, 12, 24, 12, 27, 12, 27, 12, 27, 0, 12, 27, 13, 25, 13, 25, 13, 25, 13, 25, 12, 27, 12, 27, 12, 0, 15, 28, 15, 28, 15, 28, // U+0140
+    15, 28, 16, 29, 16, 29, 16, 29, 17, 30, 17, 30, 17, 30, 17, 30, 17, 30, 17, 30, 19, 32, 21, 34, 21, 22, 35, 22, 35, 22, 35, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    13, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 23, 38, 23, 13, 25, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 28, 16, 29, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0400
+    0, 0, 41, 42, 0, 41, 0, 43, 0, 0, 41, 0, 0, 0, 0, 44, 0, 45, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0420
+    0, 0, 0, 47, 0, 46, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 47, 0, // U+0440
+    51, 0, 16, 0, 0, 0, 52, 0, 0, 0, 53, 0, 0, 0, 54, 0, 0, 0, 51, 55, 0, 0, 0, 0, 51, 55, 51, 55, 51, 25, 51, 0, // U+0460
+    51, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 54, 56, 0, 0, 0, 0, 0, 0, // U+0480
+    57, 58, 0, 0, 0, 0, 0, 0, 51, 55, 51, 55, 57, 58, 0, 0, 0, 0, 53, 0, 57, 58, 59, 60, 43, 48, 0, 0, 0, 0, 0, 0, // U+04A0
+    0, 41, 46, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 0, 0, 0, 52, 0, 52, 0, 38, 61, 0, 55, 51, 61, 51, 0, 41, 46, 0, 0, // U+04C0
+    54, 35, 0, 0, 0, 0, 51, 55, 51, 55, 51, 55, 0, 0, 42, 62, 42, 62, 42, 62, 43, 48, 0, 0, 0, 0, 0, 0, 53, 0, 53, 0, // U+04E0
+};
+
+static const uint32_t notoserif_14_boldLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData notoserif_14_bold = {
     notoserif_14_boldBitmaps,
     notoserif_14_boldGlyphs,
@@ -4240,4 +4334,7 @@ static const EpdFontData notoserif_14_bold = {
     65,
     notoserif_14_boldLigaturePairs,
     5,
+    notoserif_14_boldKernLeftDirect,
+    notoserif_14_boldKernRightDirect,
+    notoserif_14_boldLigatureStartBits,
 };
@@ -4739,6 +4739,100 @@ static const EpdLigaturePair notoserif_14_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notoserif_14_italicKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 4, 0, 5, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0020
+    0, 7, 8, 9, 10, 11, 12, 13, 0, 0, 14, 15, 16, 0, 17, 10, 18, 10, 19, 20, 21, 22, 23, 24, 25, 26, 0, 3, 0, 0, 0, 27, // U+0040
+    0, 28, 29, 30, 0, 30, 31, 0, 28, 0, 0, 32, 0, 28, 28, 29, 29, 33, 34, 35, 0, 0, 36, 37, 0, 38, 39, 3, 0, 0, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, // U+00A0
+    43, 43, 43, 43, 43, 43, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0, 10, 17, 10, 10, 10, 10, 10, 0, 10, 22, 22, 22, 22, 26, 10, 35, // U+00C0
+    28, 28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 29, 28, 29, 29, 29, 29, 29, 0, 29, 28, 28, 28, 28, 38, 29, 38, // U+00E0
+    7, 28, 43, 28, 43, 28, 9, 30, 9, 30, 9, 30, 9, 30, 10, 44, 10, 0, 11, 30, 11, 30, 11, 30, 11, 30, 11, 30, 13, 0, 13, 0, // U+0100
+    13, 0, 13, 0, 0, 28, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 15, 32, 32, 16, 0, 16, 0, 45, 44, 0, // U+0120
+    0, 16, 0, 17, 28, 17, 28, 17, 28, 28, 14, 28, 10, 29, 10, 29, 10, 29, 11, 30, 19, 34, 19, 34, 19, 34, 20, 35, 20, 35, 20, 35, // U+0140
+    20, 35, 21, 0, 21, 0, 21, 0, 22, 28, 22, 28, 22, 28, 22, 28, 22, 28, 22, 28, 24, 37, 26, 38, 26, 0, 39, 0, 39, 0, 39, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 28, 11, 30, 10, 29, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 35, 21, 0, 0, 0, 0, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    50, 50, 51, 52, 53, 54, 55, 55, 56, 57, 57, 58, 59, 55, 60, 55, 61, 62, 63, 52, 64, 50, 59, 63, 55, 55, 59, 55, 55, 55, 65, 55, // U+0400
+    66, 53, 52, 60, 67, 68, 64, 55, 55, 64, 57, 55, 57, 65, 65, 55, 69, 70, 71, 72, 73, 74, 75, 71, 69, 69, 76, 69, 69, 69, 77, 78, // U+0420
+    77, 79, 78, 80, 77, 76, 81, 69, 69, 81, 82, 69, 82, 77, 77, 69, 74, 74, 83, 72, 79, 84, 69, 85, 86, 82, 82, 78, 76, 69, 80, 69, // U+0440
+    65, 87, 57, 0, 53, 72, 61, 0, 61, 0, 88, 0, 88, 0, 63, 72, 89, 90, 65, 71, 60, 90, 60, 90, 91, 80, 65, 71, 65, 71, 65, 87, // U+0460
+    53, 72, 0, 0, 0, 0, 0, 0, 0, 0, 64, 81, 57, 0, 66, 71, 92, 93, 92, 93, 58, 0, 59, 79, 63, 72, 59, 79, 59, 79, 59, 79, // U+0480
+    59, 79, 64, 81, 92, 0, 58, 0, 0, 0, 53, 72, 92, 81, 89, 90, 89, 90, 68, 76, 64, 81, 64, 81, 55, 69, 58, 82, 94, 74, 94, 74, // U+04A0
+    0, 59, 79, 58, 0, 64, 81, 56, 0, 64, 81, 0, 81, 64, 81, 0, 61, 81, 61, 81, 50, 74, 50, 74, 65, 71, 65, 71, 59, 79, 63, 71, // U+04C0
+    63, 95, 55, 81, 55, 81, 65, 71, 65, 71, 65, 71, 65, 77, 60, 80, 60, 80, 60, 80, 55, 69, 92, 93, 55, 69, 92, 93, 68, 76, 68, 96, // U+04E0
+};
+
+static const uint8_t notoserif_14_italicKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 2, 1, 0, 3, 4, 0, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 9, // U+0020
+    0, 10, 11, 12, 11, 11, 11, 12, 11, 11, 11, 11, 11, 11, 11, 12, 11, 12, 11, 13, 14, 15, 16, 17, 18, 19, 20, 0, 21, 3, 0, 22, // U+0040
+    0, 23, 24, 25, 25, 25, 0, 26, 24, 27, 0, 24, 28, 29, 29, 25, 29, 25, 29, 30, 31, 32, 33, 34, 35, 36, 37, 0, 0, 3, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, // U+00A0
+    10, 10, 10, 10, 10, 10, 40, 12, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 0, 12, 15, 15, 15, 15, 19, 11, 0, // U+00C0
+    23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 27, 27, 27, 27, 25, 29, 25, 25, 25, 25, 25, 0, 25, 32, 32, 32, 32, 36, 24, 36, // U+00E0
+    10, 23, 10, 23, 10, 23, 12, 25, 12, 25, 12, 25, 12, 25, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25, 12, 25, 12, 25, // U+0100
+    12, 25, 12, 25, 11, 24, 11, 24, 11, 27, 11, 27, 11, 27, 11, 27, 11, 0, 11, 27, 11, 0, 11, 24, 29, 11, 28, 11, 28, 11, 28, 11, // U+0120
+    28, 11, 28, 11, 29, 11, 29, 11, 29, 41, 11, 29, 12, 25, 12, 25, 12, 25, 12, 25, 11, 29, 11, 29, 11, 29, 13, 30, 13, 30, 13, 30, // U+0140
+    13, 30, 0, 31, 0, 31, 0, 31, 15, 32, 15, 32, 15, 32, 15, 32, 15, 32, 15, 32, 17, 34, 19, 36, 19, 20, 37, 20, 37, 20, 37, 0, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    12, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 23, 40, 23, 12, 25, // U+01E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 30, 0, 31, 0, 0, 11, 0, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    42, 42, 43, 42, 44, 45, 42, 42, 46, 47, 42, 43, 42, 42, 48, 42, 49, 42, 42, 42, 50, 42, 51, 52, 42, 42, 42, 47, 42, 42, 44, 42, // U+0400
+    42, 44, 43, 48, 53, 54, 42, 55, 42, 42, 43, 42, 42, 52, 42, 56, 57, 58, 57, 59, 60, 57, 61, 62, 63, 63, 64, 65, 65, 64, 57, 64, // U+0420
+    66, 57, 64, 67, 57, 68, 63, 69, 63, 63, 70, 63, 63, 61, 64, 71, 57, 57, 72, 59, 57, 73, 74, 75, 76, 65, 64, 72, 64, 63, 67, 63, // U+0440
+    77, 78, 0, 0, 0, 0, 49, 0, 0, 0, 79, 0, 0, 0, 52, 0, 80, 63, 77, 81, 80, 82, 80, 82, 77, 81, 77, 81, 77, 81, 77, 78, // U+0460
+    77, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 51, 61, 52, 61, 0, 0, 0, 0, 0, 72, // U+0480
+    83, 70, 0, 0, 0, 0, 0, 0, 77, 81, 77, 81, 83, 0, 80, 82, 80, 82, 54, 68, 83, 70, 55, 69, 55, 69, 0, 0, 0, 0, 0, 0, // U+04A0
+    0, 51, 61, 0, 0, 50, 65, 0, 0, 0, 0, 55, 69, 0, 84, 0, 49, 81, 49, 81, 85, 81, 0, 81, 0, 81, 0, 81, 51, 61, 52, 61, // U+04C0
+    52, 0, 42, 63, 42, 63, 77, 81, 77, 81, 77, 81, 52, 61, 48, 67, 48, 67, 48, 67, 55, 69, 0, 0, 42, 63, 0, 0, 54, 68, 54, 0, // U+04E0
+};
+
+static const uint32_t notoserif_14_italicLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData notoserif_14_italic = {
     notoserif_14_italicBitmaps,
     notoserif_14_italicGlyphs,
@@ -4760,4 +4854,7 @@ static const EpdFontData notoserif_14_italic = {
     90,
     notoserif_14_italicLigaturePairs,
     5,
+    notoserif_14_italicKernLeftDirect,
+    notoserif_14_italicKernRightDirect,
+    notoserif_14_italicLigatureStartBits,
 };
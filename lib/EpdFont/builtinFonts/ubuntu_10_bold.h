@@ -3081,6 +3081,100 @@ static const EpdLigaturePair ubuntu_10_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_10_boldKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5, 0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, // U+0020
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 18, 19, 20, 21, 22, 18, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 0, 0, // U+0040
+    0, 38, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47, 48, 49, 49, 50, 39, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 62, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 66, // U+00A0
+    11, 11, 11, 11, 11, 11, 15, 13, 15, 15, 15, 15, 18, 18, 18, 18, 14, 18, 23, 23, 23, 23, 23, 0, 23, 29, 29, 29, 29, 33, 67, 68, // U+00C0
+    38, 38, 38, 38, 38, 38, 0, 40, 0, 0, 0, 0, 45, 45, 45, 45, 69, 49, 50, 50, 50, 50, 50, 0, 50, 55, 55, 55, 55, 59, 70, 59, // U+00E0
+    11, 38, 11, 38, 11, 38, 13, 40, 13, 40, 13, 40, 13, 40, 14, 71, 14, 41, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 17, 43, 17, 43, // U+0100
+    17, 43, 17, 43, 18, 44, 18, 44, 18, 45, 18, 45, 18, 45, 18, 45, 18, 45, 19, 46, 19, 46, 20, 47, 47, 21, 48, 21, 48, 21, 71, 21, // U+0120
+    48, 21, 48, 18, 49, 18, 49, 18, 49, 49, 72, 73, 23, 50, 23, 50, 23, 50, 15, 0, 26, 52, 26, 52, 26, 52, 27, 53, 27, 53, 27, 53, // U+0140
+    27, 53, 28, 54, 28, 54, 28, 54, 29, 55, 29, 55, 29, 55, 29, 55, 29, 55, 29, 55, 31, 57, 33, 59, 33, 34, 60, 34, 60, 34, 60, 42, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 34, 60, 60, 19, 46, 46, 19, 46, 46, 11, 38, 18, 45, 23, 50, 29, 55, 29, 55, 29, 55, 29, 55, 29, 55, 50, 11, 38, // U+01C0
+    11, 38, 15, 0, 17, 43, 17, 43, 20, 47, 23, 50, 23, 50, 75, 76, 46, 34, 60, 60, 17, 43, 55, 77, 18, 49, 11, 38, 15, 0, 23, 50, // U+01E0
+    11, 38, 11, 38, 15, 0, 15, 0, 18, 45, 18, 45, 23, 50, 23, 50, 26, 52, 26, 52, 29, 55, 29, 55, 27, 53, 28, 54, 78, 0, 18, 44, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    79, 79, 80, 81, 82, 83, 18, 18, 84, 85, 85, 86, 87, 18, 88, 18, 89, 80, 90, 81, 91, 79, 92, 93, 18, 18, 87, 0, 94, 18, 95, 18, // U+0400
+    96, 82, 97, 88, 98, 99, 91, 0, 18, 91, 85, 18, 85, 100, 95, 0, 101, 102, 103, 104, 105, 106, 107, 108, 0, 0, 109, 110, 111, 112, 113, 112, // U+0420
+    114, 115, 116, 117, 118, 119, 105, 112, 112, 105, 120, 112, 120, 121, 122, 123, 106, 106, 124, 104, 125, 126, 127, 127, 128, 120, 120, 129, 109, 0, 117, 130, // U+0440
+    0, 0, 80, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 113, 132, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0460
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 105, 85, 120, 0, 114, 81, 104, 81, 104, 80, 134, 92, 107, 93, 108, 87, 109, 87, 109, 87, 109, // U+0480
+    87, 109, 91, 105, 97, 104, 85, 135, 136, 137, 82, 115, 97, 116, 138, 139, 138, 139, 99, 119, 91, 105, 91, 105, 0, 0, 140, 141, 142, 0, 142, 0, // U+04A0
+    18, 92, 107, 143, 144, 0, 105, 84, 145, 91, 105, 0, 112, 91, 105, 18, 89, 101, 89, 101, 146, 147, 79, 106, 148, 0, 148, 0, 92, 107, 93, 108, // U+04C0
+    149, 150, 18, 0, 18, 0, 95, 113, 95, 113, 95, 113, 100, 108, 88, 117, 88, 117, 88, 117, 0, 0, 81, 104, 18, 112, 0, 0, 0, 0, 0, 0, // U+04E0
+};
+
+static const uint8_t ubuntu_10_boldKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 1, 2, 0, 0, 0, 3, 2, 4, 5, 6, 0, 7, 8, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0, 0, 0, 11, // U+0020
+    12, 13, 14, 15, 14, 14, 14, 16, 14, 14, 17, 14, 14, 18, 14, 19, 14, 19, 14, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 0, 0, // U+0040
+    0, 31, 32, 33, 34, 33, 35, 33, 36, 37, 38, 36, 36, 39, 39, 34, 39, 33, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, // U+00A0
+    13, 13, 13, 13, 13, 13, 52, 15, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 26, 0, 53, // U+00C0
+    31, 31, 31, 31, 54, 31, 31, 33, 33, 33, 33, 33, 55, 37, 56, 57, 58, 39, 34, 34, 34, 34, 34, 0, 34, 42, 42, 42, 42, 46, 0, 46, // U+00E0
+    13, 31, 13, 31, 13, 31, 15, 33, 15, 33, 15, 33, 15, 33, 14, 34, 0, 34, 14, 33, 14, 33, 14, 33, 14, 33, 14, 33, 16, 33, 16, 33, // U+0100
+    16, 33, 16, 33, 14, 36, 14, 36, 14, 59, 14, 60, 14, 61, 14, 37, 14, 37, 14, 37, 17, 38, 14, 36, 0, 14, 36, 14, 36, 14, 36, 14, // U+0120
+    36, 14, 36, 14, 39, 14, 39, 14, 39, 39, 62, 63, 19, 34, 19, 34, 19, 34, 19, 34, 14, 39, 14, 39, 14, 39, 20, 40, 20, 40, 20, 40, // U+0140
+    20, 40, 21, 41, 21, 41, 21, 41, 22, 42, 22, 42, 22, 42, 22, 42, 22, 42, 22, 42, 24, 44, 26, 46, 26, 27, 47, 27, 47, 27, 47, 35, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    19, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 14, 14, 34, 14, 14, 36, 14, 14, 39, 13, 31, 14, 37, 19, 34, 22, 42, 22, 42, 22, 42, 22, 42, 22, 42, 64, 13, 31, // U+01C0
+    13, 31, 52, 31, 16, 33, 16, 33, 14, 36, 19, 34, 19, 34, 65, 0, 38, 14, 14, 34, 16, 33, 0, 0, 14, 39, 13, 31, 52, 31, 19, 34, // U+01E0
+    13, 31, 13, 31, 14, 33, 14, 33, 14, 37, 14, 37, 19, 34, 19, 34, 14, 39, 14, 39, 22, 42, 22, 42, 20, 40, 21, 41, 66, 67, 14, 36, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 68, 0, 69, 70, 0, 0, 71, 72, 0, 68, 0, 0, 73, 0, 74, 0, 0, 0, 75, 0, 76, 77, 0, 0, 0, 72, 78, 0, 79, 0, // U+0400
+    0, 69, 68, 73, 80, 81, 0, 82, 0, 0, 0, 0, 0, 83, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 88, 88, 88, 93, 94, 88, 95, 88, // U+0420
+    96, 97, 98, 99, 100, 101, 88, 102, 88, 103, 104, 88, 88, 105, 106, 107, 90, 90, 108, 88, 109, 110, 111, 112, 113, 93, 88, 114, 88, 88, 99, 103, // U+0440
+    0, 0, 68, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 95, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0460
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 0, 116, 0, 96, 0, 88, 0, 88, 0, 88, 76, 91, 77, 92, 0, 88, 0, 88, 0, 88, // U+0480
+    0, 88, 0, 88, 0, 88, 0, 88, 117, 118, 69, 97, 68, 98, 119, 120, 119, 120, 81, 101, 68, 98, 82, 102, 82, 102, 0, 121, 122, 123, 122, 123, // U+04A0
+    0, 76, 91, 0, 88, 72, 93, 0, 88, 0, 88, 82, 102, 0, 94, 0, 74, 85, 74, 85, 124, 125, 0, 90, 126, 127, 126, 127, 76, 91, 77, 92, // U+04C0
+    128, 129, 0, 88, 0, 88, 79, 95, 79, 95, 79, 95, 83, 92, 73, 99, 73, 99, 73, 99, 82, 102, 0, 88, 0, 88, 0, 0, 0, 0, 0, 0, // U+04E0
+};
+
+static const uint32_t ubuntu_10_boldLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
@@ -3102,4 +3196,7 @@ static const EpdFontData ubuntu_10_bold = {
     132,
     ubuntu_10_boldLigaturePairs,
     5,
+    ubuntu_10_boldKernLeftDirect,
+    ubuntu_10_boldKernRightDirect,
+    ubuntu_10_boldLigatureStartBits,
 };
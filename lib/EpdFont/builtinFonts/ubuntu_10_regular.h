@@ -2757,6 +2757,100 @@ static const EpdLigaturePair ubuntu_10_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_10_regularKernLeftDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4, 0, 5, 6, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, // U+0020
+    9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17, 18, 19, 20, 0, 21, 22, 23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 0, 33, 0, 0, // U+0040
+    0, 34, 35, 36, 0, 0, 37, 0, 38, 0, 39, 40, 0, 41, 41, 42, 43, 44, 45, 0, 46, 0, 47, 48, 49, 0, 50, 51, 0, 52, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 56, // U+00A0
+    10, 10, 10, 10, 10, 10, 14, 12, 14, 14, 14, 14, 0, 0, 0, 0, 13, 0, 21, 21, 21, 21, 21, 0, 21, 26, 26, 26, 26, 30, 57, 58, // U+00C0
+    34, 34, 34, 34, 34, 34, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 59, 41, 42, 42, 42, 42, 42, 0, 42, 0, 0, 0, 0, 0, 60, 0, // U+00E0
+    10, 34, 10, 34, 10, 34, 12, 36, 12, 36, 12, 36, 12, 36, 13, 61, 13, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 16, 0, 16, 0, // U+0100
+    16, 0, 16, 0, 0, 38, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 39, 17, 39, 18, 40, 40, 19, 0, 19, 0, 19, 61, 19, // U+0120
+    0, 19, 0, 0, 41, 0, 41, 0, 41, 41, 62, 63, 21, 42, 21, 42, 21, 42, 14, 0, 24, 45, 24, 45, 24, 45, 0, 0, 0, 0, 0, 0, // U+0140
+    0, 0, 25, 46, 25, 46, 25, 46, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 28, 48, 30, 0, 30, 31, 50, 31, 50, 31, 50, 37, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 31, 50, 50, 17, 39, 39, 17, 39, 39, 10, 34, 0, 0, 21, 42, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 42, 10, 34, // U+01C0
+    10, 34, 14, 0, 16, 0, 16, 0, 18, 40, 21, 42, 21, 42, 64, 0, 39, 31, 50, 50, 16, 0, 0, 65, 0, 41, 10, 34, 14, 0, 21, 42, // U+01E0
+    10, 34, 10, 34, 14, 0, 14, 0, 0, 0, 0, 0, 21, 42, 21, 42, 24, 45, 24, 45, 26, 0, 26, 0, 0, 0, 25, 46, 66, 0, 0, 38, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    67, 67, 68, 69, 70, 71, 0, 0, 0, 0, 0, 72, 73, 0, 74, 0, 75, 68, 76, 69, 77, 67, 0, 78, 0, 0, 73, 0, 79, 0, 80, 0, // U+0400
+    81, 70, 82, 74, 83, 84, 85, 0, 0, 85, 0, 0, 0, 86, 80, 0, 87, 88, 89, 90, 91, 92, 93, 94, 0, 0, 95, 0, 0, 0, 96, 0, // U+0420
+    97, 98, 99, 100, 101, 102, 103, 0, 0, 103, 104, 0, 104, 105, 106, 0, 92, 92, 107, 90, 108, 109, 0, 0, 0, 104, 104, 110, 95, 0, 100, 0, // U+0440
+    0, 0, 68, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 96, 112, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0460
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 103, 0, 104, 0, 97, 69, 90, 69, 90, 68, 114, 0, 93, 78, 94, 73, 95, 73, 95, 73, 95, // U+0480
+    73, 95, 85, 103, 82, 90, 0, 115, 116, 117, 70, 98, 82, 99, 118, 119, 118, 119, 84, 102, 85, 103, 85, 103, 0, 0, 120, 121, 122, 123, 122, 123, // U+04A0
+    0, 0, 93, 0, 124, 0, 103, 0, 125, 85, 103, 0, 0, 85, 103, 0, 75, 87, 75, 87, 0, 126, 67, 92, 127, 128, 127, 128, 0, 93, 78, 94, // U+04C0
+    129, 130, 0, 0, 0, 0, 80, 96, 80, 96, 80, 96, 86, 94, 74, 100, 74, 100, 74, 100, 0, 0, 69, 90, 0, 0, 0, 0, 0, 0, 0, 0, // U+04E0
+};
+
+static const uint8_t ubuntu_10_regularKernRightDirect[1280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0000
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10, // U+0020
+    11, 12, 0, 13, 0, 0, 0, 14, 0, 0, 15, 0, 0, 16, 0, 17, 0, 18, 0, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 0, 0, // U+0040
+    0, 30, 31, 32, 33, 34, 35, 36, 31, 37, 38, 31, 39, 40, 40, 41, 40, 42, 40, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0, 52, 0, 0, // U+0060
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0080
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, // U+00A0
+    12, 12, 12, 12, 12, 12, 55, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 0, 17, 21, 21, 21, 21, 25, 0, 56, // U+00C0
+    30, 30, 30, 30, 30, 30, 30, 32, 34, 34, 34, 34, 57, 37, 58, 59, 60, 40, 41, 41, 41, 41, 41, 0, 41, 45, 45, 45, 45, 49, 56, 49, // U+00E0
+    12, 30, 12, 30, 12, 30, 13, 32, 13, 32, 13, 32, 13, 32, 0, 33, 0, 33, 0, 34, 0, 34, 0, 34, 0, 34, 0, 34, 14, 36, 14, 36, // U+0100
+    14, 36, 14, 36, 0, 31, 0, 31, 0, 61, 0, 62, 0, 63, 0, 37, 0, 37, 0, 37, 15, 38, 0, 31, 0, 0, 39, 0, 39, 0, 39, 0, // U+0120
+    39, 0, 39, 0, 40, 0, 40, 0, 40, 40, 64, 65, 17, 41, 17, 41, 17, 41, 17, 41, 0, 40, 0, 40, 0, 40, 19, 43, 19, 43, 19, 43, // U+0140
+    19, 43, 20, 44, 20, 44, 20, 44, 21, 45, 21, 45, 21, 45, 21, 45, 21, 45, 21, 45, 23, 47, 25, 49, 25, 26, 50, 26, 50, 26, 50, 35, // U+0160
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0180
+    17, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+01A0
+    0, 0, 0, 0, 0, 0, 33, 0, 0, 39, 0, 0, 40, 12, 30, 0, 37, 17, 41, 21, 45, 21, 45, 21, 45, 21, 45, 21, 45, 66, 12, 30, // U+01C0
+    12, 30, 55, 30, 14, 36, 14, 36, 0, 31, 17, 41, 17, 41, 67, 68, 38, 0, 0, 33, 14, 36, 0, 56, 0, 40, 12, 30, 55, 30, 17, 41, // U+01E0
+    12, 30, 12, 30, 0, 34, 0, 34, 0, 37, 0, 37, 17, 41, 17, 41, 0, 40, 0, 40, 21, 45, 21, 45, 19, 43, 20, 44, 69, 70, 0, 31, // U+0200
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0220
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0240
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0260
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0280
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+02E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0300
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0320
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0340
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0360
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0380
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+03E0
+    0, 0, 71, 0, 72, 73, 0, 0, 74, 75, 0, 71, 0, 0, 76, 0, 77, 0, 0, 0, 78, 0, 79, 80, 0, 0, 0, 75, 81, 0, 82, 0, // U+0400
+    0, 72, 71, 76, 83, 84, 0, 85, 0, 0, 71, 0, 0, 86, 0, 87, 88, 89, 90, 91, 92, 93, 94, 95, 91, 91, 91, 96, 97, 91, 98, 91, // U+0420
+    99, 100, 101, 102, 103, 104, 91, 105, 91, 106, 107, 91, 91, 108, 90, 109, 93, 93, 110, 91, 111, 112, 113, 114, 115, 96, 91, 116, 91, 91, 102, 106, // U+0440
+    0, 0, 71, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 98, 76, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // U+0460
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 118, 0, 99, 0, 91, 0, 91, 0, 91, 79, 94, 80, 95, 0, 91, 0, 91, 0, 91, // U+0480
+    0, 91, 0, 91, 0, 91, 0, 91, 119, 120, 72, 100, 71, 101, 121, 122, 121, 122, 84, 104, 71, 101, 85, 105, 85, 105, 0, 123, 124, 125, 124, 125, // U+04A0
+    0, 79, 94, 0, 91, 75, 96, 0, 91, 0, 91, 85, 105, 0, 97, 0, 77, 88, 77, 88, 0, 126, 0, 93, 127, 128, 127, 128, 79, 94, 80, 129, // U+04C0
+    130, 131, 0, 91, 0, 91, 82, 98, 82, 98, 82, 98, 86, 132, 76, 102, 76, 102, 76, 102, 85, 105, 0, 91, 0, 91, 0, 0, 0, 0, 0, 0, // U+04E0
+};
+
+static const uint32_t ubuntu_10_regularLigatureStartBits[40] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
 static const EpdFontData ubuntu_10_regular = {
     ubuntu_10_regularBitmaps,
     ubuntu_10_regularGlyphs,
@@ -2778,4 +2872,7 @@ static const EpdFontData ubuntu_10_regular = {
     135,
     ubuntu_10_regularLigaturePairs,
     5,
+    ubuntu_10_regularKernLeftDirect,
+    ubuntu_10_regularKernRightDirect,
+    ubuntu_10_regularLigatureStartBits,
 };
@@ -201,6 +201,13 @@ def build_family(
     if family.get("force_autohint", False):
         cmd.append("--force-autohint")
 
+    # Hot glyph set: corpus paths are relative to lib/EpdFont, like committed fonts
+    hot_corpus = family.get("hot_corpus", [])
+    for corpus in [hot_corpus] if isinstance(hot_corpus, str) else hot_corpus:
+        cmd.extend(["--hot-corpus", str(EPDFONTS_DIR / corpus)])
+    if "hot_glyphs" in family:
+        cmd.extend(["--hot-glyphs", str(family["hot_glyphs"])])
+
     # Run fontconvert_sdcard.py
     start = time.monotonic()
     try:
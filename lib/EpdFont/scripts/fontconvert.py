@@ -986,6 +986,37 @@ if ligature_pairs:
         print(f"    {{ 0x{packed_pair:08X}, 0x{lig_cp:04X} }}, // {cp_label(packed_pair >> 16)} {cp_label(packed_pair & 0xFFFF)} -> {cp_label(lig_cp)}")
     print("};\n")
 
+# Direct-indexed lookups for codepoints below DIRECT_LOOKUP_LIMIT (Latin through
+# Cyrillic): a kern class per codepoint and a bit per codepoint that starts a
+# ligature, so EpdFont skips the binary searches on the hot path. Must match
+# EPD_DIRECT_LOOKUP_LIMIT in EpdFontData.h.
+DIRECT_LOOKUP_LIMIT = 0x500
+
+def print_direct_classes(name, class_entries):
+    classes = [0] * DIRECT_LOOKUP_LIMIT
+    for cp, cls in class_entries:
+        if cp < DIRECT_LOOKUP_LIMIT:
+            classes[cp] = cls
+    print(f"static const uint8_t {name}[{DIRECT_LOOKUP_LIMIT}] = {{")
+    for row in range(0, DIRECT_LOOKUP_LIMIT, 32):
+        print("    " + " ".join(f"{v}," for v in classes[row:row + 32]) + f" // U+{row:04X}")
+    print("};\n")
+
+if kern_map:
+    print_direct_classes(f"{font_name}KernLeftDirect", kern_left_classes)
+    print_direct_classes(f"{font_name}KernRightDirect", kern_right_classes)
+
+if ligature_pairs:
+    ligature_start_bits = [0] * (DIRECT_LOOKUP_LIMIT // 32)
+    for packed_pair, _ in ligature_pairs:
+        left_cp = packed_pair >> 16
+        if left_cp < DIRECT_LOOKUP_LIMIT:
+            ligature_start_bits[left_cp // 32] |= 1 << (left_cp % 32)
+    print(f"static const uint32_t {font_name}LigatureStartBits[{DIRECT_LOOKUP_LIMIT // 32}] = {{")
+    for row in range(0, len(ligature_start_bits), 8):
+        print("    " + " ".join(f"0x{v:08X}," for v in ligature_start_bits[row:row + 8]))
+    print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -1025,4 +1056,14 @@ if ligature_pairs:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+if kern_map:
+    print(f"    {font_name}KernLeftDirect,")
+    print(f"    {font_name}KernRightDirect,")
+else:
+    print(f"    nullptr,")
+    print(f"    nullptr,")
+if ligature_pairs:
+    print(f"    {font_name}LigatureStartBits,")
+else:
+    print(f"    nullptr,")
 print("};")
@@ -20,6 +20,12 @@ Usage:
       NotoSansCJKsc-Regular.otf \\
       --output-dir NotoSansCJK/
 
+    # Rank the hot set by a corpus instead of the built-in letter frequencies
+    python fontconvert_sdcard.py \\
+      --intervals reading --size 14 \\
+      --hot-corpus books/*.txt \\
+      NotoSerif-Regular.ttf -o NotoSerif_14.cpfont
+
 """
 
 from __future__ import annotations
@@ -30,7 +36,7 @@ import os
 import re
 import math
 import argparse
-from collections import namedtuple
+from collections import Counter, namedtuple
 
 from cpfont_version import CPFONT_VERSION
 
@@ -123,6 +129,73 @@ def resolve_intervals(preset_str):
     return merged
 
 
+# --- Hot set (v5) ---
+
+# Built-in frequency rankings, most frequent first, used when no --hot-corpus is
+# given: letters by their frequency in running prose, then the punctuation and
+# digits a page of fiction uses. Scripts are ranked separately so a Cyrillic
+# book gets Cyrillic letters in the hot block of a font that also covers Latin.
+HOT_RANKINGS = {
+    "latin": " etaoinshrdlcumwfgypbvk,.TI'\"AHSWMBCx-jqz?!;:DNPLEORFGYJ0123456789KUV()XQZ’“”—",
+    "greek": "αοιετνσρκπμυληςωδγχθ"
+             "φβζξψάέίόήύώΑΤΚΕΠ"
+             "ΟΣΜΔΝΗΘΙΛΓΦΧΒΩΥΡΖ",
+    "cyrillic": "оеаинтсрвлкмдпуя"
+                "ыьгзбчйхжшюцщэфъ"
+                "ёОВНПСТМКИАДРЕБЗ"
+                "ГЛЯХУЧЖШЭФЦЮЩЁ"
+                "іїєґІЇЄҐ",
+}
+DEFAULT_HOT_GLYPHS = 96  # per script
+MAX_HOT_GLYPHS = 1024    # must match SdCardFont's load-time limit
+
+# On-disk hot index entry: codepoint(4) + bitmap length(2) + reserved(2)
+HOT_INDEX_FORMAT = "<IH2x"
+assert struct.calcsize(HOT_INDEX_FORMAT) == 8
+
+
+def hot_script(cp):
+    """Script group a codepoint is ranked in; everything that isn't Greek or
+    Cyrillic (punctuation, digits, symbols) ranks with Latin."""
+    if 0x0370 <= cp <= 0x03FF or 0x1F00 <= cp <= 0x1FFF:
+        return "greek"
+    if 0x0400 <= cp <= 0x052F:
+        return "cyrillic"
+    return "latin"
+
+
+def load_hot_rankings(corpus_paths):
+    """Rank the codepoints of the given UTF-8 text files per script by frequency.
+    Without a corpus the built-in HOT_RANKINGS apply."""
+    if not corpus_paths:
+        return {script: [ord(c) for c in ranking] for script, ranking in HOT_RANKINGS.items()}
+    counts = Counter()
+    for path in corpus_paths:
+        with open(path, encoding="utf-8", errors="ignore") as f:
+            for line in f:
+                # Line breaks and tabs lay out as spaces
+                counts.update(ord(" ") if c.isspace() else ord(c) for c in line)
+    rankings = {}
+    for cp, _ in counts.most_common():
+        rankings.setdefault(hot_script(cp), []).append(cp)
+    return rankings
+
+
+def select_hot_glyphs(rankings, codepoints, per_script):
+    """Hot set in rank order: the replacement glyph, then the top `per_script`
+    covered codepoints of each script (Latin first)."""
+    if per_script <= 0:
+        return []
+    hot = [0xFFFD] if 0xFFFD in codepoints else []
+    for script in ["latin"] + sorted(s for s in rankings if s != "latin"):
+        ranked = [cp for cp in rankings.get(script, []) if cp in codepoints and cp not in hot]
+        hot += ranked[:per_script]
+    if len(hot) > MAX_HOT_GLYPHS:
+        print(f"  WARNING: {len(hot)} hot glyphs exceeds {MAX_HOT_GLYPHS}, truncating", file=sys.stderr)
+        hot = hot[:MAX_HOT_GLYPHS]
+    return hot
+
+
 GlyphProps = namedtuple("GlyphProps", [
     "width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"
 ])
@@ -711,21 +784,46 @@ GLYPH_STRUCT_FORMAT = "<BBHhhH2xI"
 assert struct.calcsize(GLYPH_STRUCT_FORMAT) == 16
 
 
-def pack_style_sections(sd):
+def pack_glyph(glyph, data_offset):
+    return struct.pack(GLYPH_STRUCT_FORMAT,
+                       glyph.width, glyph.height, glyph.advance_x,
+                       glyph.left, glyph.top,
+                       glyph.data_length, data_offset)
+
+
+def pack_style_sections(sd, hot_cps):
     """Pack one StyleRasterData into binary section bytearrays.
-    Returns (intervals_data, glyphs_data, kern_left, kern_right, kern_matrix, ligatures, bitmaps)."""
+
+    The bitmap section starts with the hot block: for each hot codepoint in rank
+    order, its glyph record followed by its bitmap, so a page of hot glyphs is
+    one contiguous read. The main glyph table points hot glyphs at the bitmap
+    inside the hot block; the remaining bitmaps follow in codepoint order.
+
+    Returns (intervals_data, hot_index, glyphs_data, kern_left, kern_right, kern_matrix, ligatures, bitmaps)."""
     intervals_data = bytearray()
     offset = 0
     for i_start, i_end in sd.intervals:
         intervals_data += struct.pack("<III", i_start, i_end, offset)
         offset += i_end - i_start + 1
 
+    glyphs_by_cp = {glyph.code_point: (glyph, packed) for glyph, packed in sd.all_glyphs}
+    hot_index = bytearray()
+    bitmap_data = bytearray()
+    hot_offsets = {}  # codepoint -> bitmap offset inside the hot block
+    for cp in hot_cps:
+        glyph, packed = glyphs_by_cp[cp]
+        hot_index += struct.pack(HOT_INDEX_FORMAT, cp, glyph.data_length)
+        hot_offsets[cp] = len(bitmap_data) + struct.calcsize(GLYPH_STRUCT_FORMAT)
+        bitmap_data += pack_glyph(glyph, hot_offsets[cp])
+        bitmap_data += packed
+
     glyphs_data = bytearray()
     for glyph, packed in sd.all_glyphs:
-        glyphs_data += struct.pack(GLYPH_STRUCT_FORMAT,
-                                   glyph.width, glyph.height, glyph.advance_x,
-                                   glyph.left, glyph.top,
-                                   glyph.data_length, glyph.data_offset)
+        if glyph.code_point in hot_offsets:
+            glyphs_data += pack_glyph(glyph, hot_offsets[glyph.code_point])
+        else:
+            glyphs_data += pack_glyph(glyph, len(bitmap_data))
+            bitmap_data += packed
 
     kern_left_data = bytearray()
     for cp, cls in sd.kern_left_classes:
@@ -743,12 +841,10 @@ def pack_style_sections(sd):
     for packed_pair, lig_cp in sd.ligature_pairs:
         ligature_data += struct.pack("<II", packed_pair, lig_cp)
 
-    bitmap_data = bytearray()
-    for glyph, packed in sd.all_glyphs:
-        bitmap_data += packed
-    assert len(bitmap_data) == sd.total_bitmap_size
+    hot_records_size = len(hot_cps) * struct.calcsize(GLYPH_STRUCT_FORMAT)
+    assert len(bitmap_data) == sd.total_bitmap_size + hot_records_size
 
-    return (intervals_data, glyphs_data, kern_left_data, kern_right_data,
+    return (intervals_data, hot_index, glyphs_data, kern_left_data, kern_right_data,
             kern_matrix_data, ligature_data, bitmap_data)
 
 
@@ -760,11 +856,16 @@ def style_sections_total_size(sections):
 # --- File writers ---
 
 def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
-                               force_autohint=False):
-    """Generate a multi-style v4 .cpfont file.
+                               force_autohint=False, hot_rankings=None,
+                               hot_glyphs=DEFAULT_HOT_GLYPHS):
+    """Generate a multi-style v5 .cpfont file.
 
     style_fonts: dict of {style_id: fontfile_path} e.g. {0: "Regular.ttf", 2: "Italic.ttf"}
+    hot_rankings: per-script codepoint rankings from load_hot_rankings()
+    hot_glyphs: hot set size per script (0 leaves the hot block out)
     """
+    if hot_rankings is None:
+        hot_rankings = load_hot_rankings(None)
     MAGIC = b"CPFONT\x00\x00"
     HEADER_SIZE = 32
     STYLE_TOC_ENTRY_SIZE = 32
@@ -782,8 +883,11 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
 
     # Pack binary sections for each style
     packed_sections = {}  # style_id -> tuple of section bytearrays
+    hot_sets = {}  # style_id -> hot codepoints in rank order
     for style_id, sd in raster_data.items():
-        packed_sections[style_id] = pack_style_sections(sd)
+        covered = set(glyph.code_point for glyph, _ in sd.all_glyphs)
+        hot_sets[style_id] = select_hot_glyphs(hot_rankings, covered, hot_glyphs)
+        packed_sections[style_id] = pack_style_sections(sd, hot_sets[style_id])
 
     # Calculate data offsets (after header + TOC)
     data_start = HEADER_SIZE + style_count * STYLE_TOC_ENTRY_SIZE
@@ -795,15 +899,16 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
         current_offset += style_sections_total_size(packed_sections[style_id])
 
     # Build global header
-    # V4 header: magic(8) + version(2) + flags(2) + styleCount(1) + reserved(19) = 32
+    # Header: magic(8) + version(2) + flags(2) + styleCount(1) + reserved(19) = 32
     header = struct.pack("<8sHHB19s", MAGIC, CPFONT_VERSION, flags, style_count, bytes(19))
     assert len(header) == HEADER_SIZE
 
     # Build style TOC entries
     # Each entry: styleId(1) + pad(3) + intervalCount(4) + glyphCount(4) +
     #   advanceY(1) + ascender(2) + descender(2) + kernL(2) + kernR(2) +
-    #   kernLCls(1) + kernRCls(1) + ligCount(1) + dataOffset(4) + reserved(4) = 32
-    STYLE_TOC_FORMAT = "<B3xIIBhhHHBBBI4x"
+    #   kernLCls(1) + kernRCls(1) + ligCount(1) + dataOffset(4) + hotCount(2) +
+    #   reserved(2) = 32
+    STYLE_TOC_FORMAT = "<B3xIIBhhHHBBBIH2x"
     assert struct.calcsize(STYLE_TOC_FORMAT) == STYLE_TOC_ENTRY_SIZE
 
     toc_data = bytearray()
@@ -822,7 +927,8 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
                                 len(sd.kern_left_classes), len(sd.kern_right_classes),
                                 sd.kern_left_class_count, sd.kern_right_class_count,
                                 len(sd.ligature_pairs),
-                                style_offsets[style_id])
+                                style_offsets[style_id],
+                                len(hot_sets[style_id]))
 
     # Write output
     os.makedirs(os.path.dirname(output_path) if os.path.dirname(output_path) else ".", exist_ok=True)
@@ -836,7 +942,7 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
         total_file_size = f.tell()
 
     # Print summary
-    print(f"  Output: {output_path} (v4, {style_count} styles)", file=sys.stderr)
+    print(f"  Output: {output_path} (v{CPFONT_VERSION}, {style_count} styles)", file=sys.stderr)
     print(f"    Header+TOC: {HEADER_SIZE + len(toc_data)} bytes", file=sys.stderr)
     for style_id in sorted(raster_data.keys()):
         sd = raster_data[style_id]
@@ -844,8 +950,8 @@ def generate_cpfont_multistyle(style_fonts, size, intervals, output_path,
         style_names = {0: "regular", 1: "bold", 2: "italic", 3: "bolditalic"}
         sname = style_names.get(style_id, str(style_id))
         ssize = style_sections_total_size(secs)
-        print(f"    {sname}: {len(sd.all_glyphs)} glyphs, {len(sd.intervals)} intervals, "
-              f"{ssize} bytes", file=sys.stderr)
+        print(f"    {sname}: {len(sd.all_glyphs)} glyphs ({len(hot_sets[style_id])} hot), "
+              f"{len(sd.intervals)} intervals, {ssize} bytes", file=sys.stderr)
     print(f"    Total: {total_file_size} bytes ({total_file_size / 1024 / 1024:.2f} MB)", file=sys.stderr)
     return total_file_size
 
@@ -880,9 +986,16 @@ def main():
     parser.add_argument("--list-presets", action="store_true",
                         help="List available interval presets and exit.")
 
-    # Multi-style mode: per-style font file arguments (generates v4 .cpfont)
+    parser.add_argument("--hot-corpus", dest="hot_corpus", action="append", default=[], metavar="FILE",
+                        help="UTF-8 text to rank the hot glyph set by (repeatable; default: built-in "
+                             "letter frequencies).")
+    parser.add_argument("--hot-glyphs", dest="hot_glyphs", type=int, default=DEFAULT_HOT_GLYPHS, metavar="N",
+                        help=f"Hot glyphs per script stored at the front of the file (default: "
+                             f"{DEFAULT_HOT_GLYPHS}, 0 disables).")
+
+    # Multi-style mode: per-style font file arguments
     parser.add_argument("--regular", dest="font_regular",
-                        help="Font file for regular style (enables multi-style v4 mode).")
+                        help="Font file for regular style (enables multi-style mode).")
     parser.add_argument("--bold", dest="font_bold",
                         help="Font file for bold style.")
     parser.add_argument("--italic", dest="font_italic",
@@ -958,11 +1071,12 @@ def main():
         font_name = base
 
     if not is_multistyle:
-        # Single font file provided: wrap as a single-style v4 font
+        # Single font file provided: wrap as a single-style font
         style_map = {"regular": 0, "bold": 1, "italic": 2, "bolditalic": 3}
         style_fonts[style_map[args.style]] = fontfile
 
-    # Always generate v4 format
+    hot_rankings = load_hot_rankings(args.hot_corpus)
+
     if args.output and len(sizes) != 1:
         print("Error: --output can only be used with a single size", file=sys.stderr)
         sys.exit(1)
@@ -974,10 +1088,12 @@ def main():
         else:
             filename = f"{font_name}_{sz}.cpfont"
             output_path = os.path.join(output_dir, filename)
-        print(f"Generating {output_path} (size {sz}, {len(style_fonts)} style(s), v4)...", file=sys.stderr)
+        print(f"Generating {output_path} (size {sz}, {len(style_fonts)} style(s), v{CPFONT_VERSION})...",
+              file=sys.stderr)
         total_size += generate_cpfont_multistyle(
             style_fonts, sz, intervals, output_path,
-            force_autohint=args.force_autohint)
+            force_autohint=args.force_autohint,
+            hot_rankings=hot_rankings, hot_glyphs=args.hot_glyphs)
     print(f"\nTotal: {len(sizes)} files, {total_size / 1024 / 1024:.2f} MB", file=sys.stderr)
 
 
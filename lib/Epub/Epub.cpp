@@ -5,6 +5,7 @@
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 #include <PngToBmpConverter.h>
+#include <Trace.h>
 #include <ZipFile.h>
 
 #include "Epub/parsers/ContainerParser.h"
@@ -335,6 +336,7 @@ void Epub::parseCssFiles() const {
 
 // load in the meta data for the epub file
 bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
+  TRACE_SPAN("book_index");
   LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
 
   // Initialize spine/TOC cache
@@ -739,6 +741,22 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
 }
 
+std::unique_ptr<ZipFile> Epub::openItemStream(const std::string& itemHref, const size_t chunkSize,
+                                              size_t* size) const {
+  if (itemHref.empty()) {
+    LOG_DBG("EBP", "Failed to open item stream, empty href");
+    return nullptr;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  auto zip = std::make_unique<ZipFile>(filepath);
+  if (!zip->beginStream(path.c_str(), chunkSize, size)) {
+    LOG_DBG("EBP", "Failed to open item stream %s", path.c_str());
+    return nullptr;
+  }
+  return zip;
+}
+
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
   return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
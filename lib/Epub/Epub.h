@@ -59,6 +59,10 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  // Open a pull-based stream over a single item (see ZipFile::beginStream). Returns nullptr on failure.
+  // The returned ZipFile references this Epub's path, so it must not outlive the Epub.
+  std::unique_ptr<ZipFile> openItemStream(const std::string& itemHref, size_t chunkSize,
+                                          size_t* size = nullptr) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
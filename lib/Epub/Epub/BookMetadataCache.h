@@ -1,9 +1,11 @@
 #pragma once
 
+#include <BufferedFile.h>
 #include <HalStorage.h>
 
 #include <algorithm>
 #include <deque>
+#include <memory>
 #include <string>
 
 class BookMetadataCache {
@@ -54,6 +56,10 @@ class BookMetadataCache {
   // Temp file handles during build
   FsFile spineFile;
   FsFile tocFile;
+  // Buffered views of the temp files for the duration of a pass; declared after the files so they go first
+  std::unique_ptr<BufferedFileWriter> spineWriter;
+  std::unique_ptr<BufferedFileReader> spineReader;
+  std::unique_ptr<BufferedFileWriter> tocWriter;
 
   // Index for fast href→spineIndex lookup (used only for large EPUBs)
   struct SpineHrefIndexEntry {
@@ -76,10 +82,10 @@ class BookMetadataCache {
     return hash;
   }
 
-  uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
-  uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
-  SpineEntry readSpineEntry(FsFile& file) const;
-  TocEntry readTocEntry(FsFile& file) const;
+  uint32_t writeSpineEntry(BufferedFileWriter& file, const SpineEntry& entry) const;
+  uint32_t writeTocEntry(BufferedFileWriter& file, const TocEntry& entry) const;
+  SpineEntry readSpineEntry(BufferedFileReader& file) const;
+  TocEntry readTocEntry(BufferedFileReader& file) const;
 
  public:
   BookMetadata coreMetadata;
@@ -0,0 +1,189 @@
+#include "BookPageMap.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+#include "SectionLayoutIndex.h"
+
+namespace {
+constexpr uint8_t PAGE_MAP_FILE_VERSION = 1;
+
+void writeLayout(BufferedFileWriter& out, const BookPageMap::Layout& layout) {
+  serialization::writePod(out, layout.fontId);
+  serialization::writePod(out, layout.lineCompression);
+  serialization::writePod(out, layout.extraParagraphSpacing);
+  serialization::writePod(out, layout.paragraphAlignment);
+  serialization::writePod(out, layout.viewportWidth);
+  serialization::writePod(out, layout.viewportHeight);
+  serialization::writePod(out, layout.hyphenationEnabled);
+  serialization::writePod(out, layout.embeddedStyle);
+  serialization::writePod(out, layout.imageRendering);
+  serialization::writePod(out, layout.focusReadingEnabled);
+}
+
+void readLayout(BufferedFileReader& in, BookPageMap::Layout& layout) {
+  serialization::readPod(in, layout.fontId);
+  serialization::readPod(in, layout.lineCompression);
+  serialization::readPod(in, layout.extraParagraphSpacing);
+  serialization::readPod(in, layout.paragraphAlignment);
+  serialization::readPod(in, layout.viewportWidth);
+  serialization::readPod(in, layout.viewportHeight);
+  serialization::readPod(in, layout.hyphenationEnabled);
+  serialization::readPod(in, layout.embeddedStyle);
+  serialization::readPod(in, layout.imageRendering);
+  serialization::readPod(in, layout.focusReadingEnabled);
+}
+}  // namespace
+
+uint32_t BookPageMap::Layout::hash() const {
+  uint32_t hash = 2166136261u;
+  const auto mix = [&hash](const void* data, const size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+      hash ^= bytes[i];
+      hash *= 16777619u;
+    }
+  };
+  // Field by field: the struct's padding bytes are not guaranteed to be zero
+  mix(&fontId, sizeof(fontId));
+  mix(&lineCompression, sizeof(lineCompression));
+  mix(&extraParagraphSpacing, sizeof(extraParagraphSpacing));
+  mix(&paragraphAlignment, sizeof(paragraphAlignment));
+  mix(&viewportWidth, sizeof(viewportWidth));
+  mix(&viewportHeight, sizeof(viewportHeight));
+  mix(&hyphenationEnabled, sizeof(hyphenationEnabled));
+  mix(&embeddedStyle, sizeof(embeddedStyle));
+  mix(&imageRendering, sizeof(imageRendering));
+  mix(&focusReadingEnabled, sizeof(focusReadingEnabled));
+  return hash;
+}
+
+void BookPageMap::setLayout(const Layout& newLayout) {
+  if (hasLayout && layout == newLayout) {
+    return;
+  }
+  layout = newLayout;
+  hasLayout = true;
+  filePath = SectionLayoutIndex::pageMapFilePath(cachePath, layout.hash());
+  std::fill(pageCounts.begin(), pageCounts.end(), UNKNOWN_COUNT);
+  knownCount = 0;
+  if (!loadFromFile()) {
+    std::fill(pageCounts.begin(), pageCounts.end(), UNKNOWN_COUNT);
+    knownCount = 0;
+  }
+  LOG_DBG("BPM", "Page map bound to layout: %u of %u spine items known", knownCount,
+          static_cast<uint32_t>(pageCounts.size()));
+}
+
+bool BookPageMap::loadFromFile() {
+  FsFile file;
+  if (!Storage.exists(filePath.c_str()) || !Storage.openFileForRead("BPM", filePath, file)) {
+    return false;
+  }
+  BufferedFileReader in(file);
+
+  uint8_t version;
+  serialization::readPod(in, version);
+  if (version != PAGE_MAP_FILE_VERSION) {
+    LOG_DBG("BPM", "Ignoring page map with version %u", version);
+    return false;
+  }
+  Layout fileLayout;
+  readLayout(in, fileLayout);
+  uint16_t spineCount;
+  serialization::readPod(in, spineCount);
+  if (fileLayout != layout || spineCount != pageCounts.size()) {
+    LOG_DBG("BPM", "Saved page map is for a different layout");
+    return false;
+  }
+
+  const size_t bytes = sizeof(uint16_t) * spineCount;
+  if (in.read(pageCounts.data(), bytes) != static_cast<int>(bytes)) {
+    LOG_ERR("BPM", "Truncated page map");
+    return false;
+  }
+  knownCount = std::count_if(pageCounts.begin(), pageCounts.end(), [](uint16_t c) { return c != UNKNOWN_COUNT; });
+  return true;
+}
+
+bool BookPageMap::saveToFile() const {
+  FsFile file;
+  if (!Storage.openFileForWrite("BPM", filePath, file)) {
+    return false;
+  }
+  BufferedFileWriter out(file);
+  serialization::writePod(out, PAGE_MAP_FILE_VERSION);
+  writeLayout(out, layout);
+  serialization::writePod(out, static_cast<uint16_t>(pageCounts.size()));
+  out.write(pageCounts.data(), sizeof(uint16_t) * pageCounts.size());
+  if (!out.flush()) {
+    LOG_ERR("BPM", "Failed to write page map");
+    file.close();
+    Storage.remove(filePath.c_str());
+    return false;
+  }
+  return true;
+}
+
+void BookPageMap::setPageCount(const int spineIndex, const uint16_t pageCount) {
+  if (!hasLayout || spineIndex < 0 || spineIndex >= static_cast<int>(pageCounts.size()) ||
+      pageCount == UNKNOWN_COUNT || pageCounts[spineIndex] == pageCount) {
+    return;
+  }
+  if (pageCounts[spineIndex] == UNKNOWN_COUNT) {
+    knownCount++;
+  }
+  pageCounts[spineIndex] = pageCount;
+  saveToFile();
+}
+
+std::optional<uint16_t> BookPageMap::getPageCount(const int spineIndex) const {
+  if (!hasLayout || spineIndex < 0 || spineIndex >= static_cast<int>(pageCounts.size()) ||
+      pageCounts[spineIndex] == UNKNOWN_COUNT) {
+    return std::nullopt;
+  }
+  return pageCounts[spineIndex];
+}
+
+int BookPageMap::findUnknownSpineIndex(const int startIndex) const {
+  const int count = static_cast<int>(pageCounts.size());
+  if (!hasLayout || count == 0 || knownCount == count) {
+    return -1;
+  }
+  const int start = std::clamp(startIndex, 0, count - 1);
+  for (int i = 0; i < count; i++) {
+    const int index = (start + i) % count;
+    if (pageCounts[index] == UNKNOWN_COUNT) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+uint32_t BookPageMap::getTotalPages() const { return getSpineStartPage(static_cast<int>(pageCounts.size())); }
+
+uint32_t BookPageMap::getSpineStartPage(const int spineIndex) const {
+  uint32_t pages = 0;
+  for (int i = 0; i < spineIndex && i < static_cast<int>(pageCounts.size()); i++) {
+    if (pageCounts[i] != UNKNOWN_COUNT) {
+      pages += pageCounts[i];
+    }
+  }
+  return pages;
+}
+
+bool BookPageMap::locatePage(uint32_t bookPage, int& spineIndex, int& pageInSpine) const {
+  for (size_t i = 0; i < pageCounts.size(); i++) {
+    const uint16_t count = pageCounts[i] == UNKNOWN_COUNT ? 0 : pageCounts[i];
+    if (bookPage < count) {
+      spineIndex = static_cast<int>(i);
+      pageInSpine = static_cast<int>(bookPage);
+      return true;
+    }
+    bookPage -= count;
+  }
+  return false;
+}
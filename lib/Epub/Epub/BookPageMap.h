@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Book-level page map: the page count of every spine item under one layout, persisted in the book cache as
+// pagemap_<layout hash>.bin so each recently used layout keeps its own map. Counts are filled in as sections are
+// built or loaded; once every spine item is known the map gives exact book-wide page numbers.
+class BookPageMap {
+ public:
+  // The parameters a section file is keyed on. A map only holds counts for one layout.
+  struct Layout {
+    int fontId = 0;
+    float lineCompression = 0;
+    bool extraParagraphSpacing = false;
+    uint8_t paragraphAlignment = 0;
+    uint16_t viewportWidth = 0;
+    uint16_t viewportHeight = 0;
+    bool hyphenationEnabled = false;
+    bool embeddedStyle = false;
+    uint8_t imageRendering = 0;
+    bool focusReadingEnabled = false;
+
+    bool operator==(const Layout& other) const {
+      return fontId == other.fontId && lineCompression == other.lineCompression &&
+             extraParagraphSpacing == other.extraParagraphSpacing && paragraphAlignment == other.paragraphAlignment &&
+             viewportWidth == other.viewportWidth && viewportHeight == other.viewportHeight &&
+             hyphenationEnabled == other.hyphenationEnabled && embeddedStyle == other.embeddedStyle &&
+             imageRendering == other.imageRendering && focusReadingEnabled == other.focusReadingEnabled;
+    }
+    bool operator!=(const Layout& other) const { return !(*this == other); }
+
+    // FNV-1a over the parameters; names the layout's section files and page map in the book cache
+    uint32_t hash() const;
+  };
+
+ private:
+  static constexpr uint16_t UNKNOWN_COUNT = UINT16_MAX;
+
+  std::string cachePath;
+  std::string filePath;
+  Layout layout;
+  bool hasLayout = false;
+  std::vector<uint16_t> pageCounts;
+  uint16_t knownCount = 0;
+
+  bool loadFromFile();
+  bool saveToFile() const;
+
+ public:
+  explicit BookPageMap(const std::string& cachePath, uint16_t spineCount)
+      : cachePath(cachePath), pageCounts(spineCount, UNKNOWN_COUNT) {}
+
+  // Bind the map to a layout: loads the saved counts if they were recorded under it, otherwise starts empty.
+  // Does nothing if the map is already bound to this layout.
+  void setLayout(const Layout& newLayout);
+  const Layout* getLayout() const { return hasLayout ? &layout : nullptr; }
+
+  // Record a spine item's page count under the current layout; saved to SD when it changes
+  void setPageCount(int spineIndex, uint16_t pageCount);
+  std::optional<uint16_t> getPageCount(int spineIndex) const;
+
+  // First spine item at or after startIndex (wrapping around) whose page count is unknown, or -1 if none
+  int findUnknownSpineIndex(int startIndex) const;
+  bool isComplete() const { return hasLayout && knownCount == pageCounts.size(); }
+
+  // The following are only meaningful once the map is complete
+  uint32_t getTotalPages() const;
+  // Book-wide index of the first page of a spine item
+  uint32_t getSpineStartPage(int spineIndex) const;
+  // Spine item and page within it for a book-wide page index. Returns false if the index is past the end.
+  bool locatePage(uint32_t bookPage, int& spineIndex, int& pageInSpine) const;
+};
@@ -3,74 +3,72 @@
 #include <Logging.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
-}
-
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
-
-  // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
-}
-
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
-
-  auto tb = TextBlock::deserialize(file);
-  return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
-}
-
-void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  // Images don't use fontId or text rendering
-  imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
-}
-
-bool PageImage::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+#include "PageView.h"
 
-  // serialize ImageBlock
-  return imageBlock->serialize(file);
-}
-
-std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
-
-  auto ib = ImageBlock::deserialize(file);
-  return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
-}
-
-void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
-  for (auto& element : elements) {
-    element->render(renderer, fontId, xOffset, yOffset);
+bool Page::serialize(BufferedFileWriter& file) const {
+  // First pass: record counts and string pool size, so the header can go out first and the blob stays one stream
+  uint32_t lineCount = 0, imageCount = 0, wordCount = 0, wordPoolSize = 0, poolSize = 0;
+  for (const auto& el : elements) {
+    if (el->getTag() == TAG_PageLine) {
+      const auto& block = static_cast<const PageLine&>(*el).getBlock();
+      lineCount++;
+      wordCount += block->wordCount();
+      for (const auto& w : block->getWords()) wordPoolSize += w.size() + 1;
+    } else {
+      imageCount++;
+      poolSize += static_cast<const PageImage&>(*el).getImageBlock().getImagePath().size() + 1;
+    }
+  }
+  poolSize += wordPoolSize;
+  if (lineCount > UINT16_MAX || imageCount > UINT16_MAX || wordCount > UINT16_MAX || poolSize > UINT16_MAX) {
+    LOG_ERR("PGE", "Page too large to serialize (%u lines, %u words, %u pool bytes)", lineCount, wordCount, poolSize);
+    return false;
   }
-}
 
-bool Page::serialize(FsFile& file) const {
-  const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+  // Clamp footnotes to MAX_FOOTNOTES_PER_PAGE to match addFootnote
+  PageBlobHeader header;
+  header.lineCount = lineCount;
+  header.imageCount = imageCount;
+  header.wordCount = wordCount;
+  header.footnoteCount = std::min<size_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE);
+  header.poolSize = poolSize;
+  header.reserved = 0;
+  serialization::writePod(file, header);
+
+  uint16_t firstWord = 0;
+  for (const auto& el : elements) {
+    if (el->getTag() == TAG_PageLine) {
+      const auto& line = static_cast<const PageLine&>(*el);
+      const PageLineRecord record = {line.xPos, line.yPos, firstWord,
+                                     static_cast<uint16_t>(line.getBlock()->wordCount())};
+      serialization::writePod(file, record);
+      firstWord += record.wordCount;
+    }
+  }
 
+  // Image paths follow all the word text in the pool
+  uint16_t pathOffset = wordPoolSize;
   for (const auto& el : elements) {
-    // Use getTag() method to determine type
-    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
+    if (el->getTag() == TAG_PageImage) {
+      const auto& image = static_cast<const PageImage&>(*el);
+      const auto& block = image.getImageBlock();
+      const auto pathLength = static_cast<uint16_t>(block.getImagePath().size());
+      const PageImageRecord record = {image.xPos,        image.yPos, block.getWidth(),
+                                      block.getHeight(), pathOffset, pathLength};
+      serialization::writePod(file, record);
+      pathOffset += record.pathLength + 1;
+    }
+  }
 
-    if (!el->serialize(file)) {
+  uint16_t wordOffset = 0;
+  for (const auto& el : elements) {
+    if (el->getTag() == TAG_PageLine &&
+        !static_cast<const PageLine&>(*el).getBlock()->writeWordRecords(file, wordOffset)) {
       return false;
     }
   }
 
-  // Serialize footnotes (clamp to MAX_FOOTNOTES_PER_PAGE to match addFootnote/deserialize limits)
-  const uint16_t fnCount = std::min<uint16_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE);
-  serialization::writePod(file, fnCount);
-  for (uint16_t i = 0; i < fnCount; i++) {
+  for (uint16_t i = 0; i < header.footnoteCount; i++) {
     const auto& fn = footnotes[i];
     if (file.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
         file.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
@@ -79,49 +77,20 @@ bool Page::serialize(FsFile& file) const {
     }
   }
 
-  return true;
-}
-
-std::unique_ptr<Page> Page::deserialize(FsFile& file) {
-  auto page = std::unique_ptr<Page>(new Page());
-
-  uint16_t count;
-  serialization::readPod(file, count);
-
-  for (uint16_t i = 0; i < count; i++) {
-    uint8_t tag;
-    serialization::readPod(file, tag);
-
-    if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      page->elements.push_back(std::move(pl));
-    } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
-      page->elements.push_back(std::move(pi));
-    } else {
-      LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
-      return nullptr;
+  for (const auto& el : elements) {
+    if (el->getTag() == TAG_PageLine && !static_cast<const PageLine&>(*el).getBlock()->writeWordText(file)) {
+      return false;
     }
   }
-
-  // Deserialize footnotes
-  uint16_t fnCount;
-  serialization::readPod(file, fnCount);
-  if (fnCount > MAX_FOOTNOTES_PER_PAGE) {
-    LOG_ERR("PGE", "Invalid footnote count %u", fnCount);
-    return nullptr;
-  }
-  page->footnotes.resize(fnCount);
-  for (uint16_t i = 0; i < fnCount; i++) {
-    auto& entry = page->footnotes[i];
-    if (file.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
-        file.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
-      LOG_ERR("PGE", "Failed to read footnote %u", i);
-      return nullptr;
+  for (const auto& el : elements) {
+    if (el->getTag() == TAG_PageImage) {
+      const auto& path = static_cast<const PageImage&>(*el).getImageBlock().getImagePath();
+      if (file.write(path.c_str(), path.size() + 1) != path.size() + 1) {
+        LOG_ERR("PGE", "Failed to write image path");
+        return false;
+      }
     }
-    entry.number[sizeof(entry.number) - 1] = '\0';
-    entry.href[sizeof(entry.href) - 1] = '\0';
   }
 
-  return page;
+  return true;
 }
@@ -0,0 +1,213 @@
+#include "PageView.h"
+
+#include <DisplayList.h>
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <Trace.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "blocks/ImageBlock.h"
+
+namespace {
+void renderWord(const GfxRenderer& renderer, const int fontId, const int x, const int y, const char* word,
+                const PageWordRecord& record) {
+  const auto currentStyle = static_cast<EpdFontFamily::Style>(record.style);
+
+  if (record.focusBoundary > 0) {
+    // Focus split: draw bold prefix, then the regular suffix at a pre-computed x offset.
+    // The bold prefix is bounded to 9 codepoints by the clamp on targetBoldChars in
+    // ParsedText::addWord; 9 UTF-8 codepoints occupy at most 9 * 4 = 36 bytes, +1 for null = 37.
+    // suffixX is computed at cache-creation time to avoid font metric lookups at render time.
+    static constexpr size_t MAX_FOCUS_PREFIX_BYTES = 9 * 4 + 1;
+    char boldBuf[40];
+    static_assert(sizeof(boldBuf) >= MAX_FOCUS_PREFIX_BYTES,
+                  "boldBuf too small for max focus prefix (9 codepoints * 4 UTF-8 bytes + null)");
+    const auto boldStyle = static_cast<EpdFontFamily::Style>(currentStyle | EpdFontFamily::BOLD);
+    const size_t boldLen =
+        std::min<size_t>({static_cast<size_t>(record.focusBoundary), record.length, sizeof(boldBuf) - 1});
+    memcpy(boldBuf, word, boldLen);
+    boldBuf[boldLen] = '\0';
+    renderer.drawText(fontId, x, y, boldBuf, true, boldStyle);
+    renderer.drawText(fontId, x + record.focusSuffixX, y, word + boldLen, true, currentStyle);
+  } else {
+    renderer.drawText(fontId, x, y, word, true, currentStyle);
+  }
+
+  if ((currentStyle & EpdFontFamily::UNDERLINE) != 0) {
+    const int fullWordWidth = renderer.getTextWidth(fontId, word, currentStyle);
+    // y is the top of the text line; add ascender to reach baseline, then offset 2px below
+    const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+
+    int startX = x;
+    int underlineWidth = fullWordWidth;
+
+    // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
+    if (record.length >= 3 && static_cast<uint8_t>(word[0]) == 0xE2 && static_cast<uint8_t>(word[1]) == 0x80 &&
+        static_cast<uint8_t>(word[2]) == 0x83) {
+      const int prefixWidth = renderer.getTextAdvanceX(fontId, "\xe2\x80\x83", currentStyle);
+      startX = x + prefixWidth;
+      underlineWidth = renderer.getTextWidth(fontId, word + 3, currentStyle);
+    }
+
+    renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
+  }
+}
+
+void renderImage(GfxRenderer& renderer, const char* pool, const PageImageRecord& image, const int x, const int y) {
+  // ImageBlock decodes or replays its pixel cache by path; one small object per image, not per word
+  ImageBlock(std::string(pool + image.pathOffset, image.pathLength), image.width, image.height).render(renderer, x, y);
+}
+
+// Pool entries must be NUL-terminated in place so they can be handed to drawText as-is
+bool poolEntryValid(const char* pool, const uint16_t poolSize, const uint16_t offset, const uint16_t length) {
+  return static_cast<uint32_t>(offset) + length < poolSize && pool[offset + length] == '\0';
+}
+}  // namespace
+
+PageView::PageView(uint8_t* blob, const size_t blobSize)
+    : blob(blob),
+      blobSize(blobSize),
+      header(reinterpret_cast<const PageBlobHeader*>(blob)),
+      lines(reinterpret_cast<const PageLineRecord*>(header + 1)),
+      images(reinterpret_cast<const PageImageRecord*>(lines + header->lineCount)),
+      words(reinterpret_cast<const PageWordRecord*>(images + header->imageCount)),
+      footnotes(reinterpret_cast<const FootnoteEntry*>(words + header->wordCount)),
+      pool(reinterpret_cast<const char*>(footnotes + header->footnoteCount)) {}
+
+PageView::~PageView() { free(blob); }
+
+std::unique_ptr<PageView> PageView::fromBlob(uint8_t* blob, const size_t blobSize) {
+  if (!blob || blobSize < sizeof(PageBlobHeader)) {
+    LOG_ERR("PGV", "Page blob too small: %u bytes", static_cast<uint32_t>(blobSize));
+    free(blob);
+    return nullptr;
+  }
+
+  const auto* hdr = reinterpret_cast<const PageBlobHeader*>(blob);
+  const size_t expected = sizeof(PageBlobHeader) + hdr->lineCount * sizeof(PageLineRecord) +
+                          hdr->imageCount * sizeof(PageImageRecord) + hdr->wordCount * sizeof(PageWordRecord) +
+                          hdr->footnoteCount * sizeof(FootnoteEntry) + hdr->poolSize;
+  if (expected != blobSize) {
+    LOG_ERR("PGV", "Page blob size mismatch: header describes %u bytes, have %u", static_cast<uint32_t>(expected),
+            static_cast<uint32_t>(blobSize));
+    free(blob);
+    return nullptr;
+  }
+
+  std::unique_ptr<PageView> view(new (std::nothrow) PageView(blob, blobSize));
+  if (!view) {
+    LOG_ERR("PGV", "Failed to allocate page view");
+    free(blob);
+    return nullptr;
+  }
+
+  // Validate every reference once here so render() can trust the records
+  for (uint16_t i = 0; i < hdr->lineCount; i++) {
+    const auto& line = view->lines[i];
+    if (static_cast<uint32_t>(line.firstWord) + line.wordCount > hdr->wordCount) {
+      LOG_ERR("PGV", "Line %u references words past the end", i);
+      return nullptr;
+    }
+  }
+  for (uint16_t i = 0; i < hdr->wordCount; i++) {
+    if (!poolEntryValid(view->pool, hdr->poolSize, view->words[i].offset, view->words[i].length)) {
+      LOG_ERR("PGV", "Word %u is outside the string pool", i);
+      return nullptr;
+    }
+  }
+  for (uint16_t i = 0; i < hdr->imageCount; i++) {
+    if (!poolEntryValid(view->pool, hdr->poolSize, view->images[i].pathOffset, view->images[i].pathLength)) {
+      LOG_ERR("PGV", "Image %u path is outside the string pool", i);
+      return nullptr;
+    }
+  }
+  // Footnote fields are fixed-size arrays copied straight from SD; consumers read them as C strings
+  for (uint16_t i = 0; i < hdr->footnoteCount; i++) {
+    const auto& footnote = view->footnotes[i];
+    if (!memchr(footnote.number, '\0', FOOTNOTE_NUMBER_LEN) || !memchr(footnote.href, '\0', FOOTNOTE_HREF_LEN)) {
+      LOG_ERR("PGV", "Footnote %u is not NUL-terminated", i);
+      return nullptr;
+    }
+  }
+
+  return view;
+}
+
+void PageView::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset,
+                      const DisplayList* list) const {
+  TRACE_SPAN("page_draw");
+  if (list && list->isComplete()) {
+    renderer.drawDisplayList(*list, [&](const uint16_t index, const int x, const int y) {
+      if (index < header->imageCount) {
+        renderImage(renderer, pool, images[index], x, y);
+      }
+    });
+    return;
+  }
+
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    renderImage(renderer, pool, images[i], images[i].x + xOffset, images[i].y + yOffset);
+  }
+
+  for (uint16_t i = 0; i < header->lineCount; i++) {
+    const auto& line = lines[i];
+    const int lineX = line.x + xOffset;
+    const int lineY = line.y + yOffset;
+    for (uint16_t w = line.firstWord; w < line.firstWord + line.wordCount; w++) {
+      renderWord(renderer, fontId, lineX + words[w].x, lineY, pool + words[w].offset, words[w]);
+    }
+  }
+}
+
+void PageView::record(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset,
+                      DisplayList& list) const {
+  TRACE_SPAN("page_record");
+  list.clear();
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    list.addImage(i, images[i].x + xOffset, images[i].y + yOffset);
+  }
+
+  renderer.setDisplayListRecorder(&list);
+  for (uint16_t i = 0; i < header->lineCount; i++) {
+    const auto& line = lines[i];
+    const int lineX = line.x + xOffset;
+    const int lineY = line.y + yOffset;
+    for (uint16_t w = line.firstWord; w < line.firstWord + line.wordCount; w++) {
+      renderWord(renderer, fontId, lineX + words[w].x, lineY, pool + words[w].offset, words[w]);
+    }
+  }
+  renderer.setDisplayListRecorder(nullptr);
+}
+
+std::string PageView::getText() const {
+  std::string text;
+  for (uint16_t i = 0; i < header->wordCount; i++) {
+    if (!text.empty()) text += " ";
+    text.append(pool + words[i].offset, words[i].length);
+  }
+  return text;
+}
+
+bool PageView::getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const {
+  if (header->imageCount == 0) {
+    return false;
+  }
+  int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    const auto& image = images[i];
+    minX = std::min(minX, image.x);
+    minY = std::min(minY, image.y);
+    maxX = std::max(maxX, static_cast<int16_t>(image.x + image.width));
+    maxY = std::max(maxY, static_cast<int16_t>(image.y + image.height));
+  }
+  outX = minX;
+  outY = minY;
+  outW = maxX - minX;
+  outH = maxY - minY;
+  return true;
+}
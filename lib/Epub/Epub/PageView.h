@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "FootnoteEntry.h"
+
+class DisplayList;
+class GfxRenderer;
+
+// On-disk page record: one contiguous blob per page, rendered in place by PageView.
+//
+//   PageBlobHeader
+//   PageLineRecord  lines[lineCount]
+//   PageImageRecord images[imageCount]
+//   PageWordRecord  words[wordCount]      (each line owns words[firstWord, firstWord + wordCount))
+//   FootnoteEntry   footnotes[footnoteCount]
+//   char            pool[poolSize]        (NUL-terminated word text and image paths)
+//
+// Every record is a multiple of 2 bytes, so the records stay aligned in a malloc'd buffer.
+struct PageBlobHeader {
+  uint16_t lineCount;
+  uint16_t imageCount;
+  uint16_t wordCount;
+  uint16_t footnoteCount;
+  uint16_t poolSize;
+  uint16_t reserved;
+};
+
+struct PageLineRecord {
+  int16_t x;
+  int16_t y;
+  uint16_t firstWord;
+  uint16_t wordCount;
+};
+
+struct PageImageRecord {
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  uint16_t pathOffset;
+  uint16_t pathLength;
+};
+
+struct PageWordRecord {
+  uint16_t offset;
+  uint16_t length;
+  int16_t x;              // relative to the line
+  uint16_t focusSuffixX;  // pixel offset of the regular suffix when focusBoundary > 0
+  uint8_t style;          // EpdFontFamily::Style
+  uint8_t focusBoundary;  // byte length of the bold prefix, 0 for no split
+};
+
+static_assert(sizeof(PageBlobHeader) == 12, "PageBlobHeader must be packed");
+static_assert(sizeof(PageLineRecord) == 8, "PageLineRecord must be packed");
+static_assert(sizeof(PageImageRecord) == 12, "PageImageRecord must be packed");
+static_assert(sizeof(PageWordRecord) == 10, "PageWordRecord must be packed");
+static_assert(sizeof(FootnoteEntry) % 2 == 0, "FootnoteEntry must keep the pool 2-byte aligned");
+
+// Read-only view of a loaded page blob. Owns the buffer; rendering draws straight from it without allocating.
+class PageView {
+  uint8_t* blob;
+  size_t blobSize;
+  const PageBlobHeader* header;
+  const PageLineRecord* lines;
+  const PageImageRecord* images;
+  const PageWordRecord* words;
+  const FootnoteEntry* footnotes;
+  const char* pool;
+
+  PageView(uint8_t* blob, size_t blobSize);
+
+ public:
+  // Takes ownership of a malloc'd blob. Returns nullptr (and frees the blob) if its records don't fit its size.
+  static std::unique_ptr<PageView> fromBlob(uint8_t* blob, size_t blobSize);
+  ~PageView();
+  PageView(const PageView&) = delete;
+  PageView& operator=(const PageView&) = delete;
+
+  // With a complete display list recorded from this page at the same offsets, replays the list instead of laying
+  // the page's text out again
+  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, const DisplayList* list = nullptr) const;
+  // Record what render() draws into list. Serves as the font prewarm scan pass when a prewarm scope is active.
+  void record(GfxRenderer& renderer, int fontId, int xOffset, int yOffset, DisplayList& list) const;
+
+  size_t size() const { return blobSize; }
+  uint16_t getFootnoteCount() const { return header->footnoteCount; }
+  const FootnoteEntry* getFootnotes() const { return footnotes; }
+  // Words of every line, space separated
+  std::string getText() const;
+
+  // Check if page contains any images (used to force full refresh)
+  bool hasImages() const { return header->imageCount > 0; }
+
+  // Get bounding box of all images on the page (union of image rects)
+  // Returns false if no images. Coordinates are relative to page origin.
+  bool getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const;
+};
@@ -1,6 +1,7 @@
 #include "ParsedText.h"
 
 #include <GfxRenderer.h>
+#include <Trace.h>
 #include <Utf8.h>
 
 #include <algorithm>
@@ -74,6 +75,36 @@ uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const s
   return renderer.getTextAdvanceX(fontId, sanitized.c_str(), style);
 }
 
+// measureWordWidth() through the renderer's word width cache, which keeps widths across paragraphs and sections.
+uint16_t cachedWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
+                         const EpdFontFamily::Style style) {
+  if (word.size() == 1 && word[0] == ' ') {
+    return measureWordWidth(renderer, fontId, word, style);
+  }
+  WordWidthCache& cache = renderer.getWordWidthCache();
+  const auto key = WordWidthCache::makeKey(fontId, style, word.data(), word.size());
+  uint16_t width;
+  if (!cache.findWidth(key, width)) {
+    width = measureWordWidth(renderer, fontId, word, style);
+    cache.putWidth(key, width);
+  }
+  return width;
+}
+
+// Width of a hyphenation prefix of `word` (its first `offset` bytes), cached in the entry of the whole word under
+// `wordKey`.
+uint16_t cachedPrefixWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
+                           const WordWidthCache::Key& wordKey, const size_t offset, const EpdFontFamily::Style style,
+                           const bool appendHyphen) {
+  WordWidthCache& cache = renderer.getWordWidthCache();
+  uint16_t width;
+  if (!cache.findPrefixWidth(wordKey, offset, appendHyphen, width)) {
+    width = measureWordWidth(renderer, fontId, word.substr(0, offset), style, appendHyphen);
+    cache.putPrefixWidth(wordKey, offset, appendHyphen, width);
+  }
+  return width;
+}
+
 // Checks if a UTF-8 codepoint should be counted as part of a word for Focus Reading
 bool isWordCharacter(uint32_t cp) {
   // ASCII range (Catches 95%+ of characters immediately)
@@ -242,6 +273,7 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
                                        const bool includeLastLine) {
+  TRACE_SPAN("line_break");
   if (words.empty()) {
     return;
   }
@@ -311,7 +343,7 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   wordWidths.reserve(words.size());
 
   for (size_t i = 0; i < words.size(); ++i) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, words[i], wordStyles[i]));
+    wordWidths.push_back(cachedWordWidth(renderer, fontId, words[i], wordStyles[i]));
   }
 
   return wordWidths;
@@ -552,6 +584,7 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   size_t chosenOffset = 0;
   int chosenWidth = -1;
   bool chosenNeedsHyphen = true;
+  const auto wordKey = WordWidthCache::makeKey(fontId, style, word.data(), word.size());
 
   // Iterate over each legal breakpoint and retain the widest prefix that still fits.
   for (const auto& info : breakInfos) {
@@ -561,7 +594,7 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     }
 
     const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    const int prefixWidth = cachedPrefixWidth(renderer, fontId, word, wordKey, offset, style, needsHyphen);
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
       continue;  // Skip if too wide or not an improvement
     }
@@ -613,7 +646,7 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
 
   // Update cached widths to reflect the new prefix/remainder pairing.
   wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
+  const uint16_t remainderWidth = cachedWordWidth(renderer, fontId, remainder, style);
   wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
   return true;
 }
@@ -3,34 +3,200 @@
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
+#include <Trace.h>
+#include <ZipFile.h>
 
+#include <algorithm>
+
+#include "BookPageMap.h"
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "PageView.h"
+#include "SectionLayoutIndex.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 23;
+constexpr uint8_t SECTION_FILE_VERSION = 25;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint8_t) + sizeof(bool) + sizeof(uint32_t) + sizeof(uint32_t) +
                                  sizeof(uint32_t) + sizeof(uint32_t);
 
+// Streaming a chapter out of the ZIP holds the 32KB inflate window for the whole parse, and image extraction
+// needs a second one on top, so only stream with comfortable headroom.
+constexpr uint32_t MIN_FREE_HEAP_FOR_ZIP_STREAM = 96 * 1024;
+constexpr uint32_t MIN_MAX_ALLOC_FOR_ZIP_STREAM = 36 * 1024;
+constexpr size_t ZIP_STREAM_CHUNK_SIZE = 1024;
+
+// A page is one blob read straight into its own buffer; anything larger than this is a corrupt LUT, not a page.
+constexpr size_t MAX_PAGE_BLOB_SIZE = 64 * 1024;
+
+// Anchor map records are fixed-size (hash, page) pairs sorted by hash, so lookups binary search the file
+constexpr uint32_t ANCHOR_ENTRY_SIZE = sizeof(uint64_t) + sizeof(uint16_t);
+
+// FNV-1a 64-bit hash of an anchor id
+uint64_t anchorHash(const std::string& s) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : s) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
 struct PageLutEntry {
   uint32_t fileOffset;
   uint16_t paragraphIndex;
   uint16_t listItemIndex;
 };
+static_assert(sizeof(PageLutEntry) == 8, "PageLutEntry is stored as-is in build checkpoints");
+
+// Build checkpoints are saved at most this often while a build runs, so short chapters never write one and a power
+// loss costs at most this much work
+constexpr uint32_t CHECKPOINT_INTERVAL_MS = 10000;
+// A build cut short this many pages past its last saved checkpoint saves the latest one before it goes
+constexpr uint16_t MIN_NEW_PAGES_TO_CHECKPOINT_ON_ABANDON = 8;
+constexpr uint8_t CHECKPOINT_FILE_VERSION = 1;
+// Written last, so a checkpoint cut short by power loss is rejected
+constexpr uint32_t CHECKPOINT_END_MARKER = 0x54504B43;
+
+// Check the version and layout parameters at the start of a section file
+bool headerMatches(BufferedFileReader& in, const int fontId, const float lineCompression,
+                   const bool extraParagraphSpacing, const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                   const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                   const uint8_t imageRendering, const bool focusReadingEnabled) {
+  uint8_t version = 0;
+  serialization::readPod(in, version);
+  if (version != SECTION_FILE_VERSION) {
+    LOG_ERR("SCT", "Deserialization failed: Unknown version %u", version);
+    return false;
+  }
+
+  int fileFontId;
+  uint16_t fileViewportWidth, fileViewportHeight;
+  float fileLineCompression;
+  bool fileExtraParagraphSpacing;
+  uint8_t fileParagraphAlignment;
+  bool fileHyphenationEnabled;
+  bool fileEmbeddedStyle;
+  uint8_t fileImageRendering;
+  bool fileFocusReadingEnabled;
+  serialization::readPod(in, fileFontId);
+  serialization::readPod(in, fileLineCompression);
+  serialization::readPod(in, fileExtraParagraphSpacing);
+  serialization::readPod(in, fileParagraphAlignment);
+  serialization::readPod(in, fileViewportWidth);
+  serialization::readPod(in, fileViewportHeight);
+  serialization::readPod(in, fileHyphenationEnabled);
+  serialization::readPod(in, fileEmbeddedStyle);
+  serialization::readPod(in, fileImageRendering);
+  serialization::readPod(in, fileFocusReadingEnabled);
+
+  if (fontId != fileFontId || lineCompression != fileLineCompression ||
+      extraParagraphSpacing != fileExtraParagraphSpacing || paragraphAlignment != fileParagraphAlignment ||
+      viewportWidth != fileViewportWidth || viewportHeight != fileViewportHeight ||
+      hyphenationEnabled != fileHyphenationEnabled || embeddedStyle != fileEmbeddedStyle ||
+      imageRendering != fileImageRendering || focusReadingEnabled != fileFocusReadingEnabled) {
+    LOG_ERR("SCT", "Deserialization failed: Parameters do not match");
+    return false;
+  }
+  return true;
+}
+
+bool writeCheckpointFile(const std::string& path, const uint32_t contentSize, const uint32_t pagesEnd,
+                         const ChapterHtmlSlimParser::Checkpoint& checkpoint, const std::vector<PageLutEntry>& lut,
+                         const std::vector<std::pair<std::string, uint16_t>>& anchors, const size_t anchorCount) {
+  FsFile file;
+  if (checkpoint.pageCount > lut.size() || anchorCount > anchors.size() ||
+      !Storage.openFileForWrite("SCT", path, file)) {
+    return false;
+  }
+  BufferedFileWriter out(file);
+  serialization::writePod(out, CHECKPOINT_FILE_VERSION);
+  serialization::writePod(out, contentSize);
+  serialization::writePod(out, pagesEnd);
+  serialization::writePod(out, checkpoint.inputOffset);
+  serialization::writePod(out, checkpoint.pageCount);
+  serialization::writePod(out, checkpoint.xpathParagraphIndex);
+  serialization::writePod(out, checkpoint.xpathListItemIndex);
+  serialization::writePod(out, checkpoint.imageCounter);
+  serialization::writePod(out, checkpoint.prologSize);
+  serialization::writeString(out, checkpoint.openTags);
+  out.write(lut.data(), sizeof(PageLutEntry) * checkpoint.pageCount);
+  serialization::writePod(out, static_cast<uint16_t>(anchorCount));
+  for (size_t i = 0; i < anchorCount; i++) {
+    serialization::writeString(out, anchors[i].first);
+    serialization::writePod(out, anchors[i].second);
+  }
+  serialization::writePod(out, CHECKPOINT_END_MARKER);
+  return out.flush();
+}
+
+bool readCheckpointFile(const std::string& path, const uint32_t contentSize, uint32_t& pagesEnd,
+                        ChapterHtmlSlimParser::Checkpoint& checkpoint, std::vector<PageLutEntry>& lut,
+                        std::vector<std::pair<std::string, uint16_t>>& anchors) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("SCT", path, file)) {
+    return false;
+  }
+  BufferedFileReader in(file);
+  // Lengths are checked against what is left of the file before anything is allocated for them
+  const auto readString = [&in](std::string& s) {
+    uint32_t len = 0;
+    serialization::readPod(in, len);
+    if (len > static_cast<uint32_t>(in.available())) {
+      return false;
+    }
+    s.resize(len);
+    return in.read(&s[0], len) == static_cast<int>(len);
+  };
+
+  uint8_t version = 0;
+  uint32_t fileContentSize = 0;
+  serialization::readPod(in, version);
+  serialization::readPod(in, fileContentSize);
+  if (version != CHECKPOINT_FILE_VERSION || fileContentSize != contentSize) {
+    return false;
+  }
+  serialization::readPod(in, pagesEnd);
+  serialization::readPod(in, checkpoint.inputOffset);
+  serialization::readPod(in, checkpoint.pageCount);
+  serialization::readPod(in, checkpoint.xpathParagraphIndex);
+  serialization::readPod(in, checkpoint.xpathListItemIndex);
+  serialization::readPod(in, checkpoint.imageCounter);
+  serialization::readPod(in, checkpoint.prologSize);
+  const size_t lutBytes = sizeof(PageLutEntry) * checkpoint.pageCount;
+  if (!readString(checkpoint.openTags) || checkpoint.pageCount == 0 || lutBytes > static_cast<size_t>(in.available())) {
+    return false;
+  }
+  lut.resize(checkpoint.pageCount);
+  uint16_t anchorCount = 0;
+  if (in.read(lut.data(), lutBytes) != static_cast<int>(lutBytes) || lut.back().fileOffset >= pagesEnd) {
+    return false;
+  }
+  serialization::readPod(in, anchorCount);
+  anchors.resize(anchorCount);
+  for (auto& [anchor, page] : anchors) {
+    if (!readString(anchor)) {
+      return false;
+    }
+    serialization::readPod(in, page);
+  }
+  uint32_t endMarker = 0;
+  serialization::readPod(in, endMarker);
+  return endMarker == CHECKPOINT_END_MARKER;
+}
 }  // namespace
 
-uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
+uint32_t Section::onPageComplete(BufferedFileWriter& out, std::unique_ptr<Page> page) {
   if (!file) {
     LOG_ERR("SCT", "File not open for writing page %d", pageCount);
     return 0;
   }
 
-  const uint32_t position = file.position();
-  if (!page->serialize(file)) {
+  const uint32_t position = out.position();
+  if (!page->serialize(out)) {
     LOG_ERR("SCT", "Failed to serialize page %d", pageCount);
     return 0;
   }
@@ -40,11 +206,11 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   return position;
 }
 
-void Section::writeSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                     const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                     const uint16_t viewportHeight, const bool hyphenationEnabled,
-                                     const bool embeddedStyle, const uint8_t imageRendering,
-                                     const bool focusReadingEnabled) {
+void Section::writeSectionFileHeader(BufferedFileWriter& out, const int fontId, const float lineCompression,
+                                     const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                     const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                     const bool hyphenationEnabled, const bool embeddedStyle,
+                                     const uint8_t imageRendering, const bool focusReadingEnabled) {
   if (!file) {
     LOG_DBG("SCT", "File not open for writing header");
     return;
@@ -55,85 +221,131 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
                                    sizeof(embeddedStyle) + sizeof(imageRendering) + sizeof(focusReadingEnabled) +
                                    sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t),
                 "Header size mismatch");
-  serialization::writePod(file, SECTION_FILE_VERSION);
-  serialization::writePod(file, fontId);
-  serialization::writePod(file, lineCompression);
-  serialization::writePod(file, extraParagraphSpacing);
-  serialization::writePod(file, paragraphAlignment);
-  serialization::writePod(file, viewportWidth);
-  serialization::writePod(file, viewportHeight);
-  serialization::writePod(file, hyphenationEnabled);
-  serialization::writePod(file, embeddedStyle);
-  serialization::writePod(file, imageRendering);
-  serialization::writePod(file, focusReadingEnabled);
-  serialization::writePod(file, pageCount);  // Placeholder for page count (will be initially 0, patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset (patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for anchor map offset (patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for paragraph LUT offset (patched later)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for li LUT offset (patched later)
+  serialization::writePod(out, SECTION_FILE_VERSION);
+  serialization::writePod(out, fontId);
+  serialization::writePod(out, lineCompression);
+  serialization::writePod(out, extraParagraphSpacing);
+  serialization::writePod(out, paragraphAlignment);
+  serialization::writePod(out, viewportWidth);
+  serialization::writePod(out, viewportHeight);
+  serialization::writePod(out, hyphenationEnabled);
+  serialization::writePod(out, embeddedStyle);
+  serialization::writePod(out, imageRendering);
+  serialization::writePod(out, focusReadingEnabled);
+  serialization::writePod(out, pageCount);  // Placeholder for page count (will be initially 0, patched later)
+  serialization::writePod(out, static_cast<uint32_t>(0));  // Placeholder for LUT offset (patched later)
+  serialization::writePod(out, static_cast<uint32_t>(0));  // Placeholder for anchor map offset (patched later)
+  serialization::writePod(out, static_cast<uint32_t>(0));  // Placeholder for paragraph LUT offset (patched later)
+  serialization::writePod(out, static_cast<uint32_t>(0));  // Placeholder for li LUT offset (patched later)
 }
 
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
                               const uint8_t imageRendering, const bool focusReadingEnabled) {
+  abandonSectionBuild();
+  resetTables();
+  const uint32_t layoutHash =
+      bindLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+                 hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled);
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return false;
   }
 
-  // Match parameters
-  {
-    uint8_t version;
-    serialization::readPod(file, version);
-    if (version != SECTION_FILE_VERSION) {
-      // Explicit close() required: member variable persists beyond function scope
-      file.close();
-      LOG_ERR("SCT", "Deserialization failed: Unknown version %u", version);
-      clearCache();
-      return false;
-    }
-
-    int fileFontId;
-    uint16_t fileViewportWidth, fileViewportHeight;
-    float fileLineCompression;
-    bool fileExtraParagraphSpacing;
-    uint8_t fileParagraphAlignment;
-    bool fileHyphenationEnabled;
-    bool fileEmbeddedStyle;
-    uint8_t fileImageRendering;
-    bool fileFocusReadingEnabled;
-    serialization::readPod(file, fileFontId);
-    serialization::readPod(file, fileLineCompression);
-    serialization::readPod(file, fileExtraParagraphSpacing);
-    serialization::readPod(file, fileParagraphAlignment);
-    serialization::readPod(file, fileViewportWidth);
-    serialization::readPod(file, fileViewportHeight);
-    serialization::readPod(file, fileHyphenationEnabled);
-    serialization::readPod(file, fileEmbeddedStyle);
-    serialization::readPod(file, fileImageRendering);
-    serialization::readPod(file, fileFocusReadingEnabled);
-
-    if (fontId != fileFontId || lineCompression != fileLineCompression ||
-        extraParagraphSpacing != fileExtraParagraphSpacing || paragraphAlignment != fileParagraphAlignment ||
-        viewportWidth != fileViewportWidth || viewportHeight != fileViewportHeight ||
-        hyphenationEnabled != fileHyphenationEnabled || embeddedStyle != fileEmbeddedStyle ||
-        imageRendering != fileImageRendering || focusReadingEnabled != fileFocusReadingEnabled) {
-      file.close();
-      LOG_ERR("SCT", "Deserialization failed: Parameters do not match");
-      clearCache();
-      return false;
-    }
+  BufferedFileReader in(file);
+  if (!headerMatches(in, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                     viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled)) {
+    // Explicit close() required: member variable persists beyond function scope
+    file.close();
+    clearCache();
+    return false;
   }
 
-  serialization::readPod(file, pageCount);
-  // Explicit close() required: member variable persists beyond function scope
-  file.close();
+  serialization::readPod(in, pageCount);
+  serialization::readPod(in, lutOffset);
+  serialization::readPod(in, anchorMapOffset);
+  serialization::readPod(in, paragraphLutOffset);
+  serialization::readPod(in, liLutOffset);
+  // File stays open for page loads until the section is destroyed or rebuilt
   LOG_DBG("SCT", "Deserialization succeeded: %d pages", pageCount);
+  SectionLayoutIndex::markUsed(epub->getCachePath(), layoutHash);
   return true;
 }
 
+uint32_t Section::bindLayout(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                             const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                             const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                             const uint8_t imageRendering, const bool focusReadingEnabled) {
+  BookPageMap::Layout layout;
+  layout.fontId = fontId;
+  layout.lineCompression = lineCompression;
+  layout.extraParagraphSpacing = extraParagraphSpacing;
+  layout.paragraphAlignment = paragraphAlignment;
+  layout.viewportWidth = viewportWidth;
+  layout.viewportHeight = viewportHeight;
+  layout.hyphenationEnabled = hyphenationEnabled;
+  layout.embeddedStyle = embeddedStyle;
+  layout.imageRendering = imageRendering;
+  layout.focusReadingEnabled = focusReadingEnabled;
+  const uint32_t layoutHash = layout.hash();
+  filePath = SectionLayoutIndex::sectionFilePath(epub->getCachePath(), spineIndex, layoutHash);
+  return layoutHash;
+}
+
+bool Section::ensureOpen() {
+  if (file) {
+    return true;
+  }
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return false;
+  }
+
+  BufferedFileReader in(file);
+  uint8_t version;
+  serialization::readPod(in, version);
+  if (version != SECTION_FILE_VERSION) {
+    file.close();
+    LOG_ERR("SCT", "Unknown section file version %u", version);
+    return false;
+  }
+  in.seek(HEADER_SIZE - sizeof(uint32_t) * 4 - sizeof(pageCount));
+  serialization::readPod(in, pageCount);
+  serialization::readPod(in, lutOffset);
+  serialization::readPod(in, anchorMapOffset);
+  serialization::readPod(in, paragraphLutOffset);
+  serialization::readPod(in, liLutOffset);
+  return true;
+}
+
+void Section::resetTables() {
+  if (file) {
+    file.close();
+  }
+  lutOffset = 0;
+  anchorMapOffset = 0;
+  paragraphLutOffset = 0;
+  liLutOffset = 0;
+  pageOffsets.clear();
+  pageOffsets.shrink_to_fit();
+  paragraphLut.clear();
+  paragraphLut.shrink_to_fit();
+  liLut.clear();
+  liLut.shrink_to_fit();
+}
+
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
-bool Section::clearCache() const {
+bool Section::clearCache() {
+  // Close our own handle first, the file can't be removed while it is open
+  abandonSectionBuild();
+  resetTables();
+  if (filePath.empty()) {
+    return true;
+  }
+  // A partial build kept for resuming goes with the cache
+  discardBuildCheckpoint();
+  if (Storage.exists(buildFilePath().c_str())) {
+    Storage.remove(buildFilePath().c_str());
+  }
   if (!Storage.exists(filePath.c_str())) {
     LOG_DBG("SCT", "Cache does not exist, no action needed");
     return true;
@@ -148,20 +360,7 @@ bool Section::clearCache() const {
   return true;
 }
 
-bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const uint8_t imageRendering, const bool focusReadingEnabled,
-                                const std::function<void()>& popupFn) {
-  const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
-
-  // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    Storage.mkdir(sectionsDir.c_str());
-  }
-
+bool Section::stageItemToFile(const std::string& localPath, const std::string& tmpHtmlPath) const {
   // Retry logic for SD card timing issues
   bool success = false;
   uint32_t fileSize = 0;
@@ -198,269 +397,543 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   }
 
   LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
+  return true;
+}
+
+bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                                const uint8_t imageRendering, const bool focusReadingEnabled,
+                                const std::function<void()>& popupFn, const std::function<bool()>& abortFn) {
+  if (!beginSectionBuild(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                         viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled,
+                         popupFn) ||
+      !continueSectionBuild(abortFn)) {
+    return false;
+  }
+  if (isBuilding()) {
+    LOG_DBG("SCT", "Build of spine item %d aborted after %d pages", spineIndex, pageCount);
+    abandonSectionBuild();
+    return false;
+  }
+  return true;
+}
+
+struct Section::Build {
+  std::unique_ptr<ZipFile> zipStream;
+  std::string tmpHtmlPath;  // chapter staged on SD when it isn't streamed from the EPUB
+  BufferedFileWriter out;
+  std::vector<PageLutEntry> lut;
+  CssParser* cssParser = nullptr;
+  std::unique_ptr<ChapterHtmlSlimParser> visitor;
+  bool pageWriteFailed = false;
+  uint32_t contentSize = 0;
+  bool replayingStream = false;  // laid out from the chapter's content stream rather than its XHTML
+  // Latest resume point the parser offered, with where its pages end and how many anchors precede it
+  ChapterHtmlSlimParser::Checkpoint checkpoint;
+  uint32_t checkpointPagesEnd = 0;
+  size_t checkpointAnchorCount = 0;
+  uint16_t savedCheckpointPages = 0;  // page count of the checkpoint on SD, 0 if there is none
+  uint32_t lastCheckpointSaveMs = 0;
+
+  explicit Build(FsFile& file) : out(file) {}
+  ~Build() {
+    // The parser holds the staged chapter open, so it has to go before the file can be removed
+    visitor.reset();
+    if (!tmpHtmlPath.empty()) {
+      Storage.remove(tmpHtmlPath.c_str());
+    }
+    if (cssParser) {
+      cssParser->clear();
+    }
+  }
+};
+
+Section::Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
+    : epub(epub), spineIndex(spineIndex), renderer(renderer) {}
 
-  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+Section::~Section() { abandonSectionBuild(); }
+
+void Section::abandonSectionBuild() {
+  if (!build) {
+    return;
+  }
+  // Save the latest resume point if it is well past the saved one, so resuming doesn't redo those pages
+  if (build->checkpoint.pageCount >= build->savedCheckpointPages + MIN_NEW_PAGES_TO_CHECKPOINT_ON_ABANDON) {
+    saveBuildCheckpoint();
+  }
+  const bool keepForResume = build->savedCheckpointPages > 0;
+  build.reset();
+  // Explicitly close() file before calling Storage.remove()
+  file.close();
+  if (keepForResume) {
+    LOG_DBG("SCT", "Keeping partial build of section %d to resume", spineIndex);
+  } else {
+    Storage.remove(buildFilePath().c_str());
+  }
+  resetTables();
+  pageCount = 0;
+}
+
+bool Section::saveBuildCheckpoint() {
+  const auto& checkpoint = build->checkpoint;
+  // The pages a checkpoint covers must be on the card before the checkpoint that points past them
+  if (!build->out.flush()) {
+    return false;
+  }
+  file.flush();
+  if (!writeCheckpointFile(checkpointFilePath(), build->contentSize, build->checkpointPagesEnd, checkpoint, build->lut,
+                           build->visitor->getAnchors(), build->checkpointAnchorCount)) {
+    LOG_ERR("SCT", "Failed to write build checkpoint");
+    discardBuildCheckpoint();
     return false;
   }
-  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-                         viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled);
-  std::vector<PageLutEntry> lut = {};
+  build->savedCheckpointPages = checkpoint.pageCount;
+  build->lastCheckpointSaveMs = millis();
+  LOG_DBG("SCT", "Checkpointed build of section %d at page %u", spineIndex, checkpoint.pageCount);
+  return true;
+}
+
+void Section::discardBuildCheckpoint() {
+  if (build) {
+    build->checkpoint.pageCount = 0;
+    build->savedCheckpointPages = 0;
+  }
+  if (Storage.exists(checkpointFilePath().c_str())) {
+    Storage.remove(checkpointFilePath().c_str());
+  }
+}
+
+bool Section::beginSectionBuild(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
+                                const uint8_t imageRendering, const bool focusReadingEnabled,
+                                const std::function<void()>& popupFn) {
+  const auto localPath = epub->getSpineItem(spineIndex).href;
+  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
+  abandonSectionBuild();
+  resetTables();
+  pageCount = 0;
+
+  const auto sectionsDir = epub->getCachePath() + "/sections";
+  Storage.mkdir(sectionsDir.c_str());
+  // Makes room if this is a new layout for the book
+  SectionLayoutIndex::markUsed(
+      epub->getCachePath(),
+      bindLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+                 hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled));
+
+  // A chapter laid out before under any layout has its content stream, which is laid out again without inflating
+  // or parsing the XHTML. A checkpointed build of this layout is further along, so it resumes from the XHTML instead.
+  size_t contentSize = 0;
+  const bool replayStream = !Storage.exists(checkpointFilePath().c_str()) &&
+                            Storage.exists(contentStreamPath().c_str()) && epub->getItemSize(localPath, &contentSize);
+
+  // Otherwise prefer inflating the chapter straight into the parser. That keeps the inflate window allocated for the
+  // whole parse, so when heap is tight stage the chapter to SD first instead and parse it from there.
+  std::unique_ptr<ZipFile> zipStream;
+  if (!replayStream && ESP.getFreeHeap() >= MIN_FREE_HEAP_FOR_ZIP_STREAM &&
+      ESP.getMaxAllocHeap() >= MIN_MAX_ALLOC_FOR_ZIP_STREAM) {
+    zipStream = epub->openItemStream(localPath, ZIP_STREAM_CHUNK_SIZE, &contentSize);
+  }
+
+  if (replayStream) {
+    LOG_DBG("SCT", "Replaying content stream of %s (%d bytes)", localPath.c_str(), contentSize);
+  } else if (zipStream) {
+    LOG_DBG("SCT", "Streaming %s from EPUB (%d bytes)", localPath.c_str(), contentSize);
+  } else {
+    LOG_DBG("SCT", "Staging %s to SD (free heap %u)", localPath.c_str(), ESP.getFreeHeap());
+    if (!stageItemToFile(localPath, tmpHtmlPath)) {
+      return false;
+    }
+    epub->getItemSize(localPath, &contentSize);
+  }
+
+  // An earlier build of this chapter with the same parameters that was cut short after a checkpoint: keep its pages
+  // up to the checkpoint and resume the parse there
+  ChapterHtmlSlimParser::Checkpoint checkpoint;
+  std::vector<PageLutEntry> resumedLut;
+  std::vector<std::pair<std::string, uint16_t>> resumedAnchors;
+  uint32_t pagesEnd = 0;
+  bool resuming = false;
+  if (!replayStream &&
+      readCheckpointFile(checkpointFilePath(), contentSize, pagesEnd, checkpoint, resumedLut, resumedAnchors)) {
+    file = Storage.open(buildFilePath().c_str(), O_RDWR);
+    if (file) {
+      BufferedFileReader in(file);
+      resuming = headerMatches(in, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                               viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering,
+                               focusReadingEnabled) &&
+                 pagesEnd <= file.size();
+    }
+    // Pages written after the checkpoint are overwritten as the build catches up again
+    if (!resuming || !file.seek(pagesEnd)) {
+      LOG_DBG("SCT", "Ignoring stale build checkpoint");
+      resuming = false;
+      file.close();
+    }
+  }
+  if (!resuming) {
+    discardBuildCheckpoint();
+    // Built at a temp path and renamed once complete; whatever is at filePath is always a finished section
+    if (!Storage.openFileForWrite("SCT", buildFilePath(), file)) {
+      if (!zipStream && !replayStream) {
+        Storage.remove(tmpHtmlPath.c_str());
+      }
+      return false;
+    }
+  }
+  // Pages are serialized record by record; the build's writer batches them into sector-sized writes
+  build.reset(new Build(file));
+  build->zipStream = std::move(zipStream);
+  if (!build->zipStream && !replayStream) {
+    build->tmpHtmlPath = tmpHtmlPath;
+  }
+  build->replayingStream = replayStream;
+  build->contentSize = contentSize;
+  build->lastCheckpointSaveMs = millis();
+  if (resuming) {
+    build->lut = std::move(resumedLut);
+    build->savedCheckpointPages = checkpoint.pageCount;
+    pageCount = checkpoint.pageCount;
+    pageOffsets.reserve(pageCount);
+    for (const auto& entry : build->lut) {
+      pageOffsets.push_back(entry.fileOffset);
+    }
+  } else {
+    writeSectionFileHeader(build->out, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+                           viewportWidth, viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering,
+                           focusReadingEnabled);
+  }
 
   // Derive the content base directory and image cache path prefix for the parser
   size_t lastSlash = localPath.find_last_of('/');
   std::string contentBase = (lastSlash != std::string::npos) ? localPath.substr(0, lastSlash + 1) : "";
   std::string imageBasePath = epub->getCachePath() + "/img_" + std::to_string(spineIndex) + "_";
 
-  CssParser* cssParser = nullptr;
   if (embeddedStyle) {
-    cssParser = epub->getCssParser();
-    if (cssParser) {
-      if (!cssParser->loadFromCache()) {
+    build->cssParser = epub->getCssParser();
+    if (build->cssParser) {
+      if (!build->cssParser->loadFromCache()) {
         LOG_ERR("SCT", "Failed to load CSS from cache");
       }
     }
   }
 
-  ChapterHtmlSlimParser visitor(
-      epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-      viewportHeight, hyphenationEnabled, focusReadingEnabled,
-      [this, &lut](std::unique_ptr<Page> page, const uint16_t paragraphIndex, const uint16_t listItemIndex) {
-        lut.push_back({this->onPageComplete(std::move(page)), paragraphIndex, listItemIndex});
+  Build* const b = build.get();
+  build->visitor.reset(new ChapterHtmlSlimParser(
+      epub, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+      hyphenationEnabled, focusReadingEnabled,
+      [this, b](std::unique_ptr<Page> page, const uint16_t paragraphIndex, const uint16_t listItemIndex) {
+        const uint32_t position = this->onPageComplete(b->out, std::move(page));
+        if (position == 0) {
+          b->pageWriteFailed = true;
+          return;
+        }
+        b->lut.push_back({position, paragraphIndex, listItemIndex});
+        pageOffsets.push_back(position);
       },
-      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, cssParser);
+      embeddedStyle, contentBase, imageBasePath, imageRendering, popupFn, build->cssParser,
+      [this, b](const ChapterHtmlSlimParser::Checkpoint& offered) {
+        if (b->pageWriteFailed) {
+          return;
+        }
+        b->checkpoint = offered;
+        b->checkpointPagesEnd = static_cast<uint32_t>(b->out.position());
+        b->checkpointAnchorCount = b->visitor->getAnchors().size();
+        if (millis() - b->lastCheckpointSaveMs >= CHECKPOINT_INTERVAL_MS) {
+          saveBuildCheckpoint();
+        }
+      }));
   Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
 
-  Storage.remove(tmpHtmlPath.c_str());
-  if (!success) {
-    LOG_ERR("SCT", "Failed to parse XML and build pages");
-    // Explicitly close() file before calling Storage.remove()
-    file.close();
-    Storage.remove(filePath.c_str());
-    if (cssParser) {
-      cssParser->clear();
+  bool started;
+  if (resuming) {
+    LOG_DBG("SCT", "Resuming build of section %d at page %u", spineIndex, checkpoint.pageCount);
+    started = build->zipStream ? build->visitor->resumeParse(*build->zipStream, contentSize, checkpoint,
+                                                             std::move(resumedAnchors))
+                               : build->visitor->resumeParse(tmpHtmlPath, checkpoint, std::move(resumedAnchors));
+  } else if (replayStream) {
+    started = build->visitor->beginReplay(contentStreamPath(), contentSize);
+  } else {
+    // Record the parsed content as it goes, so a later layout change can skip the XHTML
+    Storage.mkdir((epub->getCachePath() + "/content").c_str());
+    build->visitor->recordContentStream(contentStreamPath(), contentSize);
+    started = build->zipStream ? build->visitor->beginParse(*build->zipStream, contentSize)
+                               : build->visitor->beginParse(tmpHtmlPath);
+  }
+  if (!started) {
+    LOG_ERR("SCT", "Failed to start parsing %s", localPath.c_str());
+    discardBuildCheckpoint();
+    abandonSectionBuild();
+    // A checkpoint that can't be resumed is gone now, and so is a content stream that can't be replayed; start over
+    // from the XHTML
+    if (replayStream) {
+      Storage.remove(contentStreamPath().c_str());
+    }
+    if (resuming || replayStream) {
+      return beginSectionBuild(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                               viewportHeight, hyphenationEnabled, embeddedStyle, imageRendering, focusReadingEnabled,
+                               popupFn);
     }
     return false;
   }
+  return true;
+}
 
-  const uint32_t lutOffset = file.position();
-  bool hasFailedLutRecords = false;
-  // Write LUT
-  for (const auto& entry : lut) {
-    if (entry.fileOffset == 0) {
-      hasFailedLutRecords = true;
-      break;
-    }
-    serialization::writePod(file, entry.fileOffset);
+bool Section::continueSectionBuild(const std::function<bool()>& shouldPause) {
+  TRACE_SPAN("section_build");
+  if (!build) {
+    return true;
   }
 
-  if (hasFailedLutRecords) {
-    LOG_ERR("SCT", "Failed to write LUT due to invalid page positions");
-    // Explicitly close() file before calling Storage.remove()
-    file.close();
-    Storage.remove(filePath.c_str());
+  bool done = false;
+  const bool success = build->visitor->parseChunks(shouldPause, done);
+  if (!success || build->pageWriteFailed) {
+    LOG_ERR("SCT", "Failed to parse XML and build pages");
+    // Parse the XHTML next time rather than replaying a stream that failed
+    if (build->replayingStream && !build->pageWriteFailed) {
+      Storage.remove(contentStreamPath().c_str());
+    }
+    discardBuildCheckpoint();
+    abandonSectionBuild();
     return false;
   }
+  if (!done) {
+    return true;
+  }
+  return finishSectionBuild();
+}
+
+bool Section::finishSectionBuild() {
+  // The chapter is fully parsed: release the inflate window before writing the tables
+  build->zipStream.reset();
+  auto& out = build->out;
+  const auto& lut = build->lut;
+
+  lutOffset = out.position();
+  // Write LUT
+  for (const auto& entry : lut) {
+    serialization::writePod(out, entry.fileOffset);
+  }
 
-  // Write anchor-to-page map for fragment navigation (e.g. footnote targets)
-  const uint32_t anchorMapOffset = file.position();
-  const auto& anchors = visitor.getAnchors();
-  serialization::writePod(file, static_cast<uint16_t>(anchors.size()));
-  for (const auto& [anchor, page] : anchors) {
-    serialization::writeString(file, anchor);
-    serialization::writePod(file, page);
+  // Write anchor-to-page map for fragment navigation (e.g. footnote targets) as records sorted by anchor hash.
+  // stable_sort keeps document order among equal hashes, so a repeated id resolves to its first occurrence.
+  anchorMapOffset = out.position();
+  {
+    const auto& anchors = build->visitor->getAnchors();
+    std::vector<std::pair<uint64_t, uint16_t>> anchorIndex;
+    anchorIndex.reserve(anchors.size());
+    for (const auto& [anchor, page] : anchors) {
+      anchorIndex.emplace_back(anchorHash(anchor), page);
+    }
+    std::stable_sort(anchorIndex.begin(), anchorIndex.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    serialization::writePod(out, static_cast<uint16_t>(anchorIndex.size()));
+    for (const auto& [hash, page] : anchorIndex) {
+      serialization::writePod(out, hash);
+      serialization::writePod(out, page);
+    }
   }
 
-  const uint32_t paragraphLutOffset = file.position();
-  serialization::writePod(file, static_cast<uint16_t>(lut.size()));
+  paragraphLutOffset = out.position();
+  serialization::writePod(out, static_cast<uint16_t>(lut.size()));
   for (const auto& entry : lut) {
-    serialization::writePod(file, entry.paragraphIndex);
+    serialization::writePod(out, entry.paragraphIndex);
   }
 
-  const uint32_t liLutFileOffset = static_cast<uint32_t>(file.position());
+  liLutOffset = static_cast<uint32_t>(out.position());
   for (const auto& entry : lut) {
-    serialization::writePod(file, entry.listItemIndex);
+    serialization::writePod(out, entry.listItemIndex);
   }
 
   // Patch header with final pageCount, lutOffset, anchorMapOffset, paragraphLutOffset, and liLutOffset
-  file.seek(HEADER_SIZE - sizeof(uint32_t) * 4 - sizeof(pageCount));
-  serialization::writePod(file, pageCount);
-  serialization::writePod(file, lutOffset);
-  serialization::writePod(file, anchorMapOffset);
-  serialization::writePod(file, paragraphLutOffset);
-  serialization::writePod(file, liLutFileOffset);
-  // Explicit close() required: member variable persists beyond function scope
+  out.seek(HEADER_SIZE - sizeof(uint32_t) * 4 - sizeof(pageCount));
+  serialization::writePod(out, pageCount);
+  serialization::writePod(out, lutOffset);
+  serialization::writePod(out, anchorMapOffset);
+  serialization::writePod(out, paragraphLutOffset);
+  serialization::writePod(out, liLutOffset);
+  const bool writeOk = out.flush();
+  if (!writeOk) {
+    LOG_ERR("SCT", "Failed to write section file");
+    discardBuildCheckpoint();
+    abandonSectionBuild();
+    return false;
+  }
+
+  build.reset();
+  // Explicit close() required: the file is moved into place, then reopened for reading on the next page load.
+  // The page LUT filled in as pages were written stays resident.
   file.close();
-  if (cssParser) {
-    cssParser->clear();
+
+  const auto tmpPath = buildFilePath();
+  if (Storage.exists(filePath.c_str())) {
+    Storage.remove(filePath.c_str());
+  }
+  if (!Storage.rename(tmpPath.c_str(), filePath.c_str())) {
+    LOG_ERR("SCT", "Failed to move finished section into place");
+    Storage.remove(tmpPath.c_str());
+    resetTables();
+    pageCount = 0;
+    return false;
   }
+  discardBuildCheckpoint();
+  LOG_DBG("SCT", "Section %d built: %d pages", spineIndex, pageCount);
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
-  if (!Storage.openFileForRead("SCT", filePath, file)) {
+std::unique_ptr<PageView> Section::loadPageFromSectionFile() { return loadPage(currentPage); }
+
+std::unique_ptr<PageView> Section::loadPage(const int pageNumber) {
+  TRACE_SPAN("page_load");
+  if (!ensureOpen()) {
     return nullptr;
   }
-
-  file.seek(HEADER_SIZE - sizeof(uint32_t) * 4);
-  uint32_t lutOffset;
-  serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
-  uint32_t pagePos;
-  serialization::readPod(file, pagePos);
-  file.seek(pagePos);
-
-  auto page = Page::deserialize(file);
-  // Explicit close() required: member variable persists beyond function scope
-  file.close();
-  return page;
-}
-
-std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) const {
-  FsFile f;
-  if (!Storage.openFileForRead("SCT", filePath, f)) {
-    return std::nullopt;
+  if (pageNumber < 0 || pageNumber >= pageCount) {
+    LOG_ERR("SCT", "Page %d out of range (%d pages)", pageNumber, pageCount);
+    return nullptr;
   }
 
-  const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 3);
-  uint32_t anchorMapOffset;
-  serialization::readPod(f, anchorMapOffset);
-  if (anchorMapOffset == 0 || anchorMapOffset >= fileSize) {
-    return std::nullopt;
+  if (pageOffsets.size() != pageCount) {
+    const size_t lutBytes = sizeof(uint32_t) * pageCount;
+    pageOffsets.resize(pageCount);
+    if (!file.seek(lutOffset) || file.read(pageOffsets.data(), lutBytes) != static_cast<int>(lutBytes)) {
+      LOG_ERR("SCT", "Failed to read page LUT");
+      pageOffsets.clear();
+      return nullptr;
+    }
   }
 
-  f.seek(anchorMapOffset);
-  uint16_t count;
-  serialization::readPod(f, count);
-  for (uint16_t i = 0; i < count; i++) {
-    std::string key;
-    uint16_t page;
-    serialization::readString(f, key);
-    serialization::readPod(f, page);
-    if (key == anchor) {
-      return page;
-    }
+  // While building, the newest page ends where the writer is
+  const uint32_t sectionPagesEnd = build ? static_cast<uint32_t>(build->out.position()) : lutOffset;
+  const uint32_t pageStart = pageOffsets[pageNumber];
+  const uint32_t pageEnd = pageNumber + 1 < pageCount ? pageOffsets[pageNumber + 1] : sectionPagesEnd;
+  if (pageEnd <= pageStart || pageEnd - pageStart > MAX_PAGE_BLOB_SIZE) {
+    LOG_ERR("SCT", "Invalid extent for page %d: %u-%u", pageNumber, pageStart, pageEnd);
+    return nullptr;
   }
 
-  return std::nullopt;
+  // One seek and one read into the buffer the page is rendered from
+  const size_t blobSize = pageEnd - pageStart;
+  auto* blob = static_cast<uint8_t*>(malloc(blobSize));
+  if (!blob) {
+    LOG_ERR("SCT", "Failed to allocate %u bytes for page %d", static_cast<uint32_t>(blobSize), pageNumber);
+    return nullptr;
+  }
+  // A build reads back through its write handle: push out what the writer holds, then return it to the end
+  if (build && !build->out.flush()) {
+    free(blob);
+    return nullptr;
+  }
+  const bool readOk = file.seek(pageStart) && file.read(blob, blobSize) == static_cast<int>(blobSize);
+  if (build) {
+    build->out.seek(sectionPagesEnd);
+  }
+  if (!readOk) {
+    LOG_ERR("SCT", "Failed to read page %d", pageNumber);
+    free(blob);
+    return nullptr;
+  }
+  return PageView::fromBlob(blob, blobSize);
 }
 
-std::optional<uint16_t> Section::getPageForParagraphIndex(const uint16_t pIndex) const {
-  FsFile f;
-  if (!Storage.openFileForRead("SCT", filePath, f)) {
+std::optional<uint16_t> Section::getPageForAnchor(const std::string& anchor) {
+  if (!ensureOpen()) {
     return std::nullopt;
   }
 
-  const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
-  uint32_t paragraphLutOffset;
-  serialization::readPod(f, paragraphLutOffset);
-  if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
+  const uint32_t fileSize = file.size();
+  if (anchorMapOffset == 0 || anchorMapOffset >= fileSize) {
     return std::nullopt;
   }
 
-  f.seek(paragraphLutOffset);
+  BufferedFileReader in(file);
+  in.seek(anchorMapOffset);
   uint16_t count;
-  serialization::readPod(f, count);
-  if (count == 0) {
-    return std::nullopt;
-  }
-
-  const uint32_t lutEnd = paragraphLutOffset + sizeof(uint16_t) + count * sizeof(uint16_t);
-  if (lutEnd > fileSize) {
+  serialization::readPod(in, count);
+  const uint32_t entriesOffset = anchorMapOffset + sizeof(uint16_t);
+  if (count == 0 || entriesOffset + count * ANCHOR_ENTRY_SIZE > fileSize) {
     return std::nullopt;
   }
 
-  uint16_t resultPage = count - 1;
-  for (uint16_t i = 0; i < count; i++) {
-    uint16_t pagePIdx;
-    serialization::readPod(f, pagePIdx);
-    if (pagePIdx >= pIndex) {
-      resultPage = i;
-      break;
+  // Lower bound on the hash; the last few probes land in the same buffered block
+  const uint64_t target = anchorHash(anchor);
+  uint16_t lo = 0;
+  uint16_t hi = count;
+  while (lo < hi) {
+    const uint16_t mid = lo + (hi - lo) / 2;
+    uint64_t hash;
+    in.seek(entriesOffset + mid * ANCHOR_ENTRY_SIZE);
+    serialization::readPod(in, hash);
+    if (hash < target) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
-
-  return resultPage;
-}
-
-std::optional<uint16_t> Section::getParagraphIndexForPage(const uint16_t page) const {
-  FsFile f;
-  if (!Storage.openFileForRead("SCT", filePath, f)) {
+  if (lo == count) {
     return std::nullopt;
   }
 
-  const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
-  uint32_t paragraphLutOffset;
-  serialization::readPod(f, paragraphLutOffset);
-  if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
+  uint64_t hash;
+  uint16_t page;
+  in.seek(entriesOffset + lo * ANCHOR_ENTRY_SIZE);
+  serialization::readPod(in, hash);
+  serialization::readPod(in, page);
+  if (hash != target) {
     return std::nullopt;
   }
+  return page;
+}
 
-  f.seek(paragraphLutOffset);
-  uint16_t count;
-  serialization::readPod(f, count);
-  if (count == 0 || page >= count) {
-    return std::nullopt;
+bool Section::loadLut(const uint32_t offset, std::vector<uint16_t>& lut) {
+  if (!lut.empty()) {
+    return true;
   }
-
-  const uint32_t entryEnd = paragraphLutOffset + sizeof(uint16_t) + (page + 1) * sizeof(uint16_t);
-  if (entryEnd > fileSize) {
-    return std::nullopt;
+  if (pageCount == 0) {
+    return false;
   }
 
-  f.seek(paragraphLutOffset + sizeof(uint16_t) + page * sizeof(uint16_t));
-  uint16_t pIdx;
-  serialization::readPod(f, pIdx);
-  return pIdx;
+  const size_t lutBytes = sizeof(uint16_t) * pageCount;
+  if (offset + lutBytes > file.size()) {
+    return false;
+  }
+  lut.resize(pageCount);
+  if (!file.seek(offset) || file.read(lut.data(), lutBytes) != static_cast<int>(lutBytes)) {
+    LOG_ERR("SCT", "Failed to read LUT at %u", offset);
+    lut.clear();
+    return false;
+  }
+  return true;
 }
 
-std::optional<uint16_t> Section::getPageForListItemIndex(const uint16_t liIndex) const {
-  FsFile f;
-  if (!Storage.openFileForRead("SCT", filePath, f)) {
-    return std::nullopt;
-  }
+// The paragraph and li LUTs hold running counters captured at each page break, so they are non-decreasing and the
+// first page whose value reaches the target is a lower bound.
 
-  const uint32_t fileSize = f.size();
-  f.seek(HEADER_SIZE - sizeof(uint32_t));
-  uint32_t liLutOffset;
-  serialization::readPod(f, liLutOffset);
-  if (liLutOffset == 0 || liLutOffset >= fileSize) {
+std::optional<uint16_t> Section::getPageForParagraphIndex(const uint16_t pIndex) {
+  // Paragraph LUT on disk is a u16 count (== pageCount) followed by one entry per page
+  if (!ensureOpen() || paragraphLutOffset == 0 || !loadLut(paragraphLutOffset + sizeof(uint16_t), paragraphLut)) {
     return std::nullopt;
   }
 
-  // The li LUT shares count with the paragraph LUT; read count from paragraphLutOffset
-  f.seek(HEADER_SIZE - sizeof(uint32_t) * 2);
-  uint32_t paragraphLutOffset;
-  serialization::readPod(f, paragraphLutOffset);
-  if (paragraphLutOffset == 0 || paragraphLutOffset >= fileSize) {
-    return std::nullopt;
-  }
+  const auto it = std::lower_bound(paragraphLut.begin(), paragraphLut.end(), pIndex);
+  return static_cast<uint16_t>(it == paragraphLut.end() ? paragraphLut.size() - 1 : it - paragraphLut.begin());
+}
 
-  f.seek(paragraphLutOffset);
-  uint16_t count;
-  serialization::readPod(f, count);
-  if (count == 0) {
+std::optional<uint16_t> Section::getParagraphIndexForPage(const uint16_t page) {
+  if (!ensureOpen() || paragraphLutOffset == 0 || !loadLut(paragraphLutOffset + sizeof(uint16_t), paragraphLut) ||
+      page >= paragraphLut.size()) {
     return std::nullopt;
   }
+  return paragraphLut[page];
+}
 
-  const uint32_t lutEnd = liLutOffset + count * sizeof(uint16_t);
-  if (lutEnd > fileSize) {
+std::optional<uint16_t> Section::getPageForListItemIndex(const uint16_t liIndex) {
+  if (!ensureOpen() || liLutOffset == 0 || !loadLut(liLutOffset, liLut)) {
     return std::nullopt;
   }
 
-  f.seek(liLutOffset);
-  uint16_t resultPage = count - 1;
-  for (uint16_t i = 0; i < count; i++) {
-    uint16_t pageLiIdx;
-    serialization::readPod(f, pageLiIdx);
-    if (pageLiIdx >= liIndex) {
-      resultPage = i;
-      break;
-    }
-  }
-
-  return resultPage;
+  const auto it = std::lower_bound(liLut.begin(), liLut.end(), liIndex);
+  return static_cast<uint16_t>(it == liLut.end() ? liLut.size() - 1 : it - liLut.begin());
 }
@@ -3,53 +3,111 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Epub.h"
 
+class BufferedFileWriter;
 class Page;
+class PageView;
 class GfxRenderer;
+class ZipFile;
 
 class Section {
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
+  // sections/<spine>_<layout hash>.bin, set from the layout parameters each load or build is given
   std::string filePath;
+  // Held open for reading while the section is on screen, so page turns skip the open and header reads.
+  // During an incremental build it is the handle the build writes to (at the temp path).
   FsFile file;
+  // State of an incremental build in progress (see beginSectionBuild), null otherwise
+  struct Build;
+  std::unique_ptr<Build> build;
+  uint32_t lutOffset = 0;
+  uint32_t anchorMapOffset = 0;
+  uint32_t paragraphLutOffset = 0;
+  uint32_t liLutOffset = 0;
+  // Resident copies of the on-disk LUTs: the page LUT is loaded on the first page load, the paragraph and li LUTs
+  // on their first lookup
+  std::vector<uint32_t> pageOffsets;
+  std::vector<uint16_t> paragraphLut;
+  std::vector<uint16_t> liLut;
 
-  void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
-                              uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
-                              bool embeddedStyle, uint8_t imageRendering, bool focusReadingEnabled);
-  uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void writeSectionFileHeader(BufferedFileWriter& out, int fontId, float lineCompression, bool extraParagraphSpacing,
+                              uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                              bool hyphenationEnabled, bool embeddedStyle, uint8_t imageRendering,
+                              bool focusReadingEnabled);
+  uint32_t onPageComplete(BufferedFileWriter& out, std::unique_ptr<Page> page);
+  // Write the LUTs and patch the header of a build whose parse is done, then move the file to its final path
+  bool finishSectionBuild();
+  std::string buildFilePath() const { return filePath + ".tmp"; }
+  // Resume point of the build at buildFilePath(), written every so often while it runs
+  std::string checkpointFilePath() const { return filePath + ".ckpt"; }
+  // Parsed content of the spine item, shared by every layout (see ChapterContentStream)
+  std::string contentStreamPath() const {
+    return epub->getCachePath() + "/content/" + std::to_string(spineIndex) + ".bin";
+  }
+  // Save the latest resume point the parser offered, with the pages and anchors up to it
+  bool saveBuildCheckpoint();
+  void discardBuildCheckpoint();
+  // Low-heap fallback: inflate the spine item to a temp file on SD for the parser to read back.
+  bool stageItemToFile(const std::string& localPath, const std::string& tmpHtmlPath) const;
+  // Open the section file for reading if it isn't already and read the header offsets. Does not check parameters.
+  bool ensureOpen();
+  // Read one u16-per-page LUT starting at `offset` into `lut`, unless it is already resident
+  bool loadLut(uint32_t offset, std::vector<uint16_t>& lut);
+  void resetTables();
+  // Point filePath at the section file for these layout parameters
+  uint32_t bindLayout(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                      uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
+                      uint8_t imageRendering, bool focusReadingEnabled);
 
  public:
   uint16_t pageCount = 0;
   int currentPage = 0;
 
-  explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
-      : epub(epub),
-        spineIndex(spineIndex),
-        renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
-  ~Section() = default;
+  // Out of line like the destructor: destroying `build` needs the complete Build type
+  explicit Section(const std::shared_ptr<Epub>& epub, int spineIndex, GfxRenderer& renderer);
+  ~Section();
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                        uint8_t imageRendering, bool focusReadingEnabled);
-  bool clearCache() const;
+  bool clearCache();
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                         uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
+                         uint8_t imageRendering, bool focusReadingEnabled,
+                         const std::function<void()>& popupFn = nullptr,
+                         const std::function<bool()>& abortFn = nullptr);
+
+  // Incremental build: beginSectionBuild() opens the chapter and starts the file, then each continueSectionBuild()
+  // lays out pages until shouldPause() returns true (polled between input chunks) or the chapter ends. Pages can be
+  // loaded as soon as pageCount covers them. The file is built at a temp path and only moved into place once its
+  // LUTs and header are complete, so a build cut short (abandoned, failed, power loss) never looks like a section.
+  // Long builds checkpoint periodically; a build cut short after a checkpoint keeps its temp file, and the next
+  // beginSectionBuild() with the same parameters resumes from it. Both return false on failure, which abandons the
+  // build.
+  bool beginSectionBuild(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                          uint8_t imageRendering, bool focusReadingEnabled,
                          const std::function<void()>& popupFn = nullptr);
-  std::unique_ptr<Page> loadPageFromSectionFile();
+  bool continueSectionBuild(const std::function<bool()>& shouldPause = nullptr);
+  bool isBuilding() const { return build != nullptr; }
+  void abandonSectionBuild();
+  std::unique_ptr<PageView> loadPageFromSectionFile();
+  // Load any page of the section without moving currentPage (used for prefetching neighbours).
+  std::unique_ptr<PageView> loadPage(int pageNumber);
 
   // Look up the page number for an anchor id from the section cache file.
-  std::optional<uint16_t> getPageForAnchor(const std::string& anchor) const;
+  std::optional<uint16_t> getPageForAnchor(const std::string& anchor);
 
   // Look up the page number for a synthetic paragraph index from XPath p[N].
-  std::optional<uint16_t> getPageForParagraphIndex(uint16_t pIndex) const;
+  std::optional<uint16_t> getPageForParagraphIndex(uint16_t pIndex);
 
   // Look up the page number for a running list-item index from the li LUT.
-  std::optional<uint16_t> getPageForListItemIndex(uint16_t liIndex) const;
+  std::optional<uint16_t> getPageForListItemIndex(uint16_t liIndex);
 
   // Look up the synthetic paragraph index for the given rendered page.
-  std::optional<uint16_t> getParagraphIndexForPage(uint16_t page) const;
+  std::optional<uint16_t> getParagraphIndexForPage(uint16_t page);
 };
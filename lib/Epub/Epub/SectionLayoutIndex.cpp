@@ -0,0 +1,151 @@
+#include "SectionLayoutIndex.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+constexpr uint8_t LAYOUT_INDEX_FILE_VERSION = 1;
+
+std::string hashSuffix(const uint32_t layoutHash) {
+  char suffix[10];
+  snprintf(suffix, sizeof(suffix), "_%08lx", static_cast<unsigned long>(layoutHash));
+  return suffix;
+}
+
+// Layout hash from a keyed section file name ("<spine>_<hash>.bin" and its build files)
+bool parseLayoutHash(const std::string& name, uint32_t& hash) {
+  const size_t underscore = name.find('_');
+  if (underscore == std::string::npos || name.size() < underscore + 9) {
+    return false;
+  }
+  char* end = nullptr;
+  const std::string hex = name.substr(underscore + 1, 8);
+  hash = static_cast<uint32_t>(strtoul(hex.c_str(), &end, 16));
+  return end == hex.c_str() + 8 && name.compare(underscore + 9, 4, ".bin") == 0;
+}
+
+// Names of the entries in dirPath that `keep` selects. Collected before anything is removed, deleting while
+// iterating a FAT directory skips entries.
+template <typename Pred>
+std::vector<std::string> listFiles(const std::string& dirPath, Pred keep) {
+  std::vector<std::string> names;
+  auto dir = Storage.open(dirPath.c_str());
+  if (dir && dir.isDirectory()) {
+    char name[128];
+    for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+      if (!file.isDirectory()) {
+        file.getName(name, sizeof(name));
+        if (keep(name)) {
+          names.emplace_back(name);
+        }
+      }
+      file.close();
+    }
+  }
+  if (dir) dir.close();
+  return names;
+}
+
+void removeFiles(const std::string& dirPath, const std::vector<std::string>& names) {
+  for (const auto& name : names) {
+    Storage.remove((dirPath + "/" + name).c_str());
+  }
+}
+
+void removeLayoutFiles(const std::string& cachePath, const uint32_t layoutHash) {
+  // Matches the section files of every spine item plus their .tmp and .ckpt build files
+  const std::string key = hashSuffix(layoutHash) + ".bin";
+  const std::string sectionsDir = cachePath + "/sections";
+  removeFiles(sectionsDir, listFiles(sectionsDir, [&key](const char* name) { return strstr(name, key.c_str()); }));
+  Storage.remove(SectionLayoutIndex::pageMapFilePath(cachePath, layoutHash).c_str());
+  LOG_DBG("SLI", "Evicted section files for layout %08lx", static_cast<unsigned long>(layoutHash));
+}
+
+bool loadIndex(const std::string& path, std::vector<uint32_t>& layouts) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("SLI", path, file)) {
+    return false;
+  }
+  BufferedFileReader in(file);
+  uint8_t version = 0;
+  uint8_t count = 0;
+  serialization::readPod(in, version);
+  serialization::readPod(in, count);
+  if (version != LAYOUT_INDEX_FILE_VERSION || count > SectionLayoutIndex::MAX_LAYOUTS) {
+    return false;
+  }
+  layouts.resize(count);
+  const size_t bytes = sizeof(uint32_t) * count;
+  return in.read(layouts.data(), bytes) == static_cast<int>(bytes);
+}
+
+bool saveIndex(const std::string& path, const std::vector<uint32_t>& layouts) {
+  FsFile file;
+  if (!Storage.openFileForWrite("SLI", path, file)) {
+    return false;
+  }
+  BufferedFileWriter out(file);
+  serialization::writePod(out, LAYOUT_INDEX_FILE_VERSION);
+  serialization::writePod(out, static_cast<uint8_t>(layouts.size()));
+  out.write(layouts.data(), sizeof(uint32_t) * layouts.size());
+  return out.flush();
+}
+}  // namespace
+
+std::string SectionLayoutIndex::sectionFilePath(const std::string& cachePath, const int spineIndex,
+                                                const uint32_t layoutHash) {
+  return cachePath + "/sections/" + std::to_string(spineIndex) + hashSuffix(layoutHash) + ".bin";
+}
+
+std::string SectionLayoutIndex::pageMapFilePath(const std::string& cachePath, const uint32_t layoutHash) {
+  return cachePath + "/pagemap" + hashSuffix(layoutHash) + ".bin";
+}
+
+void SectionLayoutIndex::markUsed(const std::string& cachePath, const uint32_t layoutHash) {
+  // Read every time rather than remembered: the book cache or its sections/ directory can be removed behind the
+  // index (Delete cache, a CSS change, the cache size budget), and the index must be rewritten after that
+  const std::string sectionsDir = cachePath + "/sections";
+  const std::string indexPath = sectionsDir + "/layouts.bin";
+
+  std::vector<uint32_t> layouts;
+  if (!loadIndex(indexPath, layouts)) {
+    // Rebuild from the file names: keyed section files are adopted (in no particular order), files from before
+    // sections were keyed by layout are removed since nothing would ever evict them
+    LOG_DBG("SLI", "No layout index, rebuilding from %s", sectionsDir.c_str());
+    layouts.clear();
+    std::vector<std::string> legacy;
+    for (const auto& name : listFiles(sectionsDir, [](const char*) { return true; })) {
+      uint32_t hash;
+      if (parseLayoutHash(name, hash)) {
+        if (std::find(layouts.begin(), layouts.end(), hash) == layouts.end()) {
+          layouts.push_back(hash);
+        }
+      } else {
+        legacy.push_back(name);
+      }
+    }
+    removeFiles(sectionsDir, legacy);
+    Storage.remove((cachePath + "/pagemap.bin").c_str());
+  }
+
+  if (layouts.empty() || layouts.front() != layoutHash) {
+    layouts.erase(std::remove(layouts.begin(), layouts.end(), layoutHash), layouts.end());
+    layouts.insert(layouts.begin(), layoutHash);
+    while (layouts.size() > MAX_LAYOUTS) {
+      removeLayoutFiles(cachePath, layouts.back());
+      layouts.pop_back();
+    }
+    Storage.mkdir(sectionsDir.c_str());
+    if (!saveIndex(indexPath, layouts)) {
+      LOG_ERR("SLI", "Failed to write layout index");
+      Storage.remove(indexPath.c_str());
+    }
+  }
+}
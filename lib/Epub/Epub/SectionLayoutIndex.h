@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Section files and page maps are keyed by a hash of the layout they were built for, so switching orientation or
+// font size and back again finds the earlier layout's files still on SD. This index (sections/layouts.bin) lists the
+// layouts a book has files for, most recently used first, and deletes the files of the least recently used one once
+// more than MAX_LAYOUTS are kept. Whole books are evicted by the cache manager's size budget on top of that.
+class SectionLayoutIndex {
+ public:
+  static constexpr uint8_t MAX_LAYOUTS = 3;
+
+  static std::string sectionFilePath(const std::string& cachePath, int spineIndex, uint32_t layoutHash);
+  static std::string pageMapFilePath(const std::string& cachePath, uint32_t layoutHash);
+
+  // Move a layout to the front of the book's index, evicting the files of whichever layout drops off the end.
+  // A book without a readable index has it rebuilt from the section file names first.
+  static void markUsed(const std::string& cachePath, uint32_t layoutHash);
+};
@@ -1,6 +1,6 @@
 #pragma once
+#include <BufferedFile.h>
 #include <EpdFontFamily.h>
-#include <HalStorage.h>
 
 #include <memory>
 #include <string>
@@ -44,9 +44,9 @@ class TextBlock final : public Block {
   const std::vector<std::string>& getWords() const { return words; }
   bool isEmpty() override { return words.empty(); }
   size_t wordCount() const { return words.size(); }
-  // given a renderer works out where to break the words into lines
-  void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
+  // Page blob writers (see PageView.h): fixed-size word records pointing into the page's string pool starting at
+  // poolOffset, then the NUL-terminated word text in the same order
+  bool writeWordRecords(BufferedFileWriter& file, uint16_t& poolOffset) const;
+  bool writeWordText(BufferedFileWriter& file) const;
 };
@@ -16,6 +16,8 @@ struct DirectPixelWriter {
   uint8_t* fb;
   GfxRenderer::RenderMode mode;
   uint16_t displayWidthBytes;  // Runtime framebuffer stride (X4: 100, X3: 99)
+  uint8_t* const* lsbRows;     // Gray plane rows of a BW_AND_GRAYSCALE pass
+  uint8_t* const* msbRows;
 
   // Orientation is collapsed into a linear transform:
   //   phyX = phyXBase + x * phyXStepX + y * phyXStepY
@@ -31,6 +33,11 @@ struct DirectPixelWriter {
     fb = renderer.getFrameBuffer();
     mode = renderer.getRenderMode();
     displayWidthBytes = renderer.getDisplayWidthBytes();
+    lsbRows = renderer.getGrayLsbRows();
+    msbRows = renderer.getGrayMsbRows();
+    if (mode == GfxRenderer::BW_AND_GRAYSCALE && (!lsbRows || !msbRows)) {
+      mode = GfxRenderer::BW;
+    }
 
     const int phyW = renderer.getDisplayWidth();
     const int phyH = renderer.getDisplayHeight();
@@ -111,6 +118,21 @@ struct DirectPixelWriter {
         draw = (pixelValue == 1);
         state = false;
         break;
+      case GfxRenderer::BW_AND_GRAYSCALE:
+        // All three planes at once: black unless white, dark gray marks LSB and MSB, light gray only MSB
+        if (pixelValue < 3) {
+          const int phyX = rowPhyXBase + logicalX * phyXStepX;
+          const int phyY = rowPhyYBase + logicalX * phyYStepX;
+          const uint8_t bitMask = 1 << (7 - (phyX & 7));
+          fb[phyY * displayWidthBytes + (phyX >> 3)] &= ~bitMask;
+          if (pixelValue == 1) {
+            lsbRows[phyY][phyX >> 3] |= bitMask;
+          }
+          if (pixelValue != 0) {
+            msbRows[phyY][phyX >> 3] |= bitMask;
+          }
+        }
+        return;
       default:
         return;
     }
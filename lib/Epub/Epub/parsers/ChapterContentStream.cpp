@@ -0,0 +1,227 @@
+#include "ChapterContentStream.h"
+
+#include <BufferedFile.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChapterContentStream {
+namespace {
+constexpr uint8_t CONTENT_STREAM_FILE_VERSION = 1;
+// The attributes ChapterHtmlSlimParser looks at; the rest are not recorded
+constexpr const char* KEPT_ATTRIBUTES[] = {"class", "style", "id", "src", "alt", "href", "role", "epub:type"};
+constexpr size_t MAX_ATTRIBUTES = 16;
+
+bool isKeptAttribute(const char* name) {
+  return std::any_of(std::begin(KEPT_ATTRIBUTES), std::end(KEPT_ATTRIBUTES),
+                     [name](const char* kept) { return strcmp(name, kept) == 0; });
+}
+
+std::string tempPath(const std::string& path) { return path + ".tmp"; }
+
+void writeShortString(BufferedFileWriter& out, const char* s) {
+  const auto len = static_cast<uint8_t>(std::min<size_t>(strlen(s), UINT8_MAX));
+  serialization::writePod(out, len);
+  out.write(s, len);
+}
+
+bool readShortString(BufferedFileReader& in, std::string& s) {
+  const int len = in.read();
+  if (len < 0) {
+    return false;
+  }
+  s.resize(len);
+  return in.read(&s[0], len) == len;
+}
+}  // namespace
+
+Writer::~Writer() { discard(); }
+
+bool Writer::open(const std::string& logPath, const uint32_t sourceSize) {
+  discard();
+  if (!Storage.openFileForWrite("CCS", tempPath(logPath), file)) {
+    return false;
+  }
+  path = logPath;
+  out.reset(new BufferedFileWriter(file));
+  serialization::writePod(*out, CONTENT_STREAM_FILE_VERSION);
+  serialization::writePod(*out, sourceSize);
+  depth = 0;
+  skipUntilDepth = -1;
+  return true;
+}
+
+void Writer::startElement(const char* name, const char** atts) {
+  if (!out) {
+    return;
+  }
+  depth++;
+  if (skipUntilDepth >= 0 && depth > skipUntilDepth) {
+    return;
+  }
+  if (strcmp(name, "head") == 0) {
+    skipUntilDepth = depth;
+  }
+
+  uint8_t attCount = 0;
+  for (int i = 0; atts && atts[i] && attCount < MAX_ATTRIBUTES; i += 2) {
+    attCount += isKeptAttribute(atts[i]) ? 1 : 0;
+  }
+  serialization::writePod(*out, Event::StartElement);
+  writeShortString(*out, name);
+  serialization::writePod(*out, attCount);
+  for (int i = 0; atts && atts[i] && attCount > 0; i += 2) {
+    if (!isKeptAttribute(atts[i])) {
+      continue;
+    }
+    writeShortString(*out, atts[i]);
+    const auto len = static_cast<uint16_t>(std::min<size_t>(strlen(atts[i + 1]), UINT16_MAX));
+    serialization::writePod(*out, len);
+    out->write(atts[i + 1], len);
+    attCount--;
+  }
+}
+
+void Writer::characters(const char* s, const int len) {
+  if (!out || (skipUntilDepth >= 0 && depth >= skipUntilDepth) || len <= 0) {
+    return;
+  }
+  // expat hands over at most a parse buffer's worth at a time, far below the record limit
+  const auto recordLen = static_cast<uint16_t>(std::min(len, static_cast<int>(UINT16_MAX)));
+  serialization::writePod(*out, Event::Characters);
+  serialization::writePod(*out, recordLen);
+  out->write(s, recordLen);
+}
+
+void Writer::endElement(const char* name) {
+  if (!out) {
+    return;
+  }
+  const bool inSkip = skipUntilDepth >= 0 && depth > skipUntilDepth;
+  if (depth == skipUntilDepth) {
+    skipUntilDepth = -1;
+  }
+  depth--;
+  if (inSkip) {
+    return;
+  }
+  serialization::writePod(*out, Event::EndElement);
+  writeShortString(*out, name);
+}
+
+bool Writer::finish() {
+  if (!out) {
+    return false;
+  }
+  serialization::writePod(*out, Event::End);
+  const bool ok = out->flush();
+  out.reset();
+  file.close();
+  if (ok && Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+  if (!ok || !Storage.rename(tempPath(path).c_str(), path.c_str())) {
+    LOG_ERR("CCS", "Failed to write content stream %s", path.c_str());
+    Storage.remove(tempPath(path).c_str());
+    path.clear();
+    return false;
+  }
+  LOG_DBG("CCS", "Recorded content stream %s", path.c_str());
+  path.clear();
+  return true;
+}
+
+void Writer::discard() {
+  if (!out) {
+    return;
+  }
+  out.reset();
+  // Explicitly close() file before calling Storage.remove()
+  file.close();
+  Storage.remove(tempPath(path).c_str());
+  path.clear();
+}
+
+Reader::~Reader() {
+  in.reset();
+  if (file) {
+    file.close();
+  }
+}
+
+bool Reader::open(const std::string& path, const uint32_t sourceSize) {
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("CCS", path, file)) {
+    return false;
+  }
+  in.reset(new BufferedFileReader(file));
+  uint8_t version = 0;
+  uint32_t fileSourceSize = 0;
+  serialization::readPod(*in, version);
+  serialization::readPod(*in, fileSourceSize);
+  if (version != CONTENT_STREAM_FILE_VERSION || fileSourceSize != sourceSize) {
+    LOG_DBG("CCS", "Ignoring stale content stream %s", path.c_str());
+    in.reset();
+    file.close();
+    return false;
+  }
+  attStrings.reserve(MAX_ATTRIBUTES * 2);
+  return true;
+}
+
+bool Reader::next(Event& event) {
+  const int type = in ? in->read() : -1;
+  if (type < 0) {
+    LOG_ERR("CCS", "Content stream ended without an end record");
+    return false;
+  }
+  event = static_cast<Event>(type);
+  switch (event) {
+    case Event::StartElement: {
+      if (!readShortString(*in, nameBuf)) {
+        return false;
+      }
+      const int attCount = in->read();
+      if (attCount < 0 || attCount > static_cast<int>(MAX_ATTRIBUTES)) {
+        return false;
+      }
+      attStrings.resize(attCount * 2);
+      for (int i = 0; i < attCount; i++) {
+        uint16_t len = 0;
+        if (!readShortString(*in, attStrings[i * 2])) {
+          return false;
+        }
+        serialization::readPod(*in, len);
+        attStrings[i * 2 + 1].resize(len);
+        if (in->read(&attStrings[i * 2 + 1][0], len) != len) {
+          return false;
+        }
+      }
+      // Pointers are taken only once every string is in place
+      attPtrs.clear();
+      for (const auto& s : attStrings) {
+        attPtrs.push_back(s.c_str());
+      }
+      attPtrs.push_back(nullptr);
+      return true;
+    }
+    case Event::Characters: {
+      uint16_t len = 0;
+      serialization::readPod(*in, len);
+      text.resize(len);
+      return in->read(&text[0], len) == len;
+    }
+    case Event::EndElement:
+      return readShortString(*in, nameBuf);
+    case Event::End:
+      return true;
+  }
+  LOG_ERR("CCS", "Unknown content stream record %d", type);
+  return false;
+}
+
+size_t Reader::size() const { return in ? in->size() : 0; }
+
+size_t Reader::position() const { return in ? in->position() : 0; }
+}  // namespace ChapterContentStream
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class BufferedFileReader;
+class BufferedFileWriter;
+
+// Log of the element and text events expat reported for a chapter, kept in the book cache (content/<spine>.bin)
+// so that laying the chapter out again for another font, margin or alignment can feed ChapterHtmlSlimParser from it
+// instead of inflating the XHTML and parsing it. Entities are already expanded, attributes the parser never reads
+// are dropped, and so is everything inside <head>. Text events keep expat's chunking, so a replay makes exactly the
+// same handler calls as the original parse. Nothing in the log depends on reader settings: CSS is resolved again
+// on each replay.
+namespace ChapterContentStream {
+enum class Event : uint8_t { StartElement = 'S', Characters = 'C', EndElement = 'E', End = 'Z' };
+
+class Writer {
+  FsFile file;
+  std::unique_ptr<BufferedFileWriter> out;
+  std::string path;
+  int depth = 0;
+  int skipUntilDepth = -1;  // depth of an open <head>, whose content is not recorded
+
+ public:
+  ~Writer();
+  // Start recording; the log is written next to `path` and only moved there by finish()
+  bool open(const std::string& path, uint32_t sourceSize);
+  void startElement(const char* name, const char** atts);
+  void characters(const char* s, int len);
+  void endElement(const char* name);
+  // Seal the log and move it into place. Returns false (and removes it) if any write failed.
+  bool finish();
+  // Drop a log that won't be completed
+  void discard();
+};
+
+class Reader {
+  FsFile file;
+  std::unique_ptr<BufferedFileReader> in;
+  std::string nameBuf;
+  std::vector<std::string> attStrings;
+  std::vector<const char*> attPtrs;
+  std::string text;
+
+ public:
+  ~Reader();
+  // Fails if the log is missing or was recorded from a different version of the chapter
+  bool open(const std::string& path, uint32_t sourceSize);
+  // Next event, or End at the end of the log. Returns false on a read error or a malformed record.
+  bool next(Event& event);
+  size_t size() const;
+  size_t position() const;
+
+  // Valid until the next call to next()
+  const char* name() const { return nameBuf.c_str(); }
+  const char** atts() { return attPtrs.data(); }
+  const char* data() const { return text.data(); }
+  int length() const { return static_cast<int>(text.size()); }
+};
+}  // namespace ChapterContentStream
@@ -6,8 +6,10 @@
 #include <Logging.h>
 #include <Utf8.h>
 #include <XmlParserUtils.h>
+#include <ZipFile.h>
 #include <expat.h>
 
+#include <algorithm>
 #include <iterator>
 
 #include "../../Epub.h"
@@ -19,6 +21,10 @@
 // Minimum file size (in bytes) to show indexing popup - smaller chapters don't benefit from it
 constexpr size_t MIN_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
 constexpr size_t PARSE_BUFFER_SIZE = 1024;
+// Checkpoints need the ancestors' start tags; blocks nested deeper than this are not resume points
+constexpr int MAX_CHECKPOINT_DEPTH = 16;
+// Longer prologs (large internal DTD subsets) disable checkpoints rather than bloat every checkpoint file
+constexpr int64_t MAX_PROLOG_SIZE = 2048;
 
 constexpr const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
 constexpr const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
@@ -65,6 +71,23 @@ bool isTableStructuralTag(const char* name) {
   return strcmp(name, "table") == 0 || strcmp(name, "tr") == 0 || strcmp(name, "td") == 0 || strcmp(name, "th") == 0;
 }
 
+// Read and drop `count` bytes of input, keeping the first prolog.size() of them in `prolog`
+bool skipInput(const std::function<int(void* buf, size_t len)>& readChunk, const uint32_t count, std::string& prolog) {
+  uint8_t buf[PARSE_BUFFER_SIZE];
+  uint32_t skipped = 0;
+  while (skipped < count) {
+    const int len = readChunk(buf, std::min<size_t>(sizeof(buf), count - skipped));
+    if (len <= 0) {
+      return false;
+    }
+    if (skipped < prolog.size()) {
+      memcpy(&prolog[skipped], buf, std::min<size_t>(len, prolog.size() - skipped));
+    }
+    skipped += len;
+  }
+  return true;
+}
+
 // Update effective bold/italic/underline based on block style and inline style stack
 void ChapterHtmlSlimParser::updateEffectiveInlineStyle() {
   // Start with block-level styles
@@ -126,23 +149,76 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
       // the container's vertical spacing.
       const auto style = currentTextBlock->getBlockStyle();
       currentTextBlock->setBlockStyle(style.getCombinedBlockStyle(blockStyle, BlockStyle::CombineAxis::Vertical));
-
-      if (!pendingAnchorId.empty()) {
-        anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
-        pendingAnchorId.clear();
-      }
+      recordPendingAnchor();
       return;
     }
 
     makePages();
   }
   // Record deferred anchor after previous block is flushed
-  if (!pendingAnchorId.empty()) {
-    anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
-    pendingAnchorId.clear();
-  }
+  recordPendingAnchor();
   currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, focusReadingEnabled, blockStyle));
   wordsExtractedInBlock = 0;
+  linesPlacedInBlock = 0;
+  // A checkpoint taken at this block's start tag now belongs to the block
+  blockCheckpointValid = pendingCheckpointValid;
+  if (pendingCheckpointValid) {
+    std::swap(blockCheckpoint, pendingCheckpoint);
+    pendingCheckpointValid = false;
+  }
+}
+
+void ChapterHtmlSlimParser::recordPendingAnchor() {
+  if (pendingAnchorId.empty()) {
+    return;
+  }
+  // Anchors met between a resumed block's start tag and its layout were saved with the checkpoint
+  if (!resumedBlockPending) {
+    anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
+  }
+  pendingAnchorId.clear();
+}
+
+// Rebuild an element's start tag from expat's parsed attributes, escaped so that parsing it again yields the same
+// values
+void ChapterHtmlSlimParser::recordOpenTag(const XML_Char* name, const XML_Char** atts) {
+  if (openTags.size() <= static_cast<size_t>(depth)) {
+    openTags.resize(depth + 1);
+  }
+  std::string& tag = openTags[depth];
+  tag = "<";
+  tag += name;
+  for (int i = 0; atts && atts[i]; i += 2) {
+    tag += ' ';
+    tag += atts[i];
+    tag += "=\"";
+    for (const char* c = atts[i + 1]; *c; c++) {
+      switch (*c) {
+        case '&':
+          tag += "&amp;";
+          break;
+        case '<':
+          tag += "&lt;";
+          break;
+        case '"':
+          tag += "&quot;";
+          break;
+        case '\t':
+          tag += "&#9;";
+          break;
+        case '\n':
+          tag += "&#10;";
+          break;
+        case '\r':
+          tag += "&#13;";
+          break;
+        default:
+          tag += *c;
+      }
+    }
+    tag += '"';
+  }
+  tag += '>';
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
@@ -154,6 +230,40 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
+  // Checkpoints: keep this start tag in case it becomes an ancestor of one, and snapshot the state here if this
+  // element opens a block the parse could later resume at
+  if (self->checkpointFn) {
+    if (self->depth == 0 && !self->replaying) {
+      const int64_t rootOffset = XML_GetCurrentByteIndex(self->xmlParser) + self->inputBaseOffset;
+      if (rootOffset > MAX_PROLOG_SIZE) {
+        self->checkpointsEnabled = false;
+      }
+      self->prologSize = static_cast<uint16_t>(std::min(rootOffset, MAX_PROLOG_SIZE));
+    }
+    if (self->depth < MAX_CHECKPOINT_DEPTH) {
+      self->recordOpenTag(name, atts);
+    }
+    self->pendingCheckpointValid = false;
+    // Only where the previous block is complete and this one starts clean: nothing from before the tag is carried
+    // into the new block, so the parse state is just the ancestors and a few counters
+    if (self->checkpointsEnabled && !self->replaying && self->depth < MAX_CHECKPOINT_DEPTH && isHeaderOrBlock(name) &&
+        strcmp(name, "br") != 0 && self->tableDepth == 0 && self->skipUntilDepth == INT_MAX &&
+        !self->insideFootnoteLink && self->partWordBufferIndex == 0 && self->currentTextBlock &&
+        !self->currentTextBlock->isEmpty()) {
+      Checkpoint& cp = self->pendingCheckpoint;
+      cp.inputOffset = static_cast<uint32_t>(XML_GetCurrentByteIndex(self->xmlParser) + self->inputBaseOffset);
+      cp.xpathParagraphIndex = self->xpathParagraphIndex;
+      cp.xpathListItemIndex = self->xpathListItemIndex;
+      cp.imageCounter = static_cast<uint32_t>(self->imageCounter);
+      cp.prologSize = self->prologSize;
+      cp.openTags.clear();
+      for (int i = 0; i < self->depth; i++) {
+        cp.openTags += self->openTags[i];
+      }
+      self->pendingCheckpointValid = true;
+    }
+  }
+
   if (strcmp(name, "p") == 0) {
     self->xpathParagraphIndex++;
   }
@@ -310,10 +420,13 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
             }
             std::string cachedImagePath = self->imageBasePath + std::to_string(self->imageCounter++) + ext;
 
-            // Extract image to cache file
+            // Extract image to cache file. A replayed layout reuses what the recorded parse extracted, so it
+            // never touches the EPUB.
             FsFile cachedImageFile;
             bool extractSuccess = false;
-            if (Storage.openFileForWrite("EHP", cachedImagePath, cachedImageFile)) {
+            if (self->streamReplay && Storage.exists(cachedImagePath.c_str())) {
+              extractSuccess = true;
+            } else if (Storage.openFileForWrite("EHP", cachedImagePath, cachedImageFile)) {
               extractSuccess = self->epub->readItemContentsToStream(resolvedPath, cachedImageFile, 4096);
               cachedImageFile.flush();
               cachedImageFile.close();
@@ -487,6 +600,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
                 }
                 self->currentPage->elements.push_back(pageImage);
                 self->currentPageNextY += displayHeight + imageMarginBottom;
+                // Resuming at the block's start tag would place the image again
+                self->blockCheckpointValid = false;
 
                 // The image consumed the empty block's accumulated vertical spacing.
                 // Reset the block so the Vertical merge in startNewTextBlock doesn't
@@ -885,6 +1000,7 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
   // Spotted when reading Intermezzo, there are some really long text blocks in there.
   if (self->currentTextBlock->size() > 750) {
     LOG_DBG("EHP", "Text block too long, splitting into multiple pages");
+    self->resumedBlockPending = false;
     const int horizontalInset = self->currentTextBlock->getBlockStyle().totalHorizontalInset();
     const uint16_t effectiveWidth = (horizontalInset < self->viewportWidth)
                                         ? static_cast<uint16_t>(self->viewportWidth - horizontalInset)
@@ -895,22 +1011,55 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
   }
 }
 
+void XMLCALL ChapterHtmlSlimParser::xmlDecl(void* userData, const XML_Char* /*version*/, const XML_Char* encoding,
+                                            int /*standalone*/) {
+  auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  // Ancestor tags are replayed as UTF-8 on resume
+  if (encoding && strcasecmp(encoding, "UTF-8") != 0 && strcasecmp(encoding, "UTF8") != 0) {
+    self->checkpointsEnabled = false;
+  }
+}
+
 void XMLCALL ChapterHtmlSlimParser::defaultHandlerExpand(void* userData, const XML_Char* s, const int len) {
   // Check if this looks like an entity reference (&...;)
   if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
     const char* utf8Value = lookupHtmlEntity(s, static_cast<size_t>(len));
     if (utf8Value != nullptr) {
       // Known entity: expand to its UTF-8 value
-      characterData(userData, utf8Value, strlen(utf8Value));
+      xmlCharacterData(userData, utf8Value, strlen(utf8Value));
       return;
     }
     // Unknown entity: preserve original &...; sequence
-    characterData(userData, s, len);
+    xmlCharacterData(userData, s, len);
     return;
   }
   // Not an entity we recognize - skip it
 }
 
+void XMLCALL ChapterHtmlSlimParser::xmlStartElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+  auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  if (self->streamRecorder) {
+    self->streamRecorder->startElement(name, atts);
+  }
+  startElement(userData, name, atts);
+}
+
+void XMLCALL ChapterHtmlSlimParser::xmlCharacterData(void* userData, const XML_Char* s, const int len) {
+  auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  if (self->streamRecorder) {
+    self->streamRecorder->characters(s, len);
+  }
+  characterData(userData, s, len);
+}
+
+void XMLCALL ChapterHtmlSlimParser::xmlEndElement(void* userData, const XML_Char* name) {
+  auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
+  if (self->streamRecorder) {
+    self->streamRecorder->endElement(name);
+  }
+  endElement(userData, name);
+}
+
 void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
@@ -1032,7 +1181,129 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 }
 
-bool ChapterHtmlSlimParser::parseAndBuildPages() {
+ChapterHtmlSlimParser::~ChapterHtmlSlimParser() { endParse(); }
+
+bool ChapterHtmlSlimParser::beginParse(ZipFile& zip, const size_t contentSize) {
+  endParse();
+  if (!zip.isStreaming()) {
+    LOG_ERR("EHP", "No entry stream open");
+    return false;
+  }
+  return beginParse([&zip](void* buf, const size_t len) { return zip.readStream(static_cast<uint8_t*>(buf), len); },
+                    contentSize);
+}
+
+bool ChapterHtmlSlimParser::beginParse(const std::string& filepath) {
+  endParse();
+  if (!Storage.openFileForRead("EHP", filepath, stagedFile)) {
+    return false;
+  }
+
+  return beginParse([this](void* buf, const size_t len) { return readStagedChunk(buf, len); }, stagedFile.size());
+}
+
+int ChapterHtmlSlimParser::readStagedChunk(void* buf, const size_t len) {
+  const int read = stagedFile.read(buf, len);
+  if (read == 0 && stagedFile.available() > 0) {
+    LOG_ERR("EHP", "File read error");
+    return -1;
+  }
+  return read;
+}
+
+bool ChapterHtmlSlimParser::resumeParse(ZipFile& zip, const size_t contentSize, const Checkpoint& from,
+                                        std::vector<std::pair<std::string, uint16_t>> anchors) {
+  endParse();
+  if (!zip.isStreaming()) {
+    LOG_ERR("EHP", "No entry stream open");
+    return false;
+  }
+  std::function<int(void* buf, size_t len)> readChunkFn = [&zip](void* buf, const size_t len) {
+    return zip.readStream(static_cast<uint8_t*>(buf), len);
+  };
+  // There is no seeking in a deflate stream: inflate up to the checkpoint, which still costs far less than laying
+  // those pages out again
+  std::string prolog(from.prologSize, '\0');
+  if (from.inputOffset > contentSize || from.prologSize > from.inputOffset ||
+      !skipInput(readChunkFn, from.inputOffset, prolog)) {
+    LOG_ERR("EHP", "Failed to reach checkpoint at byte %u", from.inputOffset);
+    return false;
+  }
+  return resumeParse(std::move(readChunkFn), contentSize, from, std::move(anchors), prolog);
+}
+
+bool ChapterHtmlSlimParser::resumeParse(const std::string& filepath, const Checkpoint& from,
+                                        std::vector<std::pair<std::string, uint16_t>> anchors) {
+  endParse();
+  if (!Storage.openFileForRead("EHP", filepath, stagedFile)) {
+    return false;
+  }
+  const size_t contentSize = stagedFile.size();
+  std::string prolog(from.prologSize, '\0');
+  if (from.inputOffset > contentSize || from.prologSize > from.inputOffset ||
+      stagedFile.read(&prolog[0], prolog.size()) != static_cast<int>(prolog.size()) ||
+      !stagedFile.seek(from.inputOffset)) {
+    LOG_ERR("EHP", "Failed to reach checkpoint at byte %u", from.inputOffset);
+    stagedFile.close();
+    return false;
+  }
+  return resumeParse([this](void* buf, const size_t len) { return readStagedChunk(buf, len); }, contentSize, from,
+                     std::move(anchors), prolog);
+}
+
+bool ChapterHtmlSlimParser::resumeParse(std::function<int(void* buf, size_t len)> readChunkFn,
+                                        const size_t contentSize, const Checkpoint& from,
+                                        std::vector<std::pair<std::string, uint16_t>> anchors,
+                                        const std::string& prolog) {
+  const auto lead = static_cast<uint8_t>(prolog.empty() ? '<' : prolog[0]);
+  if (lead == 0x00 || lead == 0xFE || lead == 0xFF) {
+    LOG_ERR("EHP", "Can't resume a UTF-16 chapter");
+    endParse();
+    return false;
+  }
+  // A stream recorded from here would miss the start of the chapter
+  recordPath.clear();
+  if (!beginParse(std::move(readChunkFn), contentSize - from.inputOffset)) {
+    return false;
+  }
+
+  // Rebuild the open element stack, and with it the inherited block and inline styles, by parsing the prolog and
+  // the ancestors' start tags again
+  const std::string replay = prolog + from.openTags;
+  replaying = true;
+  const bool replayed =
+      XML_Parse(xmlParser, replay.data(), static_cast<int>(replay.size()), XML_FALSE) != XML_STATUS_ERROR;
+  replaying = false;
+  if (!replayed) {
+    LOG_ERR("EHP", "Failed to replay checkpoint: %s", XML_ErrorString(XML_GetErrorCode(xmlParser)));
+    endParse();
+    return false;
+  }
+  inputBaseOffset = static_cast<int64_t>(from.inputOffset) - static_cast<int64_t>(replay.size());
+  prologSize = from.prologSize;
+  checkpointsEnabled = checkpointFn != nullptr;
+
+  // Whatever the replay laid out or counted was accounted for before the checkpoint
+  currentTextBlock.reset();
+  currentPage.reset();
+  currentPageNextY = 0;
+  partWordBufferIndex = 0;
+  nextWordContinues = false;
+  pendingFootnotes.clear();
+  pendingAnchorId.clear();
+  anchorData = std::move(anchors);
+  completedPageCount = from.pageCount;
+  xpathParagraphIndex = from.xpathParagraphIndex;
+  xpathListItemIndex = from.xpathListItemIndex;
+  imageCounter = static_cast<int>(from.imageCounter);
+  pendingCheckpointValid = false;
+  blockCheckpointValid = false;
+  resumedBlockPending = true;
+  LOG_DBG("EHP", "Resuming at byte %u with %u pages done", from.inputOffset, from.pageCount);
+  return true;
+}
+
+void ChapterHtmlSlimParser::beginLayout(const size_t contentSize) {
   // Initialize block style stack with a root entry representing "no ancestor block elements".
   // The user's paragraph alignment is set as the default so child elements without explicit
   // text-align inherit it correctly through getCombinedBlockStyle.
@@ -1050,82 +1321,196 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   paragraphAlignmentBlockStyle.alignment = align;
   startNewTextBlock(paragraphAlignmentBlockStyle);
 
-  XML_Parser parser = XML_ParserCreate(nullptr);
-  int done;
+  // Use the content size to decide whether to show indexing popup.
+  if (popupFn && contentSize >= MIN_SIZE_FOR_POPUP) {
+    popupFn();
+  }
+
+  checkpointsEnabled = checkpointFn != nullptr;
+  replaying = false;
+  resumedBlockPending = false;
+  inputBaseOffset = 0;
+  prologSize = 0;
+  pendingCheckpointValid = false;
+  blockCheckpointValid = false;
+
+  // Compute the time taken to parse and build pages, and how many word widths came from the cache
+  parseStartTime = millis();
+  renderer.getWordWidthCache().resetStats();
+}
+
+bool ChapterHtmlSlimParser::beginParse(std::function<int(void* buf, size_t len)> readChunkFn,
+                                       const size_t contentSize) {
+  xmlParser = XML_ParserCreate(nullptr);
 
-  if (!parser) {
+  if (!xmlParser) {
     LOG_ERR("EHP", "Couldn't allocate memory for parser");
+    endParse();
     return false;
   }
 
   // Handle HTML entities (like &nbsp;) that aren't in XML spec or DTD
   // Using DefaultHandlerExpand preserves normal entity expansion from DOCTYPE
-  XML_SetDefaultHandlerExpand(parser, defaultHandlerExpand);
+  XML_SetDefaultHandlerExpand(xmlParser, defaultHandlerExpand);
+
+  XML_SetUserData(xmlParser, this);
+  XML_SetXmlDeclHandler(xmlParser, xmlDecl);
+  XML_SetElementHandler(xmlParser, xmlStartElement, xmlEndElement);
+  XML_SetCharacterDataHandler(xmlParser, xmlCharacterData);
 
-  FsFile file;
-  if (!Storage.openFileForRead("EHP", filepath, file)) {
-    destroyXmlParser(parser);
+  beginLayout(contentSize);
+
+  if (!recordPath.empty()) {
+    streamRecorder.reset(new ChapterContentStream::Writer());
+    if (!streamRecorder->open(recordPath, recordSourceSize)) {
+      streamRecorder.reset();
+    }
+    recordPath.clear();
+  }
+
+  readChunk = std::move(readChunkFn);
+  remainingInput = contentSize;
+  return true;
+}
+
+void ChapterHtmlSlimParser::recordContentStream(const std::string& path, const uint32_t sourceSize) {
+  recordPath = path;
+  recordSourceSize = sourceSize;
+}
+
+bool ChapterHtmlSlimParser::beginReplay(const std::string& path, const uint32_t sourceSize) {
+  endParse();
+  recordPath.clear();
+  streamReplay.reset(new ChapterContentStream::Reader());
+  if (!streamReplay->open(path, sourceSize)) {
+    streamReplay.reset();
     return false;
   }
+  // Checkpoints hold XHTML byte offsets, which a replay doesn't have
+  checkpointFn = nullptr;
+  beginLayout(streamReplay->size());
+  LOG_DBG("EHP", "Replaying content stream %s", path.c_str());
+  return true;
+}
 
-  // Get file size to decide whether to show indexing popup.
-  if (popupFn && file.size() >= MIN_SIZE_FOR_POPUP) {
-    popupFn();
+void ChapterHtmlSlimParser::endParse() {
+  // An unfinished recording is dropped
+  streamRecorder.reset();
+  streamReplay.reset();
+  if (xmlParser) {
+    destroyXmlParser(xmlParser);
+    xmlParser = nullptr;
   }
+  readChunk = nullptr;
+  if (stagedFile) {
+    stagedFile.close();
+  }
+}
 
-  XML_SetUserData(parser, this);
-  XML_SetElementHandler(parser, startElement, endElement);
-  XML_SetCharacterDataHandler(parser, characterData);
+bool ChapterHtmlSlimParser::parseChunks(const std::function<bool()>& shouldPause, bool& done) {
+  done = false;
+  if (streamReplay) {
+    return replayChunks(shouldPause, done);
+  }
+  if (!xmlParser) {
+    LOG_ERR("EHP", "No parse in progress");
+    return false;
+  }
 
-  // Compute the time taken to parse and build pages
-  const uint32_t chapterStartTime = millis();
+  bool inputDone;
   do {
-    void* const buf = XML_GetBuffer(parser, PARSE_BUFFER_SIZE);
+    if (shouldPause && shouldPause()) {
+      return true;
+    }
+
+    void* const buf = XML_GetBuffer(xmlParser, PARSE_BUFFER_SIZE);
     if (!buf) {
       LOG_ERR("EHP", "Couldn't allocate memory for buffer");
-      destroyXmlParser(parser);
-      file.close();
+      endParse();
       return false;
     }
 
-    const size_t len = file.read(buf, PARSE_BUFFER_SIZE);
+    const int len = readChunk(buf, PARSE_BUFFER_SIZE);
+    if (len < 0) {
+      LOG_ERR("EHP", "Failed to read chapter content");
+      endParse();
+      return false;
+    }
 
-    if (len == 0 && file.available() > 0) {
-      LOG_ERR("EHP", "File read error");
-      destroyXmlParser(parser);
-      file.close();
+    remainingInput -= std::min(remainingInput, static_cast<size_t>(len));
+    inputDone = len == 0 || remainingInput == 0;
+
+    if (XML_ParseBuffer(xmlParser, len, inputDone) == XML_STATUS_ERROR) {
+      LOG_ERR("EHP", "Parse error at line %lu:\n%s", XML_GetCurrentLineNumber(xmlParser),
+              XML_ErrorString(XML_GetErrorCode(xmlParser)));
+      endParse();
       return false;
     }
+  } while (!inputDone);
+  LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - parseStartTime);
 
-    done = file.available() == 0;
+  if (streamRecorder) {
+    streamRecorder->finish();
+  }
+  endParse();
+  finishParse();
+  renderer.getWordWidthCache().logStats("EHP");
+  done = true;
+  return true;
+}
 
-    if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
-      LOG_ERR("EHP", "Parse error at line %lu:\n%s", XML_GetCurrentLineNumber(parser),
-              XML_ErrorString(XML_GetErrorCode(parser)));
-      destroyXmlParser(parser);
-      file.close();
+bool ChapterHtmlSlimParser::replayChunks(const std::function<bool()>& shouldPause, bool& done) {
+  // Poll as often as the XHTML parse would: once per parse buffer's worth of input
+  size_t nextPollAt = streamReplay->position();
+  ChapterContentStream::Event event;
+  while (true) {
+    if (streamReplay->position() >= nextPollAt) {
+      if (shouldPause && shouldPause()) {
+        return true;
+      }
+      nextPollAt = streamReplay->position() + PARSE_BUFFER_SIZE;
+    }
+    if (!streamReplay->next(event)) {
+      LOG_ERR("EHP", "Failed to read content stream");
+      endParse();
       return false;
     }
-  } while (!done);
-  LOG_DBG("EHP", "Time to parse and build pages: %lu ms", millis() - chapterStartTime);
+    if (event == ChapterContentStream::Event::End) {
+      break;
+    }
+    switch (event) {
+      case ChapterContentStream::Event::StartElement:
+        startElement(this, streamReplay->name(), streamReplay->atts());
+        break;
+      case ChapterContentStream::Event::Characters:
+        characterData(this, streamReplay->data(), streamReplay->length());
+        break;
+      case ChapterContentStream::Event::EndElement:
+        endElement(this, streamReplay->name());
+        break;
+      case ChapterContentStream::Event::End:
+        break;
+    }
+  }
+  LOG_DBG("EHP", "Time to lay out replayed content: %lu ms", millis() - parseStartTime);
 
-  destroyXmlParser(parser);
-  file.close();
+  endParse();
+  finishParse();
+  renderer.getWordWidthCache().logStats("EHP");
+  done = true;
+  return true;
+}
 
+void ChapterHtmlSlimParser::finishParse() {
   // Process last page if there is still text
   if (currentTextBlock) {
     makePages();
-    if (!pendingAnchorId.empty()) {
-      anchorData.push_back({std::move(pendingAnchorId), static_cast<uint16_t>(completedPageCount)});
-      pendingAnchorId.clear();
-    }
+    recordPendingAnchor();
     completePageFn(std::move(currentPage), xpathParagraphIndex, xpathListItemIndex);
     completedPageCount++;
     currentPage.reset();
     currentTextBlock.reset();
   }
-
-  return true;
 }
 
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
@@ -1139,9 +1524,15 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   if (currentPageNextY + lineHeight > viewportHeight) {
     completePageFn(std::move(currentPage), xpathParagraphIndex, xpathListItemIndex);
     completedPageCount++;
+    // The block's first line opens this page, so its start tag is a point the parse can resume at
+    if (blockCheckpointValid && linesPlacedInBlock == 0) {
+      blockCheckpoint.pageCount = static_cast<uint16_t>(completedPageCount);
+      checkpointFn(blockCheckpoint);
+    }
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
+  linesPlacedInBlock++;
 
   // Track cumulative words to assign footnotes to the page containing their anchor
   wordsExtractedInBlock += line->wordCount();
@@ -1171,14 +1562,18 @@ void ChapterHtmlSlimParser::makePages() {
 
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
 
-  // Apply top spacing before the paragraph (stored in pixels)
+  // Apply top spacing before the paragraph (stored in pixels). A resumed block starts its page: its top spacing
+  // went on the page before the checkpoint.
   const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
-  if (blockStyle.marginTop > 0) {
-    currentPageNextY += blockStyle.marginTop;
-  }
-  if (blockStyle.paddingTop > 0) {
-    currentPageNextY += blockStyle.paddingTop;
+  if (!resumedBlockPending) {
+    if (blockStyle.marginTop > 0) {
+      currentPageNextY += blockStyle.marginTop;
+    }
+    if (blockStyle.paddingTop > 0) {
+      currentPageNextY += blockStyle.paddingTop;
+    }
   }
+  resumedBlockPending = false;
 
   // Calculate effective width accounting for horizontal margins/padding
   const int horizontalInset = blockStyle.totalHorizontalInset();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <HalStorage.h>
 #include <expat.h>
 
 #include <climits>
@@ -14,19 +15,35 @@
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
+#include "ChapterContentStream.h"
 
 class Page;
 class GfxRenderer;
 class Epub;
+class ZipFile;
 
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
+ public:
+  // Parse state at the start tag of a block whose first line opened a new page. Nothing before that tag reaches
+  // later pages, so the parse can be resumed there (resumeParse) from this and the anchors recorded so far.
+  struct Checkpoint {
+    uint32_t inputOffset = 0;  // chapter byte offset of the block's start tag
+    uint16_t pageCount = 0;    // pages completed before the block
+    uint16_t xpathParagraphIndex = 0;
+    uint16_t xpathListItemIndex = 0;
+    uint32_t imageCounter = 0;
+    uint16_t prologSize = 0;  // bytes before the root element; replayed so the DOCTYPE and encoding still apply
+    std::string openTags;     // start tags of the block's ancestors, outermost first
+  };
+
+ private:
   std::shared_ptr<Epub> epub;
-  const std::string& filepath;
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>, uint16_t, uint16_t)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  std::function<void(const Checkpoint&)> checkpointFn;  // Offered each page a checkpoint can resume at
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -89,27 +106,73 @@ class ChapterHtmlSlimParser {
 
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
+  void recordPendingAnchor();
   void flushPartWordBuffer();
   void makePages();
+  // Incremental parse state, live from beginParse() until the input ends, an error, or endParse()
+  XML_Parser xmlParser = nullptr;
+  // Reads the next input chunk into buf: bytes read, 0 at end of input, -1 on error
+  std::function<int(void* buf, size_t len)> readChunk;
+  FsFile stagedFile;  // input of a chapter staged on SD
+  size_t remainingInput = 0;
+  uint32_t parseStartTime = 0;
+
+  // Checkpoint tracking, only while checkpointFn is set
+  bool checkpointsEnabled = false;    // once the prolog is known to replay cleanly
+  bool replaying = false;             // feeding the prolog and ancestor tags of a resumed parse
+  bool resumedBlockPending = false;   // the resumed block hasn't been laid out yet
+  int64_t inputBaseOffset = 0;        // chapter offset of the first byte fed to expat
+  uint16_t prologSize = 0;
+  std::vector<std::string> openTags;  // start tag of the open element at each depth
+  Checkpoint pendingCheckpoint;       // at the start tag being handled, until it opens its text block
+  Checkpoint blockCheckpoint;         // at the start tag of currentTextBlock
+  bool pendingCheckpointValid = false;
+  bool blockCheckpointValid = false;
+  int linesPlacedInBlock = 0;
+
+  bool beginParse(std::function<int(void* buf, size_t len)> readChunkFn, size_t contentSize);
+  bool resumeParse(std::function<int(void* buf, size_t len)> readChunkFn, size_t contentSize,
+                   const Checkpoint& from, std::vector<std::pair<std::string, uint16_t>> anchors,
+                   const std::string& prolog);
+  void endParse();
+  int readStagedChunk(void* buf, size_t len);
+  void recordOpenTag(const XML_Char* name, const XML_Char** atts);
+  // Reset the layout state for a new parse or replay
+  void beginLayout(size_t contentSize);
+  // Lay out what is left once the input has been consumed
+  void finishParse();
+
+  // Content stream: recorded alongside a fresh parse when requested, or the input of a replayed layout
+  std::unique_ptr<ChapterContentStream::Writer> streamRecorder;
+  std::unique_ptr<ChapterContentStream::Reader> streamReplay;
+  std::string recordPath;  // requested by recordContentStream() for the next beginParse()
+  uint32_t recordSourceSize = 0;
+  bool replayChunks(const std::function<bool()>& shouldPause, bool& done);
+
+  // expat callbacks: record the event if a content stream is being written, then handle it
+  static void XMLCALL xmlStartElement(void* userData, const XML_Char* name, const XML_Char** atts);
+  static void XMLCALL xmlCharacterData(void* userData, const XML_Char* s, int len);
+  static void XMLCALL xmlEndElement(void* userData, const XML_Char* name);
   // XML callbacks
+  static void XMLCALL xmlDecl(void* userData, const XML_Char* version, const XML_Char* encoding, int standalone);
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL defaultHandlerExpand(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& filepath, GfxRenderer& renderer,
-                                 const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, GfxRenderer& renderer, const int fontId,
+                                 const float lineCompression, const bool extraParagraphSpacing,
                                  const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                  const uint16_t viewportHeight, const bool hyphenationEnabled,
                                  const bool focusReadingEnabled,
                                  const std::function<void(std::unique_ptr<Page>, uint16_t, uint16_t)>& completePageFn,
                                  const bool embeddedStyle, const std::string& contentBase,
                                  const std::string& imageBasePath, const uint8_t imageRendering = 0,
-                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr)
+                                 const std::function<void()>& popupFn = nullptr, const CssParser* cssParser = nullptr,
+                                 const std::function<void(const Checkpoint&)>& checkpointFn = nullptr)
 
       : epub(epub),
-        filepath(filepath),
         renderer(renderer),
         fontId(fontId),
         lineCompression(lineCompression),
@@ -121,14 +184,35 @@ class ChapterHtmlSlimParser {
         focusReadingEnabled(focusReadingEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        checkpointFn(checkpointFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle),
         imageRendering(imageRendering),
         contentBase(contentBase),
         imageBasePath(imageBasePath) {}
 
-  ~ChapterHtmlSlimParser() = default;
-  bool parseAndBuildPages();
+  ~ChapterHtmlSlimParser();
+  // Incremental parsing, so callers get pages before the whole chapter is laid out: beginParse() sets up
+  // the parse, then each parseChunks() call feeds input until shouldPause() returns true (polled between chunks)
+  // or the input ends. `done` is set once the last page has been emitted. Returns false on error, which ends the
+  // parse. The zip stream must stay open until the parse is done.
+  bool beginParse(ZipFile& zip, size_t contentSize);
+  bool beginParse(const std::string& filepath);
+  bool parseChunks(const std::function<bool()>& shouldPause, bool& done);
+  // Start an incremental parse at a checkpoint taken by an earlier parse of the same chapter with the same
+  // settings. `anchors` are the ones recorded up to it. The zip stream must be at the start of the entry; the
+  // input before the checkpoint is inflated and dropped.
+  bool resumeParse(ZipFile& zip, size_t contentSize, const Checkpoint& from,
+                   std::vector<std::pair<std::string, uint16_t>> anchors);
+  bool resumeParse(const std::string& filepath, const Checkpoint& from,
+                   std::vector<std::pair<std::string, uint16_t>> anchors);
+  // Record the expat events of the next beginParse() to a content stream at `path`, moved into place once the
+  // parse completes. Not supported by resumeParse(), which never sees the start of the chapter.
+  void recordContentStream(const std::string& path, uint32_t sourceSize);
+  // Start an incremental layout fed from a content stream recorded by an earlier parse instead of the XHTML. Returns
+  // false if there is no usable stream for a source of this size. Checkpoints are not offered while replaying.
+  bool beginReplay(const std::string& path, uint32_t sourceSize);
+  bool isReplaying() const { return streamReplay != nullptr; }
   void addLineToPage(std::shared_ptr<TextBlock> line);
   const std::vector<std::pair<std::string, uint16_t>>& getAnchors() const { return anchorData; }
 };
@@ -0,0 +1,52 @@
+#include "DisplayList.h"
+
+#include <Logging.h>
+
+bool DisplayList::push(const OpKind kind, const bool flag, const uint8_t font, const uint32_t index, const int x,
+                       const int y) {
+  if (!complete) {
+    return false;
+  }
+  if (ops.size() >= MAX_OPS || index > INDEX_MASK) {
+    LOG_DBG("DLS", "Display list full at %u ops, drawing the page directly", static_cast<uint32_t>(ops.size()));
+    complete = false;
+    return false;
+  }
+  const uint32_t packed = static_cast<uint32_t>(kind) << 30 | static_cast<uint32_t>(flag) << 29 |
+                          static_cast<uint32_t>(font) << 26 | index;
+  ops.push_back({static_cast<int16_t>(x), static_cast<int16_t>(y), packed});
+  return true;
+}
+
+void DisplayList::addGlyph(const EpdFontData* fontData, const uint32_t glyphIndex, const int originX,
+                           const int originY, const bool black) {
+  uint8_t slot = 0;
+  while (slot < fontCount && fonts[slot] != fontData) {
+    slot++;
+  }
+  if (slot == fontCount) {
+    if (fontCount == MAX_FONTS) {
+      LOG_DBG("DLS", "More than %u fonts on one page, drawing the page directly", MAX_FONTS);
+      complete = false;
+      return;
+    }
+    fonts[fontCount++] = fontData;
+  }
+  push(OpKind::Glyph, black, slot, glyphIndex, originX, originY);
+}
+
+void DisplayList::addLine(const int x1, const int y1, const int x2, const int y2, const bool state) {
+  if (push(OpKind::Line, state, 0, 0, x1, y1) && !push(OpKind::LineEnd, state, 0, 0, x2, y2)) {
+    ops.pop_back();
+  }
+}
+
+void DisplayList::addImage(const uint16_t index, const int x, const int y) {
+  push(OpKind::Image, false, 0, index, x, y);
+}
+
+void DisplayList::clear() {
+  ops.clear();
+  fontCount = 0;
+  complete = true;
+}
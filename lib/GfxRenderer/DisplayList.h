@@ -0,0 +1,64 @@
+#pragma once
+
+#include <EpdFontData.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// What a page draws, resolved once so further passes don't repeat the work. GfxRenderer fills it in place of drawing
+// while it is set as the renderer's recorder (see GfxRenderer::setDisplayListRecorder()). Text is stored as glyph
+// indexes at their final logical position, after UTF-8 decoding, ligature substitution and kerning. Each pass (BW and
+// the gray planes) then replays it with GfxRenderer::drawDisplayList(). The glyph indexes are also the page's
+// prewarm set, see FontCacheManager::PrewarmScope::endScanAndPrewarm().
+//
+// Glyphs of SD card fonts only exist once the font has been prewarmed, so text in those fonts can't be recorded;
+// the list is marked incomplete and the page has to be drawn the usual way.
+class DisplayList {
+ public:
+  static constexpr uint8_t MAX_FONTS = 8;
+  // 32KB of ops, several pages' worth of text
+  static constexpr uint32_t MAX_OPS = 4096;
+
+  enum class OpKind : uint8_t { Glyph, Line, LineEnd, Image };
+
+  // 8 bytes: logical x/y and a packed word holding the kind, a flag, the font slot and a glyph or image index
+  struct Op {
+    int16_t x;
+    int16_t y;
+    uint32_t packed;
+
+    OpKind kind() const { return static_cast<OpKind>(packed >> 30); }
+    // Glyphs: drawn black; lines: line state
+    bool flag() const { return (packed >> 29) & 1; }
+    uint8_t font() const { return (packed >> 26) & 0x07; }
+    uint32_t index() const { return packed & INDEX_MASK; }
+  };
+
+  // Glyph at logical position (originX, originY) of its top-left pixel
+  void addGlyph(const EpdFontData* fontData, uint32_t glyphIndex, int originX, int originY, bool black);
+  void addLine(int x1, int y1, int x2, int y2, bool state);
+  // A caller-defined image; replay hands the index back to the image callback
+  void addImage(uint16_t index, int x, int y);
+  // Something was drawn that the list can't represent
+  void markIncomplete() { complete = false; }
+
+  void clear();
+  bool empty() const { return ops.empty(); }
+  // False if anything drawn while recording is missing from the list
+  bool isComplete() const { return complete; }
+  size_t size() const { return ops.size(); }
+  const std::vector<Op>& getOps() const { return ops; }
+  const EpdFontData* getFontData(const uint8_t slot) const { return fonts[slot]; }
+  uint8_t getFontCount() const { return fontCount; }
+
+ private:
+  static constexpr uint32_t INDEX_MASK = (1u << 26) - 1;
+
+  std::vector<Op> ops;
+  const EpdFontData* fonts[MAX_FONTS] = {};
+  uint8_t fontCount = 0;
+  bool complete = true;
+
+  bool push(OpKind kind, bool flag, uint8_t font, uint32_t index, int x, int y);
+};
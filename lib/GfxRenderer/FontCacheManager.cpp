@@ -3,8 +3,13 @@
 #include <FontDecompressor.h>
 #include <Logging.h>
 #include <SdCardFont.h>
+#include <Trace.h>
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
+
+#include "DisplayList.h"
 
 FontCacheManager::FontCacheManager(const std::map<int, EpdFontFamily>& fontMap,
                                    const std::map<int, SdCardFont*>& sdCardFonts)
@@ -20,6 +25,7 @@ void FontCacheManager::clearCache() {
 }
 
 void FontCacheManager::prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask) {
+  TRACE_SPAN("font_prewarm");
   // SD card font prewarm path: prewarm all requested styles in one call
   auto it = sdCardFonts_.find(fontId);
   if (it != sdCardFonts_.end()) {
@@ -45,6 +51,41 @@ void FontCacheManager::prewarmCache(int fontId, const char* utf8Text, uint8_t st
   }
 }
 
+void FontCacheManager::prewarmCache(const DisplayList& list) {
+  TRACE_SPAN("font_prewarm");
+  if (!fontDecompressor_) return;
+
+  std::vector<uint32_t> glyphIndexes;
+  for (uint8_t slot = 0; slot < list.getFontCount(); slot++) {
+    const EpdFontData* data = list.getFontData(slot);
+    if (!data->groups) continue;
+    glyphIndexes.clear();
+    for (const auto& op : list.getOps()) {
+      if (op.kind() == DisplayList::OpKind::Glyph && op.font() == slot) {
+        glyphIndexes.push_back(op.index());
+      }
+    }
+    std::sort(glyphIndexes.begin(), glyphIndexes.end());
+    glyphIndexes.erase(std::unique(glyphIndexes.begin(), glyphIndexes.end()), glyphIndexes.end());
+    if (glyphIndexes.size() > FontDecompressor::MAX_PAGE_GLYPHS) {
+      LOG_DBG("FCM", "prewarmCache: %u glyphs on the page, excess will use hot-group fallback",
+              static_cast<uint32_t>(glyphIndexes.size()));
+      glyphIndexes.resize(FontDecompressor::MAX_PAGE_GLYPHS);
+    }
+    int missed = fontDecompressor_->prewarmGlyphs(data, glyphIndexes.data(), glyphIndexes.size());
+    if (missed > 0) {
+      LOG_DBG("FCM", "prewarmCache: %d glyph(s) not cached for font slot %u", missed, slot);
+    }
+  }
+}
+
+void FontCacheManager::releaseMemory() {
+  if (fontDecompressor_) fontDecompressor_->trimGlyphCache();
+  for (auto& [id, font] : sdCardFonts_) {
+    font->clearGlyphStore();
+  }
+}
+
 void FontCacheManager::logStats(const char* label) {
   if (fontDecompressor_) fontDecompressor_->logStats(label);
   for (auto& [id, font] : sdCardFonts_) {
@@ -104,6 +145,11 @@ void FontCacheManager::PrewarmScope::endScanAndPrewarm() {
   manager_->scanText_.shrink_to_fit();
 }
 
+void FontCacheManager::PrewarmScope::endScanAndPrewarm(const DisplayList& list) {
+  manager_->prewarmCache(list);
+  endScanAndPrewarm();
+}
+
 FontCacheManager::PrewarmScope::~PrewarmScope() {
   if (active_) {
     endScanAndPrewarm();  // no-op if already called (scanText_ is empty)
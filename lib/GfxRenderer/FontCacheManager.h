@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 
+class DisplayList;
 class FontDecompressor;
 class SdCardFont;
 
@@ -17,6 +18,10 @@ class FontCacheManager {
 
   void clearCache();
   void prewarmCache(int fontId, const char* utf8Text, uint8_t styleMask = 0x0F);
+  // Prewarm exactly the glyphs a recorded page draws
+  void prewarmCache(const DisplayList& list);
+  // Give back the heap the font caches keep from page to page, ahead of something that needs a lot of it (Wi-Fi)
+  void releaseMemory();
   void logStats(const char* label = "render");
   void resetStats();
 
@@ -33,6 +38,9 @@ class FontCacheManager {
     explicit PrewarmScope(FontCacheManager& manager);
     ~PrewarmScope();
     void endScanAndPrewarm();
+    // For a scan pass that recorded a display list: prewarm its glyphs, then any text recorded for fonts the list
+    // can't hold
+    void endScanAndPrewarm(const DisplayList& list);
     PrewarmScope(PrewarmScope&& other) noexcept;
     PrewarmScope& operator=(PrewarmScope&&) = delete;
     PrewarmScope(const PrewarmScope&) = delete;
@@ -4,11 +4,15 @@
 #include <HalGPIO.h>
 #include <Logging.h>
 #include <SdCardFont.h>
+#include <Trace.h>
 #include <Utf8.h>
 
 #include <algorithm>
+#include <climits>
 
+#include "DisplayList.h"
 #include "FontCacheManager.h"
+#include "GlyphBlitter.h"
 
 namespace {
 
@@ -36,8 +40,8 @@ const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const Ep
     // must consume it (draw the glyph) before requesting another bitmap.
     return fd->getBitmap(fontData, glyph, glyphIndex);
   }
-  // For SD card fonts, check if the glyph was loaded on demand into the overflow
-  // buffer.  getOverflowBitmap() returns:
+  // For SD card fonts, check if the glyph was loaded on demand into the font's
+  // glyph store.  getOverflowBitmap() returns:
   //   - bitmap pointer for overflow glyphs with bitmap data
   //   - nullptr for overflow glyphs without bitmap data (e.g. space: width=0, height=0)
   //   - nullptr for non-overflow glyphs (normal prewarmed path)
@@ -74,14 +78,21 @@ void GfxRenderer::begin() {
   panelHeight = display.getDisplayHeight();
   panelWidthBytes = display.getDisplayWidthBytes();
   frameBufferSize = display.getBufferSize();
-  bwBufferChunks.assign((frameBufferSize + BW_BUFFER_CHUNK_SIZE - 1) / BW_BUFFER_CHUNK_SIZE, nullptr);
+  bufferChunkRows = std::max<uint16_t>(1, BW_BUFFER_CHUNK_SIZE / panelWidthBytes);
+  bwBufferChunks.assign((panelHeight + bufferChunkRows - 1) / bufferChunkRows, nullptr);
+  const uint32_t tileColumns = (panelWidthBytes + REFRESH_TILE_BYTES - 1) / REFRESH_TILE_BYTES;
+  const uint32_t tileRows = (panelHeight + REFRESH_TILE_ROWS - 1) / REFRESH_TILE_ROWS;
+  sentTileHashes.assign(tileColumns * tileRows, 0);
+  sentTileHashesValid = false;
 }
 
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
   auto result = fontMap.insert({fontId, font});
   if (!result.second) {
     LOG_ERR("GFX", "Font ID %d already registered, ignoring duplicate", fontId);
+    return;
   }
+  wordWidthCache_.clear();
 }
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
@@ -118,14 +129,15 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
-enum class TextRotation { None, Rotated90CW };
+using TextRotation = GlyphBlitter::TextRotation;
 
 // Shared glyph rendering logic for normal and rotated text.
-// Coordinate mapping and cursor advance direction are selected at compile time via the template parameter.
+// Glyph placement is selected at compile time via the template parameter; the blitter, initialized by the caller for
+// the same rotation, maps the glyph onto the panel for the current orientation.
 template <TextRotation rotation>
-static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
-                           const EpdFontFamily& fontFamily, const uint32_t cp, int cursorX, int cursorY,
-                           const bool pixelState, const EpdFontFamily::Style style) {
+static void renderCharImpl(const GfxRenderer& renderer, const GlyphBlitter& blitter,
+                           GfxRenderer::RenderMode renderMode, const EpdFontFamily& fontFamily, const uint32_t cp,
+                           int cursorX, int cursorY, const bool pixelState, const EpdFontFamily::Style style) {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
   if (!glyph) {
     LOG_ERR("GFX", "No glyph for codepoint %d", cp);
@@ -133,85 +145,23 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
   }
 
   const EpdFontData* fontData = fontFamily.getData(style);
-  const bool is2Bit = fontData->is2Bit;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
-  const int top = glyph->top;
-
   const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+  if (bitmap == nullptr) {
+    return;
+  }
 
-  if (bitmap != nullptr) {
-    // For Normal:  outer loop advances screenY, inner loop advances screenX
-    // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
-    int outerBase, innerBase;
-    if constexpr (rotation == TextRotation::Rotated90CW) {
-      outerBase = cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
-      innerBase = cursorY - left;                      // screenY = innerBase - glyphX
-    } else {
-      outerBase = cursorY - top;   // screenY = outerBase + glyphY
-      innerBase = cursorX + left;  // screenX = innerBase + glyphX
-    }
-
-    if (is2Bit) {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 2];
-          const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
-
-          if (renderMode == GfxRenderer::BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            renderer.drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // Dedicated X3 gray LUTs now provide proper 4-level gray on both devices
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            renderer.drawPixel(screenX, screenY, false);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            renderer.drawPixel(screenX, screenY, false);
-          }
-        }
-      }
-    } else {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 3];
-          const uint8_t bit_index = 7 - (pixelPosition & 7);
-
-          if ((byte >> bit_index) & 1) {
-            renderer.drawPixel(screenX, screenY, pixelState);
-          }
-        }
-      }
-    }
+  // Logical position of glyph pixel (0, 0).
+  // For Normal:  glyph rows advance screenY, glyph columns advance screenX
+  // For Rotated: glyph rows advance screenX, glyph columns advance screenY (in reverse)
+  int originX, originY;
+  if constexpr (rotation == TextRotation::Rotated90CW) {
+    originX = cursorX + fontData->ascender - glyph->top;
+    originY = cursorY - glyph->left;
+  } else {
+    originX = cursorX + glyph->left;
+    originY = cursorY - glyph->top;
   }
+  blitter.blit(bitmap, fontData->is2Bit, glyph->width, glyph->height, originX, originY, renderMode, pixelState);
 }
 
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
@@ -238,6 +188,40 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   } else {
     frameBuffer[byteIndex] |= 1 << bitPosition;  // Set bit
   }
+
+  // Anything drawn per pixel marks the same pixels in both gray planes, as their own passes would
+  if (renderMode == BW_AND_GRAYSCALE) {
+    uint8_t& lsbByte = grayLsbPlane.rows[phyY][phyX / 8];
+    uint8_t& msbByte = grayMsbPlane.rows[phyY][phyX / 8];
+    if (state) {
+      lsbByte &= ~(1 << bitPosition);
+      msbByte &= ~(1 << bitPosition);
+    } else {
+      lsbByte |= 1 << bitPosition;
+      msbByte |= 1 << bitPosition;
+    }
+  }
+}
+
+// A 2-bit image pixel (0 black to 3 white) in a BW_AND_GRAYSCALE pass: black in the framebuffer unless white, dark
+// gray in both gray planes and light gray in the MSB plane only
+void GfxRenderer::drawImagePixelAllPlanes(const int x, const int y, const uint8_t val) const {
+  int phyX = 0;
+  int phyY = 0;
+  rotateCoordinates(orientation, x, y, &phyX, &phyY, panelWidth, panelHeight);
+  if (phyX < 0 || phyX >= panelWidth || phyY < 0 || phyY >= panelHeight) {
+    return;
+  }
+  const uint8_t mask = 0x80 >> (phyX % 8);
+  if (val < 3) {
+    frameBuffer[static_cast<uint32_t>(phyY) * panelWidthBytes + phyX / 8] &= ~mask;
+  }
+  if (val == 1) {
+    grayLsbPlane.rows[phyY][phyX / 8] |= mask;
+  }
+  if (val == 1 || val == 2) {
+    grayMsbPlane.rows[phyY][phyX / 8] |= mask;
+  }
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
@@ -258,32 +242,17 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
   drawText(fontId, x, y, text, black, style);
 }
 
-void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
-                           const EpdFontFamily::Style style) const {
-  const int yPos = y + getFontAscenderSize(fontId);
+// Lays text out from pen position (x, baseline yPos) and calls placeGlyph(cp, cursorX, cursorY) for every glyph,
+// combining marks included. Drawing and display list recording share it so both place glyphs identically.
+template <typename PlaceGlyph>
+static void layoutText(const EpdFontFamily& font, const char* text, const int x, const int yPos,
+                       const EpdFontFamily::Style style, PlaceGlyph&& placeGlyph) {
   int lastBaseX = x;
   int lastBaseLeft = 0;
   int lastBaseWidth = 0;
   int lastBaseTop = 0;
   int32_t prevAdvanceFP = 0;  // 12.4 fixed-point: prev glyph's advance + next kern for snap
 
-  // cannot draw a NULL / empty string
-  if (text == nullptr || *text == '\0') {
-    return;
-  }
-
-  if (fontCacheManager_ && fontCacheManager_->isScanning()) {
-    fontCacheManager_->recordText(text, fontId, style);
-    return;
-  }
-
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return;
-  }
-  const auto& font = fontIt->second;
-
   uint32_t cp;
   uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
@@ -293,7 +262,7 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
       const int raiseBy = combiningMark::raiseAboveBase(combiningGlyph->top, combiningGlyph->height, lastBaseTop);
       const int combiningX = combiningMark::centerOver(lastBaseX, lastBaseLeft, lastBaseWidth, combiningGlyph->left,
                                                        combiningGlyph->width);
-      renderCharImpl<TextRotation::None>(*this, renderMode, font, cp, combiningX, yPos - raiseBy, black, style);
+      placeGlyph(cp, combiningX, yPos - raiseBy);
       continue;
     }
 
@@ -314,12 +283,119 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     lastBaseTop = glyph ? glyph->top : 0;
     prevAdvanceFP = glyph ? glyph->advanceX : 0;  // 12.4 fixed-point
 
-    renderCharImpl<TextRotation::None>(*this, renderMode, font, cp, lastBaseX, yPos, black, style);
+    placeGlyph(cp, lastBaseX, yPos);
     prevCp = cp;
   }
 }
 
+void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
+                           const EpdFontFamily::Style style) const {
+  // cannot draw a NULL / empty string
+  if (text == nullptr || *text == '\0') {
+    return;
+  }
+
+  if (displayListRecorder_) {
+    recordText(fontId, x, y, text, black, style);
+    return;
+  }
+
+  if (fontCacheManager_ && fontCacheManager_->isScanning()) {
+    fontCacheManager_->recordText(text, fontId, style);
+    return;
+  }
+
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return;
+  }
+  const auto& font = fontIt->second;
+  GlyphBlitter blitter;
+  blitter.init(*this, TextRotation::None);
+
+  layoutText(font, text, x, y + getFontAscenderSize(fontId), style,
+             [&](const uint32_t cp, const int cursorX, const int cursorY) {
+               renderCharImpl<TextRotation::None>(*this, blitter, renderMode, font, cp, cursorX, cursorY, black,
+                                                  style);
+             });
+}
+
+void GfxRenderer::recordText(const int fontId, const int x, const int y, const char* text, const bool black,
+                             const EpdFontFamily::Style style) const {
+  // An SD card font's glyphs only exist once it has been prewarmed, and those loaded on a miss are recycled
+  if (isSdCardFont(fontId)) {
+    displayListRecorder_->markIncomplete();
+    if (fontCacheManager_ && fontCacheManager_->isScanning()) {
+      fontCacheManager_->recordText(text, fontId, style);
+    }
+    return;
+  }
+
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return;
+  }
+  const auto& font = fontIt->second;
+  const EpdFontData* fontData = font.getData(style);
+
+  layoutText(font, text, x, y + getFontAscenderSize(fontId), style,
+             [&](const uint32_t cp, const int cursorX, const int cursorY) {
+               const EpdGlyph* glyph = font.getGlyph(cp, style);
+               if (!glyph) {
+                 LOG_ERR("GFX", "No glyph for codepoint %d", cp);
+                 return;
+               }
+               // Blank glyphs have no bitmap to draw or prewarm
+               if (glyph->width == 0 || glyph->height == 0) {
+                 return;
+               }
+               displayListRecorder_->addGlyph(fontData, static_cast<uint32_t>(glyph - fontData->glyph),
+                                              cursorX + glyph->left, cursorY - glyph->top, black);
+             });
+}
+
+void GfxRenderer::drawDisplayList(const DisplayList& list,
+                                  const std::function<void(uint16_t index, int x, int y)>& drawImage) const {
+  GlyphBlitter blitter;
+  blitter.init(*this, TextRotation::None);
+
+  const auto& ops = list.getOps();
+  for (size_t i = 0; i < ops.size(); i++) {
+    const auto& op = ops[i];
+    switch (op.kind()) {
+      case DisplayList::OpKind::Glyph: {
+        const EpdFontData* fontData = list.getFontData(op.font());
+        const EpdGlyph* glyph = &fontData->glyph[op.index()];
+        const uint8_t* bitmap = getGlyphBitmap(fontData, glyph);
+        if (bitmap) {
+          blitter.blit(bitmap, fontData->is2Bit, glyph->width, glyph->height, op.x, op.y, renderMode, op.flag());
+        }
+        break;
+      }
+      case DisplayList::OpKind::Line: {
+        // addLine() always follows a line with its end point
+        const auto& end = ops[++i];
+        drawLine(op.x, op.y, end.x, end.y, op.flag());
+        break;
+      }
+      case DisplayList::OpKind::LineEnd:
+        break;
+      case DisplayList::OpKind::Image:
+        if (drawImage) {
+          drawImage(static_cast<uint16_t>(op.index()), op.x, op.y);
+        }
+        break;
+    }
+  }
+}
+
 void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) const {
+  if (displayListRecorder_) {
+    displayListRecorder_->addLine(x1, y1, x2, y2, state);
+    return;
+  }
   if (fontCacheManager_ && fontCacheManager_->isScanning()) return;
   if (x1 == x2) {
     if (y2 < y1) {
@@ -813,6 +889,8 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
         drawPixel(screenX, screenY, false);
       } else if (renderMode == GRAYSCALE_LSB && val == 1) {
         drawPixel(screenX, screenY, false);
+      } else if (renderMode == BW_AND_GRAYSCALE && val < 3) {
+        drawImagePixelAllPlanes(screenX, screenY, val);
       }
     }
   }
@@ -890,6 +968,133 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
   free(rowBytes);
 }
 
+static inline uint8_t reverseBits(uint8_t b) {
+  b = static_cast<uint8_t>((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+  b = static_cast<uint8_t>((b & 0xCC) >> 2 | (b & 0x33) << 2);
+  return static_cast<uint8_t>((b & 0xAA) >> 1 | (b & 0x55) << 1);
+}
+
+// Transpose an 8x8 pixel block held one row per byte, row 0 in the most significant byte and the leftmost pixel in
+// each byte's MSB (Hacker's Delight, transpose8)
+static inline uint64_t transpose8x8(uint64_t x) {
+  uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+  return x ^ t ^ (t << 28);
+}
+
+template <GfxRenderer::ScreenBitmapOp op>
+static inline void combineByte(uint8_t* dst, const uint8_t src) {
+  using Op = GfxRenderer::ScreenBitmapOp;
+  if constexpr (op == Op::Copy) {
+    *dst = src;
+  } else if constexpr (op == Op::CopyInverted) {
+    *dst = ~src;
+  } else if constexpr (op == Op::AndNot) {
+    *dst &= ~src;
+  } else {
+    *dst ^= src;
+  }
+}
+
+// Combine a row-major image into the panel framebuffer as drawn in the given orientation. The image is the logical
+// screen's size, and the panel's dimensions are multiples of 8, so every byte maps onto a whole framebuffer byte
+// (landscape) or every 8x8 block onto a whole block (portrait).
+template <GfxRenderer::ScreenBitmapOp op>
+static void blitScreenRows(uint8_t* frameBuffer, const uint8_t* rows, const int rowBytes, const int height,
+                           const GfxRenderer::Orientation orientation, const uint16_t panelWidthBytes,
+                           const uint16_t panelHeight) {
+  switch (orientation) {
+    case GfxRenderer::LandscapeCounterClockwise:
+      for (int y = 0; y < height; y++) {
+        uint8_t* dst = frameBuffer + static_cast<uint32_t>(y) * panelWidthBytes;
+        const uint8_t* src = rows + static_cast<uint32_t>(y) * rowBytes;
+        for (int i = 0; i < rowBytes; i++) {
+          combineByte<op>(dst + i, src[i]);
+        }
+      }
+      break;
+    case GfxRenderer::LandscapeClockwise:
+      for (int y = 0; y < height; y++) {
+        uint8_t* dst = frameBuffer + static_cast<uint32_t>(panelHeight - 1 - y) * panelWidthBytes;
+        const uint8_t* src = rows + static_cast<uint32_t>(y) * rowBytes;
+        for (int i = 0; i < rowBytes; i++) {
+          combineByte<op>(dst + rowBytes - 1 - i, reverseBits(src[i]));
+        }
+      }
+      break;
+    case GfxRenderer::Portrait:
+    case GfxRenderer::PortraitInverted: {
+      // Logical rows become panel columns: 8 rows by 8 pixels turn into 8 panel rows of one byte each
+      const bool inverted = orientation == GfxRenderer::PortraitInverted;
+      for (int blockY = 0; blockY < height / 8; blockY++) {
+        const uint8_t* src = rows + static_cast<uint32_t>(blockY) * 8 * rowBytes;
+        const int dstByte = inverted ? panelWidthBytes - 1 - blockY : blockY;
+        for (int blockX = 0; blockX < rowBytes; blockX++) {
+          uint64_t block = 0;
+          for (int r = 0; r < 8; r++) {
+            block = block << 8 | src[r * rowBytes + blockX];
+          }
+          block = transpose8x8(block);
+          for (int c = 0; c < 8; c++) {
+            const uint8_t column = static_cast<uint8_t>(block >> (56 - 8 * c));
+            const int x = blockX * 8 + c;
+            if (inverted) {
+              combineByte<op>(frameBuffer + static_cast<uint32_t>(x) * panelWidthBytes + dstByte, reverseBits(column));
+            } else {
+              combineByte<op>(frameBuffer + static_cast<uint32_t>(panelHeight - 1 - x) * panelWidthBytes + dstByte,
+                              column);
+            }
+          }
+        }
+      }
+      break;
+    }
+  }
+}
+
+bool GfxRenderer::drawScreenBitmap(const uint8_t* bitmap, const int width, const int height,
+                                   const ScreenBitmapLayout layout, const ScreenBitmapOp op) const {
+  if (width != getScreenWidth() || height != getScreenHeight() || width % 8 != 0 || height % 8 != 0) {
+    return false;
+  }
+
+  // A column-major image is a row-major one whose rows are the screen's columns, right to left: the same image
+  // turned a quarter, so it is drawn as rows in the orientation a quarter turn back from ours
+  Orientation rowsOrientation = orientation;
+  int rowBytes = width / 8;
+  int rows = height;
+  if (layout == ScreenBitmapLayout::ColumnsRightToLeft) {
+    constexpr Orientation quarterCounterClockwise[] = {LandscapeCounterClockwise, Portrait, LandscapeClockwise,
+                                                       PortraitInverted};
+    rowsOrientation = quarterCounterClockwise[orientation];
+    rowBytes = height / 8;
+    rows = width;
+  }
+
+  switch (op) {
+    case ScreenBitmapOp::Copy:
+      blitScreenRows<ScreenBitmapOp::Copy>(frameBuffer, bitmap, rowBytes, rows, rowsOrientation, panelWidthBytes,
+                                           panelHeight);
+      break;
+    case ScreenBitmapOp::CopyInverted:
+      blitScreenRows<ScreenBitmapOp::CopyInverted>(frameBuffer, bitmap, rowBytes, rows, rowsOrientation,
+                                                   panelWidthBytes, panelHeight);
+      break;
+    case ScreenBitmapOp::AndNot:
+      blitScreenRows<ScreenBitmapOp::AndNot>(frameBuffer, bitmap, rowBytes, rows, rowsOrientation, panelWidthBytes,
+                                             panelHeight);
+      break;
+    case ScreenBitmapOp::Xor:
+      blitScreenRows<ScreenBitmapOp::Xor>(frameBuffer, bitmap, rowBytes, rows, rowsOrientation, panelWidthBytes,
+                                          panelHeight);
+      break;
+  }
+  return true;
+}
+
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
   if (numPoints < 3) return;
 
@@ -964,9 +1169,66 @@ void GfxRenderer::invertScreen() const {
   }
 }
 
+// Hash every refresh tile of the framebuffer and keep the hashes as the frame sent to the panel. Returns false if no
+// tile changed since the last call, otherwise the panel window around the tiles that did.
+bool GfxRenderer::hashChangedTiles(int* x, int* y, int* width, int* height) const {
+  const uint16_t tileColumns = (panelWidthBytes + REFRESH_TILE_BYTES - 1) / REFRESH_TILE_BYTES;
+  int minColumn = INT_MAX, maxColumn = -1, minRow = INT_MAX, maxRow = -1;
+  uint32_t* hash = sentTileHashes.data();
+  for (uint16_t tileY = 0; tileY < panelHeight; tileY += REFRESH_TILE_ROWS) {
+    const uint16_t rows = std::min<uint16_t>(REFRESH_TILE_ROWS, panelHeight - tileY);
+    for (uint16_t column = 0; column < tileColumns; column++, hash++) {
+      const uint16_t byteX = column * REFRESH_TILE_BYTES;
+      const uint16_t bytes = std::min<uint16_t>(REFRESH_TILE_BYTES, panelWidthBytes - byteX);
+      // FNV-1a
+      uint32_t h = 2166136261u;
+      for (uint16_t row = 0; row < rows; row++) {
+        const uint8_t* p = frameBuffer + static_cast<uint32_t>(tileY + row) * panelWidthBytes + byteX;
+        for (uint16_t i = 0; i < bytes; i++) {
+          h = (h ^ p[i]) * 16777619u;
+        }
+      }
+      if (h != *hash) {
+        *hash = h;
+        minColumn = std::min<int>(minColumn, column);
+        maxColumn = std::max<int>(maxColumn, column);
+        minRow = std::min<int>(minRow, tileY / REFRESH_TILE_ROWS);
+        maxRow = tileY / REFRESH_TILE_ROWS;
+      }
+    }
+  }
+  if (maxColumn < 0) {
+    return false;
+  }
+  *x = minColumn * REFRESH_TILE_BYTES * 8;
+  *y = minRow * REFRESH_TILE_ROWS;
+  *width = std::min<int>((maxColumn + 1) * REFRESH_TILE_BYTES * 8, panelWidth) - *x;
+  *height = std::min<int>((maxRow + 1) * REFRESH_TILE_ROWS, panelHeight) - *y;
+  return true;
+}
+
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
+  TRACE_SPAN("display_refresh");
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+
+  // Half and full refreshes redraw the whole panel to clear ghosting; they only update the hashes
+  const bool sentFrameKnown = sentTileHashesValid;
+  int x = 0, y = 0, width = 0, height = 0;
+  const bool changed = hashChangedTiles(&x, &y, &width, &height);
+  sentTileHashesValid = true;
+  if (refreshMode == HalDisplay::FAST_REFRESH && sentFrameKnown) {
+    if (!changed) {
+      LOG_DBG("GFX", "Frame unchanged, refresh skipped");
+      return;
+    }
+    if (static_cast<uint32_t>(width) * height * 100 <= static_cast<uint32_t>(panelWidth) * panelHeight *
+                                                             MAX_WINDOW_REFRESH_PERCENT) {
+      LOG_DBG("GFX", "Window refresh %dx%d at (%d, %d)", width, height, x, y);
+      display.displayWindow(x, y, width, height, fadingFix);
+      return;
+    }
+  }
   display.displayBuffer(refreshMode, fadingFix);
 }
 
@@ -1221,6 +1483,8 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 
   const auto& font = fontIt->second;
+  GlyphBlitter blitter;
+  blitter.init(*this, TextRotation::Rotated90CW);
 
   int lastBaseY = y;
   int lastBaseLeft = 0;
@@ -1238,7 +1502,8 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
       const int combiningX = x - raiseBy;
       const int combiningY = combiningMark::centerOverRotated90CW(lastBaseY, lastBaseLeft, lastBaseWidth,
                                                                   combiningGlyph->left, combiningGlyph->width);
-      renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, combiningX, combiningY, black, style);
+      renderCharImpl<TextRotation::Rotated90CW>(*this, blitter, renderMode, font, cp, combiningX, combiningY, black,
+                                                style);
       continue;
     }
 
@@ -1258,7 +1523,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     lastBaseTop = glyph ? glyph->top : 0;
     prevAdvanceFP = glyph ? glyph->advanceX : 0;  // 12.4 fixed-point
 
-    renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, x, lastBaseY, black, style);
+    renderCharImpl<TextRotation::Rotated90CW>(*this, blitter, renderMode, font, cp, x, lastBaseY, black, style);
     prevCp = cp;
   }
 }
@@ -1274,7 +1539,12 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  TRACE_SPAN("display_gray_refresh");
+  display.displayGrayBuffer(fadingFix);
+  // The panel now shows the gray planes, which the tile hashes don't describe
+  sentTileHashesValid = false;
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -1288,10 +1558,12 @@ void GfxRenderer::freeBwBufferChunks() {
 /**
  * This should be called before grayscale buffers are populated.
  * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
+ * Uses chunked allocation of whole panel rows to avoid needing 48KB of contiguous memory.
  * Returns true if buffer was stored successfully, false if allocation failed.
  */
 bool GfxRenderer::storeBwBuffer() {
+  TRACE_SPAN("bw_store");
+  const size_t chunkBytes = static_cast<size_t>(bufferChunkRows) * panelWidthBytes;
   // Allocate and copy each chunk
   for (size_t i = 0; i < bwBufferChunks.size(); i++) {
     // Check if any chunks are already allocated
@@ -1301,8 +1573,8 @@ bool GfxRenderer::storeBwBuffer() {
       bwBufferChunks[i] = nullptr;
     }
 
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    const size_t chunkSize = std::min(BW_BUFFER_CHUNK_SIZE, static_cast<size_t>(frameBufferSize - offset));
+    const size_t offset = i * chunkBytes;
+    const size_t chunkSize = std::min(chunkBytes, static_cast<size_t>(frameBufferSize - offset));
     bwBufferChunks[i] = static_cast<uint8_t*>(malloc(chunkSize));
 
     if (!bwBufferChunks[i]) {
@@ -1315,16 +1587,17 @@ bool GfxRenderer::storeBwBuffer() {
     memcpy(bwBufferChunks[i], frameBuffer + offset, chunkSize);
   }
 
-  LOG_DBG("GFX", "Stored BW buffer in %zu chunks (%zu bytes each)", bwBufferChunks.size(), BW_BUFFER_CHUNK_SIZE);
+  LOG_DBG("GFX", "Stored BW buffer in %zu chunks (%zu bytes each)", bwBufferChunks.size(), chunkBytes);
   return true;
 }
 
 /**
- * This can only be called if `storeBwBuffer` was called prior to the grayscale render.
+ * This can only be called if `storeBwBuffer` or `endSinglePassGrayscale` was called prior to the grayscale render.
  * It should be called to restore the BW buffer state after grayscale rendering is complete.
  * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
+  TRACE_SPAN("bw_restore");
   // Check if all chunks are allocated
   bool missingChunks = false;
   for (const auto& bwBufferChunk : bwBufferChunks) {
@@ -1339,9 +1612,10 @@ void GfxRenderer::restoreBwBuffer() {
     return;
   }
 
+  const size_t chunkBytes = static_cast<size_t>(bufferChunkRows) * panelWidthBytes;
   for (size_t i = 0; i < bwBufferChunks.size(); i++) {
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    const size_t chunkSize = std::min(BW_BUFFER_CHUNK_SIZE, static_cast<size_t>(frameBufferSize - offset));
+    const size_t offset = i * chunkBytes;
+    const size_t chunkSize = std::min(chunkBytes, static_cast<size_t>(frameBufferSize - offset));
     memcpy(frameBuffer + offset, bwBufferChunks[i], chunkSize);
   }
 
@@ -1351,6 +1625,94 @@ void GfxRenderer::restoreBwBuffer() {
   LOG_DBG("GFX", "Restored and freed BW buffer chunks");
 }
 
+// Exchange two buffers a 32-bit word at a time
+static void swapBytes(uint8_t* a, uint8_t* b, const size_t size) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    uint32_t wordA, wordB;
+    memcpy(&wordA, a + i, 4);
+    memcpy(&wordB, b + i, 4);
+    memcpy(a + i, &wordB, 4);
+    memcpy(b + i, &wordA, 4);
+  }
+  for (; i < size; i++) {
+    std::swap(a[i], b[i]);
+  }
+}
+
+bool GfxRenderer::allocateGrayPlane(GrayPlane& plane) const {
+  freeGrayPlane(plane);
+  plane.rows.resize(panelHeight);
+  for (int firstRow = 0; firstRow < panelHeight; firstRow += bufferChunkRows) {
+    const int rows = std::min<int>(bufferChunkRows, panelHeight - firstRow);
+    auto* chunk = static_cast<uint8_t*>(malloc(static_cast<size_t>(rows) * panelWidthBytes));
+    if (!chunk) {
+      LOG_ERR("GFX", "!! Failed to allocate gray plane chunk (%d rows)", rows);
+      freeGrayPlane(plane);
+      return false;
+    }
+    memset(chunk, 0x00, static_cast<size_t>(rows) * panelWidthBytes);
+    plane.chunks.push_back(chunk);
+    for (int row = 0; row < rows; row++) {
+      plane.rows[firstRow + row] = chunk + row * panelWidthBytes;
+    }
+  }
+  return true;
+}
+
+void GfxRenderer::freeGrayPlane(GrayPlane& plane) {
+  for (auto* chunk : plane.chunks) {
+    free(chunk);
+  }
+  plane.chunks.clear();
+  plane.rows.clear();
+  plane.rows.shrink_to_fit();
+}
+
+/**
+ * Both gray planes live in chunks of whole panel rows laid out like the stored BW buffer, so no allocation needs 48KB
+ * of contiguous memory. They take 96KB where the separate passes stored the 48KB BW frame; the extra 48KB saves two
+ * traversals of the page. endSinglePassGrayscale() hands the LSB plane's chunks over as the stored BW frame.
+ */
+bool GfxRenderer::beginSinglePassGrayscale() {
+  if (!allocateGrayPlane(grayLsbPlane) || !allocateGrayPlane(grayMsbPlane)) {
+    freeGrayPlane(grayLsbPlane);
+    return false;
+  }
+  renderMode = BW_AND_GRAYSCALE;
+  return true;
+}
+
+void GfxRenderer::endSinglePassGrayscale() {
+  TRACE_SPAN("gray_handover");
+  renderMode = BW;
+  if (grayLsbPlane.rows.empty() || grayMsbPlane.rows.empty()) {
+    return;
+  }
+
+  // The display takes whole planes from the framebuffer. The planes' chunks are laid out like the framebuffer: swap
+  // the LSB plane in, which leaves the BW frame in the LSB plane's chunks, then copy the MSB plane over it.
+  const size_t chunkBytes = static_cast<size_t>(bufferChunkRows) * panelWidthBytes;
+  for (size_t i = 0; i < grayLsbPlane.chunks.size(); i++) {
+    const size_t offset = i * chunkBytes;
+    const size_t chunkSize = std::min(chunkBytes, static_cast<size_t>(frameBufferSize - offset));
+    swapBytes(frameBuffer + offset, grayLsbPlane.chunks[i], chunkSize);
+  }
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+  for (size_t i = 0; i < grayMsbPlane.chunks.size(); i++) {
+    const size_t offset = i * chunkBytes;
+    const size_t chunkSize = std::min(chunkBytes, static_cast<size_t>(frameBufferSize - offset));
+    memcpy(frameBuffer + offset, grayMsbPlane.chunks[i], chunkSize);
+  }
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+  freeGrayPlane(grayMsbPlane);
+
+  // Same layout as storeBwBuffer() uses, so restoreBwBuffer() puts the BW frame back
+  freeBwBufferChunks();
+  bwBufferChunks.swap(grayLsbPlane.chunks);
+  freeGrayPlane(grayLsbPlane);
+}
+
 /**
  * Cleanup grayscale buffers using the current frame buffer.
  * Use this when BW buffer was re-rendered instead of stored/restored.
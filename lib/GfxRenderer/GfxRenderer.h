@@ -3,15 +3,18 @@
 #include <EpdFontFamily.h>
 #include <HalDisplay.h>
 
+class DisplayList;
 class FontCacheManager;
 class SdCardFont;
 
 #include <cstring>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "Bitmap.h"
+#include "WordWidthCache.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -19,7 +22,9 @@ enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray =
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // BW_AND_GRAYSCALE draws the BW frame into the framebuffer and both gray planes into side buffers in the same pass,
+  // see beginSinglePassGrayscale()
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, BW_AND_GRAYSCALE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -29,8 +34,19 @@ class GfxRenderer {
     LandscapeCounterClockwise  // 800x480 logical coordinates, native panel orientation
   };
 
+  // Byte order of a drawScreenBitmap() image: rows top to bottom with the leftmost pixel in the MSB, or columns
+  // right to left with the topmost pixel in the MSB (the XTH bit plane layout)
+  enum class ScreenBitmapLayout : uint8_t { Rows, ColumnsRightToLeft };
+  // How drawScreenBitmap() combines the image with the framebuffer
+  enum class ScreenBitmapOp : uint8_t { Copy, CopyInverted, AndNot, Xor };
+
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
+  // Partial refresh tiles: 80 panel pixels by 16 rows
+  static constexpr uint16_t REFRESH_TILE_BYTES = 10;
+  static constexpr uint16_t REFRESH_TILE_ROWS = 16;
+  // A fast refresh whose changed tiles span at most this share of the panel only refreshes their window
+  static constexpr uint32_t MAX_WINDOW_REFRESH_PERCENT = 50;
 
   HalDisplay& display;
   RenderMode renderMode;
@@ -41,7 +57,20 @@ class GfxRenderer {
   uint16_t panelHeight = HalDisplay::DISPLAY_HEIGHT;
   uint16_t panelWidthBytes = HalDisplay::DISPLAY_WIDTH_BYTES;
   uint32_t frameBufferSize = HalDisplay::BUFFER_SIZE;
+  // Whole panel rows per chunk of the stored BW frame; the gray side planes share its layout
+  uint16_t bufferChunkRows = 1;
   std::vector<uint8_t*> bwBufferChunks;
+  // Gray plane of a BW_AND_GRAYSCALE pass: chunks laid out like the stored BW frame, and a pointer to each panel row
+  struct GrayPlane {
+    std::vector<uint8_t*> chunks;
+    std::vector<uint8_t*> rows;
+  };
+  GrayPlane grayLsbPlane;
+  GrayPlane grayMsbPlane;
+  // A hash per refresh tile of the frame last sent to the panel, so displayBuffer() can find what changed since.
+  // Mutable like the framebuffer it describes: displayBuffer() is const.
+  mutable std::vector<uint32_t> sentTileHashes;
+  mutable bool sentTileHashesValid = false;
   std::map<int, EpdFontFamily> fontMap;
   // Mutable because ensureSdCardFontReady() is const (called from layout code
   // that holds a const GfxRenderer&) but triggers SD card reads and heap
@@ -53,10 +82,21 @@ class GfxRenderer {
   // recording to the (non-const) FontCacheManager. Same pragmatic compromise
   // as before, concentrated in a single pointer instead of four fields.
   mutable FontCacheManager* fontCacheManager_ = nullptr;
+  // Mutable because layout code measures words through a const GfxRenderer&. Emptied whenever a font is added or
+  // removed, so its widths always belong to the fonts registered now.
+  mutable WordWidthCache wordWidthCache_;
+
+  // While set, drawText() and drawLine() append to this list instead of drawing
+  DisplayList* displayListRecorder_ = nullptr;
 
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  void recordText(int fontId, int x, int y, const char* text, bool black, EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
+  bool allocateGrayPlane(GrayPlane& plane) const;
+  static void freeGrayPlane(GrayPlane& plane);
+  bool hashChangedTiles(int* x, int* y, int* width, int* height) const;
+  void drawImagePixelAllPlanes(int x, int y, uint8_t val) const;
   template <Color color>
   void drawPixelDither(int x, int y) const;
   template <Color color>
@@ -65,7 +105,11 @@ class GfxRenderer {
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    freeGrayPlane(grayLsbPlane);
+    freeGrayPlane(grayMsbPlane);
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -81,15 +125,24 @@ class GfxRenderer {
   void removeFont(int fontId) {
     fontMap.erase(fontId);
     sdCardFonts_.erase(fontId);
+    wordWidthCache_.clear();
   }
   void setFontCacheManager(FontCacheManager* m) { fontCacheManager_ = m; }
   FontCacheManager* getFontCacheManager() const { return fontCacheManager_; }
   const std::map<int, EpdFontFamily>& getFontMap() const { return fontMap; }
-  void registerSdCardFont(int fontId, SdCardFont* font) { sdCardFonts_[fontId] = font; }
+  void registerSdCardFont(int fontId, SdCardFont* font) {
+    sdCardFonts_[fontId] = font;
+    wordWidthCache_.clear();
+  }
   void unregisterSdCardFont(int fontId) { removeFont(fontId); }
-  void clearSdCardFonts() { sdCardFonts_.clear(); }
+  void clearSdCardFonts() {
+    sdCardFonts_.clear();
+    wordWidthCache_.clear();
+  }
   const std::map<int, SdCardFont*>& getSdCardFonts() const { return sdCardFonts_; }
   bool isSdCardFont(int fontId) const { return sdCardFonts_.count(fontId) > 0; }
+  // Word widths measured by the line breaker, see WordWidthCache
+  WordWidthCache& getWordWidthCache() const { return wordWidthCache_; }
   // Ensure SD card font glyph data is loaded for the given text. Called from layout code
   // (which holds a const GfxRenderer&) before measuring word widths. Safe to call on non-SD fonts (no-op).
   // styleMask: bitmask of styles to prepare (bit 0=regular, 1=bold, 2=italic, 3=bold-italic).
@@ -105,9 +158,9 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // A fast refresh compares the frame with the one last sent: an unchanged frame isn't sent at all, and a small
+  // change only refreshes the panel window around it
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -133,8 +186,22 @@ class GfxRenderer {
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
   void drawBitmap1Bit(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
+  // Copy a packed 1-bit image (1 = white, like the framebuffer) covering the whole logical screen into the
+  // framebuffer with whole-byte operations, transposing 8x8 pixel blocks where the orientation rotates it. Returns
+  // false, drawing nothing, if the image isn't the size of the screen.
+  bool drawScreenBitmap(const uint8_t* bitmap, int width, int height,
+                        ScreenBitmapLayout layout = ScreenBitmapLayout::Rows,
+                        ScreenBitmapOp op = ScreenBitmapOp::Copy) const;
   void fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state = true) const;
 
+  // Display lists: record what drawText() and drawLine() calls would draw, then draw it as many times as needed
+  // without laying the text out again. Nothing else may be drawn while recording. Text in SD card fonts marks the
+  // list incomplete (and is handed to the font prewarm scan instead, if one is running).
+  void setDisplayListRecorder(DisplayList* list) { displayListRecorder_ = list; }
+  // Draw a recorded list in the current render mode and orientation. Image ops are passed to drawImage.
+  void drawDisplayList(const DisplayList& list,
+                       const std::function<void(uint16_t index, int x, int y)>& drawImage = nullptr) const;
+
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
@@ -173,6 +240,18 @@ class GfxRenderer {
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
+  // Single-pass anti-aliasing: allocates both gray planes beside the framebuffer, cleared, and switches to
+  // BW_AND_GRAYSCALE, so content is traversed and its glyphs decoded once for all three planes. Draw the content,
+  // switch back to BW for anything that stays out of the gray planes (the status bar), display the BW frame, then call
+  // endSinglePassGrayscale(). Returns false (renderer unchanged) if the planes can't be allocated; draw in BW and
+  // render the LSB and MSB passes separately then.
+  bool beginSinglePassGrayscale();
+  // Hand both gray planes to the display and keep the BW frame aside as storeBwBuffer() does, then switch back to BW.
+  // Follow with displayGrayBuffer() and restoreBwBuffer().
+  void endSinglePassGrayscale();
+  // One pointer per panel row of each gray plane; nullptr outside a single-pass render
+  uint8_t* const* getGrayLsbRows() const { return grayLsbPlane.rows.empty() ? nullptr : grayLsbPlane.rows.data(); }
+  uint8_t* const* getGrayMsbRows() const { return grayMsbPlane.rows.empty() ? nullptr : grayMsbPlane.rows.data(); }
 
   // Font helpers
   const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
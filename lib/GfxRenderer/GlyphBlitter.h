@@ -0,0 +1,423 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "GfxRenderer.h"
+
+// 2-bit glyph pixels to ink bits for each render mode, four pixels per lookup
+namespace GlyphInk {
+// Raw 2-bit values: 0 white, 1 light gray, 2 dark gray, 3 black. Bit v of a mask selects value v.
+constexpr uint8_t BW_MASK = 0b1110;
+constexpr uint8_t LSB_MASK = 0b0100;
+constexpr uint8_t MSB_MASK = 0b0110;
+
+struct Table {
+  uint8_t nibble[256];
+};
+
+constexpr Table makeTable(const uint8_t inkMask) {
+  Table table{};
+  for (int byte = 0; byte < 256; byte++) {
+    uint8_t nibble = 0;
+    for (int shift = 6; shift >= 0; shift -= 2) {
+      nibble = (nibble << 1) | ((inkMask >> ((byte >> shift) & 0x3)) & 1);
+    }
+    table.nibble[byte] = nibble;
+  }
+  return table;
+}
+
+inline constexpr Table BW_TABLE = makeTable(BW_MASK);
+inline constexpr Table LSB_TABLE = makeTable(LSB_MASK);
+inline constexpr Table MSB_TABLE = makeTable(MSB_MASK);
+
+// All three planes of a BW_AND_GRAYSCALE pass from one lookup: BW ink bits in bits 8-11, LSB in 4-7, MSB in 0-3
+struct PlanesTable {
+  uint16_t nibbles[256];
+};
+
+constexpr PlanesTable makePlanesTable() {
+  PlanesTable table{};
+  for (int byte = 0; byte < 256; byte++) {
+    table.nibbles[byte] = static_cast<uint16_t>(BW_TABLE.nibble[byte] << 8 | LSB_TABLE.nibble[byte] << 4 |
+                                                MSB_TABLE.nibble[byte]);
+  }
+  return table;
+}
+
+inline constexpr PlanesTable PLANES_TABLE = makePlanesTable();
+}  // namespace GlyphInk
+
+// Framebuffer writer for glyph bitmaps, replacing one drawPixel() call per glyph pixel in the text hot path.
+//
+// The screen orientation and the text rotation are folded into one axis-aligned transform from glyph pixel (gx, gy)
+// to panel pixel, so the glyph rectangle is clipped against the panel once and each glyph row becomes a run along a
+// single panel axis. Rows are read from the bitmap up to 24 pixels at a time and turned into a mask of inked pixels
+// (2-bit pixels through a per-render-mode lookup table). Runs along a panel row are written as whole framebuffer
+// bytes, one read-modify-write per byte; runs along a panel column visit only the inked pixels, one bit per panel
+// row. The inner loops are instantiated per run direction, bit depth and write polarity, so they contain no
+// orientation switch, bounds check or render-mode test.
+//
+// Output is bit-identical to the per-pixel path: the same pixels are touched in the same polarity. Pixels outside
+// the panel are dropped silently instead of being logged one by one.
+class GlyphBlitter {
+ public:
+  enum class TextRotation { None, Rotated90CW };
+
+  // Call whenever the renderer's orientation may have changed (cheap: a handful of assignments).
+  void init(const GfxRenderer& renderer, TextRotation rotation) {
+    fb = renderer.getFrameBuffer();
+    widthBytes = renderer.getDisplayWidthBytes();
+    panelWidth = renderer.getDisplayWidth();
+    panelHeight = renderer.getDisplayHeight();
+    lsbRows = renderer.getGrayLsbRows();
+    msbRows = renderer.getGrayMsbRows();
+
+    // Logical (x, y) -> panel, as in rotateCoordinates():
+    //   phyX = phyXBase + x * phyXStepX + y * phyXStepY
+    //   phyY = phyYBase + x * phyYStepX + y * phyYStepY
+    int phyXStepX, phyXStepY, phyYStepX, phyYStepY;
+    switch (renderer.getOrientation()) {
+      case GfxRenderer::Portrait:
+        phyXBase = 0;
+        phyYBase = panelHeight - 1;
+        phyXStepX = 0;
+        phyXStepY = 1;
+        phyYStepX = -1;
+        phyYStepY = 0;
+        break;
+      case GfxRenderer::LandscapeClockwise:
+        phyXBase = panelWidth - 1;
+        phyYBase = panelHeight - 1;
+        phyXStepX = -1;
+        phyXStepY = 0;
+        phyYStepX = 0;
+        phyYStepY = -1;
+        break;
+      case GfxRenderer::PortraitInverted:
+        phyXBase = panelWidth - 1;
+        phyYBase = 0;
+        phyXStepX = 0;
+        phyXStepY = -1;
+        phyYStepX = 1;
+        phyYStepY = 0;
+        break;
+      case GfxRenderer::LandscapeCounterClockwise:
+      default:
+        phyXBase = 0;
+        phyYBase = 0;
+        phyXStepX = 1;
+        phyXStepY = 0;
+        phyYStepX = 0;
+        phyYStepY = 1;
+        break;
+    }
+
+    // Glyph (gx, gy) -> logical: unrotated text is (x + gx, y + gy), rotated text is (x + gy, y - gx)
+    if (rotation == TextRotation::Rotated90CW) {
+      gxPhyX = -phyXStepY;
+      gxPhyY = -phyYStepY;
+      gyPhyX = phyXStepX;
+      gyPhyY = phyYStepX;
+    } else {
+      gxPhyX = phyXStepX;
+      gxPhyY = phyYStepX;
+      gyPhyX = phyXStepY;
+      gyPhyY = phyYStepY;
+    }
+    logicalPhyXStepX = phyXStepX;
+    logicalPhyXStepY = phyXStepY;
+    logicalPhyYStepX = phyYStepX;
+    logicalPhyYStepY = phyYStepY;
+  }
+
+  // Draw a width x height glyph whose pixel (0, 0) lands on logical (originX, originY). Pixel semantics match
+  // renderCharImpl(): 1-bit glyphs draw `pixelState` in every mode, 2-bit glyphs draw `pixelState` for any
+  // non-white pixel in BW and set the bit of the gray levels the LSB / MSB plane flags. In BW_AND_GRAYSCALE one read
+  // of the bitmap feeds all three planes: BW into the framebuffer, LSB and MSB into the renderer's side buffers.
+  void blit(const uint8_t* bitmap, const bool is2Bit, const int width, const int height, const int originX,
+            const int originY, GfxRenderer::RenderMode mode, const bool pixelState) const {
+    Job job;
+    job.bitmap = bitmap;
+    job.width = width;
+    job.phyX = phyXBase + originX * logicalPhyXStepX + originY * logicalPhyXStepY;
+    job.phyY = phyYBase + originX * logicalPhyYStepX + originY * logicalPhyYStepY;
+
+    // gx moves along one panel axis and gy along the other, so each clips against one panel dimension
+    if (!clipAxis(gxPhyX != 0 ? job.phyX : job.phyY, gxPhyX != 0 ? gxPhyX : gxPhyY,
+                  gxPhyX != 0 ? panelWidth : panelHeight, width, job.gx0, job.gx1) ||
+        !clipAxis(gyPhyX != 0 ? job.phyX : job.phyY, gyPhyX != 0 ? gyPhyX : gyPhyY,
+                  gyPhyX != 0 ? panelWidth : panelHeight, height, job.gy0, job.gy1)) {
+      return;
+    }
+
+    bool clearBits = pixelState;
+    bool allPlanes = false;
+    if (mode == GfxRenderer::BW_AND_GRAYSCALE) {
+      // Without its side buffers the pass can still draw the BW frame
+      allPlanes = lsbRows && msbRows;
+      mode = GfxRenderer::BW;
+    }
+    if (is2Bit) {
+      switch (mode) {
+        case GfxRenderer::BW:
+          job.inkTable = GlyphInk::BW_TABLE.nibble;
+          break;
+        case GfxRenderer::GRAYSCALE_MSB:
+          job.inkTable = GlyphInk::MSB_TABLE.nibble;
+          clearBits = false;
+          break;
+        case GfxRenderer::GRAYSCALE_LSB:
+          job.inkTable = GlyphInk::LSB_TABLE.nibble;
+          clearBits = false;
+          break;
+        default:
+          return;
+      }
+    }
+
+    if (gxPhyX == 1) {
+      dispatch<Run::Right>(job, is2Bit, clearBits, allPlanes);
+    } else if (gxPhyX == -1) {
+      dispatch<Run::Left>(job, is2Bit, clearBits, allPlanes);
+    } else if (gxPhyY == 1) {
+      dispatch<Run::Down>(job, is2Bit, clearBits, allPlanes);
+    } else {
+      dispatch<Run::Up>(job, is2Bit, clearBits, allPlanes);
+    }
+  }
+
+ private:
+  // Panel direction of one glyph pixel step along a row
+  enum class Run { Right, Left, Down, Up };
+
+  struct Job {
+    const uint8_t* bitmap;
+    int width;
+    int phyX, phyY;  // panel position of glyph pixel (0, 0), possibly off-panel
+    int gx0, gx1, gy0, gy1;
+    const uint8_t* inkTable = nullptr;  // 2-bit only: four raw pixels -> four ink bits for the render mode
+  };
+
+  // Pixels gathered per bitmap read; a run of them plus its bit offset fits one 32-bit span
+  static constexpr int CHUNK_PIXELS = 24;
+
+  uint8_t* fb = nullptr;
+  int widthBytes = 0;
+  int panelWidth = 0;
+  int panelHeight = 0;
+  int phyXBase = 0, phyYBase = 0;
+  int logicalPhyXStepX = 1, logicalPhyXStepY = 0;
+  int logicalPhyYStepX = 0, logicalPhyYStepY = 1;
+  int gxPhyX = 1, gxPhyY = 0;  // panel step per glyph column
+  int gyPhyX = 0, gyPhyY = 1;  // panel step per glyph row
+  uint8_t* const* lsbRows = nullptr;  // gray plane rows of a BW_AND_GRAYSCALE pass
+  uint8_t* const* msbRows = nullptr;
+
+  // Glyph index range [lo, hi) whose panel coordinate origin + g * step stays within [0, limit)
+  static bool clipAxis(const int origin, const int step, const int limit, const int count, int& lo, int& hi) {
+    if (step > 0) {
+      lo = -origin;
+      hi = limit - origin;
+    } else {
+      lo = origin - limit + 1;
+      hi = origin + 1;
+    }
+    if (lo < 0) lo = 0;
+    if (hi > count) hi = count;
+    return lo < hi;
+  }
+
+  template <Run run>
+  void dispatch(const Job& job, const bool is2Bit, const bool clearBits, const bool allPlanes) const {
+    allPlanes ? dispatchDepth<run, true>(job, is2Bit, clearBits) : dispatchDepth<run, false>(job, is2Bit, clearBits);
+  }
+
+  template <Run run, bool allPlanes>
+  void dispatchDepth(const Job& job, const bool is2Bit, const bool clearBits) const {
+    if (is2Bit) {
+      clearBits ? blitRows<run, true, true, allPlanes>(job) : blitRows<run, true, false, allPlanes>(job);
+    } else {
+      clearBits ? blitRows<run, false, true, allPlanes>(job) : blitRows<run, false, false, allPlanes>(job);
+    }
+  }
+
+  // Glyph pixels [pos, pos + n) left-aligned in 64 bits. Reads only the bitmap bytes the pixels occupy.
+  template <bool is2Bit>
+  static inline uint64_t readPixels(const Job& job, const int pos, const int n) {
+    constexpr int bitsPerPixel = is2Bit ? 2 : 1;
+    const int bitOffset = pos * bitsPerPixel;
+    const uint8_t* src = job.bitmap + (bitOffset >> 3);
+    const int bytes = ((bitOffset & 7) + n * bitsPerPixel + 7) >> 3;
+    uint64_t window = 0;
+    for (int i = 0; i < bytes; i++) {
+      window |= static_cast<uint64_t>(src[i]) << (56 - 8 * i);
+    }
+    return window << (bitOffset & 7);
+  }
+
+  // Ink bits of n 2-bit pixels as an n-bit value, first pixel in the most significant bit. Four pixels per lookup;
+  // the padding pixels of the last one are white and shifted out.
+  static inline uint32_t inkBits(uint64_t window, const int n, const uint8_t* inkTable) {
+    const int quads = (n + 3) >> 2;
+    uint32_t ink = 0;
+    for (int i = 0; i < quads; i++, window <<= 8) {
+      ink = (ink << 4) | inkTable[window >> 56];
+    }
+    return ink >> (quads * 4 - n);
+  }
+
+  // The same for the BW, LSB and MSB planes at once, still one lookup per four pixels
+  static inline void planeInkBits(uint64_t window, const int n, uint32_t& bw, uint32_t& lsb, uint32_t& msb) {
+    const int quads = (n + 3) >> 2;
+    bw = lsb = msb = 0;
+    for (int i = 0; i < quads; i++, window <<= 8) {
+      const uint16_t nibbles = GlyphInk::PLANES_TABLE.nibbles[window >> 56];
+      bw = (bw << 4) | (nibbles >> 8);
+      lsb = (lsb << 4) | ((nibbles >> 4) & 0xF);
+      msb = (msb << 4) | (nibbles & 0xF);
+    }
+    const int padding = quads * 4 - n;
+    bw >>= padding;
+    lsb >>= padding;
+    msb >>= padding;
+  }
+
+  static inline uint32_t reverseBits(uint32_t v, const int n) {
+    v = ((v >> 1) & 0x55555555u) | ((v & 0x55555555u) << 1);
+    v = ((v >> 2) & 0x33333333u) | ((v & 0x33333333u) << 2);
+    v = ((v >> 4) & 0x0F0F0F0Fu) | ((v & 0x0F0F0F0Fu) << 4);
+    v = ((v >> 8) & 0x00FF00FFu) | ((v & 0x00FF00FFu) << 8);
+    v = (v >> 16) | (v << 16);
+    return v >> (32 - n);
+  }
+
+  template <bool clearBits>
+  static inline void write(uint8_t* byte, const uint8_t mask) {
+    if constexpr (clearBits) {
+      *byte &= ~mask;
+    } else {
+      *byte |= mask;
+    }
+  }
+
+  // n ink bits, leftmost pixel first, to panel row `row` starting at panel x
+  template <bool clearBits>
+  static inline void writeSpan(uint8_t* row, const int x, const uint32_t bits, const int n) {
+    uint32_t aligned = bits << (32 - (x & 7) - n);
+    for (uint8_t* byte = row + (x >> 3); aligned; byte++, aligned <<= 8) {
+      if (const uint8_t mask = aligned >> 24) write<clearBits>(byte, mask);
+    }
+  }
+
+  // n ink bits of a glyph row chunk, `step` pixels into the clipped row that starts at panel (phyX, phyY)
+  template <Run run, bool clearBits, typename RowOf>
+  void writeRun(RowOf rowOf, const int phyX, const int phyY, const int step, uint32_t ink, const int n) const {
+    if constexpr (run == Run::Right) {
+      writeSpan<clearBits>(rowOf(phyY), phyX + step, ink, n);
+    } else if constexpr (run == Run::Left) {
+      writeSpan<clearBits>(rowOf(phyY), phyX - step - n + 1, reverseBits(ink, n), n);
+    } else {
+      // One bit per panel row: visit only the inked pixels
+      const uint8_t mask = 0x80 >> (phyX & 7);
+      const int column = phyX >> 3;
+      while (ink) {
+        const int bit = 31 - __builtin_clz(ink);
+        const int offset = step + n - 1 - bit;
+        write<clearBits>(rowOf(run == Run::Down ? phyY + offset : phyY - offset) + column, mask);
+        ink &= ~(1u << bit);
+      }
+    }
+  }
+
+  // writeRun() for all three planes of a run along a panel column, finding each inked pixel's panel row once. The
+  // gray ink of a 2-bit glyph is a subset of its BW ink and its LSB ink a subset of its MSB ink, so the gray planes
+  // walk only the MSB ink and OR in an LSB bit that is masked off where the pixel has none, which costs less than a
+  // branch on every pixel. 1-bit glyphs ink the same pixels in every plane.
+  template <Run run, bool is2Bit, bool clearBits>
+  void writeColumnAllPlanes(const int phyX, const int phyY, const int step, uint32_t ink, const uint32_t lsbInk,
+                            uint32_t msbInk, const int n) const {
+    const uint8_t mask = 0x80 >> (phyX & 7);
+    const int column = phyX >> 3;
+    const auto rowAt = [&](const int bit) {
+      const int offset = step + n - 1 - bit;
+      return run == Run::Down ? phyY + offset : phyY - offset;
+    };
+    if constexpr (is2Bit) {
+      while (ink) {
+        const int bit = 31 - __builtin_clz(ink);
+        write<clearBits>(fb + rowAt(bit) * widthBytes + column, mask);
+        ink &= ~(1u << bit);
+      }
+      while (msbInk) {
+        const int bit = 31 - __builtin_clz(msbInk);
+        const int y = rowAt(bit);
+        msbRows[y][column] |= mask;
+        lsbRows[y][column] |= mask & -static_cast<uint8_t>((lsbInk >> bit) & 1);
+        msbInk &= ~(1u << bit);
+      }
+    } else {
+      while (ink) {
+        const int bit = 31 - __builtin_clz(ink);
+        const int y = rowAt(bit);
+        write<clearBits>(fb + y * widthBytes + column, mask);
+        write<clearBits>(lsbRows[y] + column, mask);
+        write<clearBits>(msbRows[y] + column, mask);
+        ink &= ~(1u << bit);
+      }
+    }
+  }
+
+  template <Run run, bool is2Bit, bool clearBits, bool allPlanes>
+  void blitRows(const Job& job) const {
+    const auto fbRow = [this](const int y) { return fb + y * widthBytes; };
+    const auto lsbRow = [this](const int y) { return lsbRows[y]; };
+    const auto msbRow = [this](const int y) { return msbRows[y]; };
+    // The gray planes of 2-bit glyphs only ever gain ink; 1-bit glyphs draw pixelState there too
+    constexpr bool grayClearBits = !is2Bit && clearBits;
+
+    for (int gy = job.gy0; gy < job.gy1; gy++) {
+      const int phyX = job.phyX + job.gx0 * gxPhyX + gy * gyPhyX;
+      const int phyY = job.phyY + job.gx0 * gxPhyY + gy * gyPhyY;
+
+      for (int gx = job.gx0; gx < job.gx1; gx += CHUNK_PIXELS) {
+        const int n = std::min(CHUNK_PIXELS, job.gx1 - gx);
+        const int step = gx - job.gx0;
+        const uint64_t window = readPixels<is2Bit>(job, gy * job.width + gx, n);
+
+        uint32_t ink;
+        uint32_t lsbInk = 0;
+        uint32_t msbInk = 0;
+        if constexpr (is2Bit && allPlanes) {
+          planeInkBits(window, n, ink, lsbInk, msbInk);
+        } else if constexpr (is2Bit) {
+          ink = inkBits(window, n, job.inkTable);
+        } else {
+          // 1-bit glyphs mark the same pixels in every plane
+          ink = static_cast<uint32_t>(window >> (64 - n));
+          lsbInk = msbInk = ink;
+        }
+        if constexpr (allPlanes && (run == Run::Down || run == Run::Up)) {
+          if (ink) {
+            writeColumnAllPlanes<run, is2Bit, clearBits>(phyX, phyY, step, ink, lsbInk, msbInk, n);
+          }
+          continue;
+        }
+        if (ink) {
+          writeRun<run, clearBits>(fbRow, phyX, phyY, step, ink, n);
+        }
+
+        if constexpr (allPlanes) {
+          if (lsbInk) {
+            writeRun<run, grayClearBits>(lsbRow, phyX, phyY, step, lsbInk, n);
+          }
+          if (msbInk) {
+            writeRun<run, grayClearBits>(msbRow, phyX, phyY, step, msbInk, n);
+          }
+        }
+      }
+    }
+  }
+};
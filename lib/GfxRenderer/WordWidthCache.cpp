@@ -0,0 +1,138 @@
+#include "WordWidthCache.h"
+
+#include <Logging.h>
+
+#include <cstdlib>
+
+WordWidthCache::~WordWidthCache() { clear(); }
+
+WordWidthCache::Key WordWidthCache::makeKey(const int fontId, const uint8_t style, const char* word,
+                                            const size_t length) {
+  // FNV-1a over the font id, style and word bytes
+  uint32_t hash = 2166136261u;
+  const auto mix = [&hash](const uint8_t byte) {
+    hash ^= byte;
+    hash *= 16777619u;
+  };
+  for (int shift = 0; shift < 32; shift += 8) {
+    mix(static_cast<uint8_t>(static_cast<uint32_t>(fontId) >> shift));
+  }
+  mix(style);
+  for (size_t i = 0; i < length; i++) {
+    mix(static_cast<uint8_t>(word[i]));
+  }
+  return {hash, static_cast<uint16_t>(length > MAX_WORD_BYTES ? MAX_WORD_BYTES + 1 : length)};
+}
+
+WordWidthCache::Entry* WordWidthCache::find(const Key& key) {
+  if (!entries || !cacheable(key)) {
+    return nullptr;
+  }
+  for (uint8_t probe = 0; probe < PROBE_LIMIT; probe++) {
+    Entry& entry = entries[(key.hash + probe) & (CAPACITY - 1)];
+    if (entry.length == key.length && entry.hash == key.hash) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+bool WordWidthCache::findWidth(const Key& key, uint16_t& width) {
+  Entry* entry = find(key);
+  if (!entry) {
+    stats.misses++;
+    return false;
+  }
+  stats.hits++;
+  if (entry->uses < 31) {
+    entry->uses++;
+  }
+  width = entry->width;
+  return true;
+}
+
+void WordWidthCache::putWidth(const Key& key, const uint16_t width) {
+  if (!cacheable(key)) {
+    return;
+  }
+  if (!entries) {
+    entries = static_cast<Entry*>(calloc(CAPACITY, sizeof(Entry)));
+    if (!entries) {
+      LOG_ERR("WWC", "Failed to allocate word width cache");
+      return;
+    }
+  }
+
+  // An empty slot in the window, else its least used entry. The others age so once-common words can go too.
+  Entry* slot = nullptr;
+  Entry* leastUsed = nullptr;
+  for (uint8_t probe = 0; probe < PROBE_LIMIT && !slot; probe++) {
+    Entry& entry = entries[(key.hash + probe) & (CAPACITY - 1)];
+    if (entry.length == 0 || (entry.length == key.length && entry.hash == key.hash)) {
+      slot = &entry;
+    } else if (!leastUsed || entry.uses < leastUsed->uses) {
+      leastUsed = &entry;
+    }
+  }
+  if (!slot) {
+    slot = leastUsed;
+    for (uint8_t probe = 0; probe < PROBE_LIMIT; probe++) {
+      Entry& entry = entries[(key.hash + probe) & (CAPACITY - 1)];
+      entry.uses >>= 1;
+    }
+    stats.evictions++;
+  } else if (slot->length == 0) {
+    stats.entries++;
+  }
+
+  slot->hash = key.hash;
+  slot->width = width;
+  slot->length = static_cast<uint8_t>(key.length);
+  slot->prefixCount = 0;
+  slot->uses = 0;
+}
+
+bool WordWidthCache::findPrefixWidth(const Key& key, const size_t offset, const bool hyphen, uint16_t& width) {
+  const Entry* entry = find(key);
+  if (entry) {
+    const uint16_t tag = static_cast<uint16_t>(offset | (hyphen ? 0x100 : 0));
+    for (uint8_t i = 0; i < entry->prefixCount; i++) {
+      if (entry->prefixOffsets[i] == tag) {
+        stats.prefixHits++;
+        width = entry->prefixWidths[i];
+        return true;
+      }
+    }
+  }
+  stats.prefixMisses++;
+  return false;
+}
+
+void WordWidthCache::putPrefixWidth(const Key& key, const size_t offset, const bool hyphen, const uint16_t width) {
+  Entry* entry = find(key);
+  if (!entry || entry->prefixCount == MAX_PREFIXES || offset >= key.length) {
+    return;
+  }
+  entry->prefixOffsets[entry->prefixCount] = static_cast<uint16_t>(offset | (hyphen ? 0x100 : 0));
+  entry->prefixWidths[entry->prefixCount] = width;
+  entry->prefixCount++;
+}
+
+void WordWidthCache::clear() {
+  free(entries);
+  entries = nullptr;
+  stats.entries = 0;
+}
+
+void WordWidthCache::logStats(const char* label) {
+  const uint32_t total = stats.hits + stats.misses;
+  LOG_DBG("WWC", "[%s] hits=%lu misses=%lu (%.1f%% hit rate) prefix hits=%lu misses=%lu evictions=%lu entries=%u",
+          label, stats.hits, stats.misses, total > 0 ? 100.0f * stats.hits / total : 0.0f, stats.prefixHits,
+          stats.prefixMisses, stats.evictions, stats.entries);
+}
+
+void WordWidthCache::resetStats() {
+  const uint16_t entriesInUse = stats.entries;
+  stats = Stats();
+  stats.entries = entriesInUse;
+}
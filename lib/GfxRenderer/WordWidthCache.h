@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Advance widths of words measured by the line breaker, kept across paragraphs and sections so a word is measured
+// once per font and style instead of once per occurrence. Each entry also holds the widths of up to MAX_PREFIXES
+// hyphenation prefixes of its word, which the hyphenating line breaker would otherwise re-measure for every
+// candidate break.
+//
+// Open addressing over CAPACITY slots, allocated on first use: a word lives in one of the PROBE_LIMIT slots after
+// its hash, and a full window gives up its least used entry, so common words outlive the rare ones of a chapter.
+// Entries hold a hash of (fontId, style, word) and the word's length rather than the word, so an entry is 24 bytes.
+// GfxRenderer empties the cache whenever a font is added or removed, since a font id can come back with different
+// metrics.
+class WordWidthCache {
+ public:
+  static constexpr uint16_t CAPACITY = 512;  // power of two
+  static constexpr uint8_t PROBE_LIMIT = 4;
+  static constexpr uint8_t MAX_PREFIXES = 4;
+  static constexpr size_t MAX_WORD_BYTES = 255;  // longer words are measured every time
+
+  struct Key {
+    uint32_t hash;
+    uint16_t length;
+  };
+  static Key makeKey(int fontId, uint8_t style, const char* word, size_t length);
+
+  WordWidthCache() = default;
+  ~WordWidthCache();
+  WordWidthCache(const WordWidthCache&) = delete;
+  WordWidthCache& operator=(const WordWidthCache&) = delete;
+
+  bool findWidth(const Key& key, uint16_t& width);
+  void putWidth(const Key& key, uint16_t width);
+  // Width of the word's first `offset` bytes, with a hyphen appended when `hyphen` is set. Prefixes are only kept
+  // for words whose own width is cached.
+  bool findPrefixWidth(const Key& key, size_t offset, bool hyphen, uint16_t& width);
+  void putPrefixWidth(const Key& key, size_t offset, bool hyphen, uint16_t width);
+
+  // Drop every entry and free the table
+  void clear();
+
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t prefixHits = 0;
+    uint32_t prefixMisses = 0;
+    uint32_t evictions = 0;
+    uint16_t entries = 0;  // slots in use, as of the last change (not reset by resetStats)
+  };
+  // Logs the hit rate since the last resetStats()
+  void logStats(const char* label = "WWC");
+  void resetStats();
+  const Stats& getStats() const { return stats; }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    uint16_t width;
+    uint8_t length;
+    uint8_t prefixCount : 3;
+    uint8_t uses : 5;  // hits, saturating; halved for the other entries of a window that evicts
+    uint16_t prefixOffsets[MAX_PREFIXES];  // byte offset, bit 8 set when a hyphen is appended
+    uint16_t prefixWidths[MAX_PREFIXES];
+  };
+  static_assert(sizeof(Entry) == 24, "WordWidthCache::Entry should stay 24 bytes");
+
+  Entry* entries = nullptr;
+  Stats stats;
+
+  static bool cacheable(const Key& key) { return key.length > 0 && key.length <= MAX_WORD_BYTES; }
+  Entry* find(const Key& key);
+};
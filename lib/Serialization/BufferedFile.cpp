@@ -0,0 +1,165 @@
+#include "BufferedFile.h"
+
+#include <Logging.h>
+#include <Trace.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+BufferedFileWriter::BufferedFileWriter(FsFile& file, const size_t blockSize)
+    : file(file), blockSize(blockSize), blockStart(file.position()) {
+  buffer = static_cast<uint8_t*>(malloc(blockSize));
+  if (!buffer) {
+    LOG_ERR("BFW", "Failed to allocate %u byte write buffer, writing through", static_cast<uint32_t>(blockSize));
+  }
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+  flush();
+  free(buffer);
+}
+
+size_t BufferedFileWriter::write(const void* buf, const size_t count) {
+  if (!buffer || count >= blockSize) {
+    if (!flush()) {
+      return 0;
+    }
+    const size_t written = file.write(buf, count);
+    blockStart += written;
+    if (written != count) {
+      error = true;
+    }
+    return written;
+  }
+
+  if (used + count > blockSize && !flush()) {
+    return 0;
+  }
+  memcpy(buffer + used, buf, count);
+  used += count;
+  return count;
+}
+
+bool BufferedFileWriter::flush() {
+  if (used > 0) {
+    const size_t written = file.write(buffer, used);
+    blockStart += written;
+    if (written != used) {
+      LOG_ERR("BFW", "Short write: %u of %u bytes", static_cast<uint32_t>(written), static_cast<uint32_t>(used));
+      error = true;
+    }
+    used = 0;
+  }
+  return !error;
+}
+
+bool BufferedFileWriter::seek(const size_t pos) {
+  if (!flush()) {
+    return false;
+  }
+  if (!file.seek(pos)) {
+    error = true;
+    return false;
+  }
+  blockStart = pos;
+  return true;
+}
+
+BufferedFileReader::BufferedFileReader(FsFile& file, const size_t blockSize)
+    : file(file), blockSize(blockSize), blockStart(file.position()), filePos(blockStart), fileSize(file.size()) {
+  buffer = static_cast<uint8_t*>(malloc(blockSize));
+  if (!buffer) {
+    LOG_ERR("BFR", "Failed to allocate %u byte read buffer, reading through", static_cast<uint32_t>(blockSize));
+  }
+}
+
+BufferedFileReader::~BufferedFileReader() { free(buffer); }
+
+bool BufferedFileReader::fill() {
+  TRACE_SPAN("sd_read");
+  blockStart += blockPos;
+  blockPos = 0;
+  blockLen = 0;
+  if (filePos != blockStart) {
+    if (!file.seek(blockStart)) {
+      return false;
+    }
+    filePos = blockStart;
+  }
+  const int n = file.read(buffer, blockSize);
+  if (n <= 0) {
+    return false;
+  }
+  blockLen = n;
+  filePos += n;
+  return true;
+}
+
+int BufferedFileReader::readDirect(uint8_t* dest, const size_t count) {
+  TRACE_SPAN("sd_read");
+  blockStart += blockPos;
+  blockPos = 0;
+  blockLen = 0;
+  if (filePos != blockStart) {
+    if (!file.seek(blockStart)) {
+      return 0;
+    }
+    filePos = blockStart;
+  }
+  const int n = file.read(dest, count);
+  if (n <= 0) {
+    return 0;
+  }
+  blockStart += n;
+  filePos += n;
+  return n;
+}
+
+int BufferedFileReader::read(void* buf, const size_t count) {
+  auto* dest = static_cast<uint8_t*>(buf);
+  size_t done = 0;
+  while (done < count) {
+    if (blockPos < blockLen) {
+      const size_t n = std::min(count - done, blockLen - blockPos);
+      memcpy(dest + done, buffer + blockPos, n);
+      blockPos += n;
+      done += n;
+      continue;
+    }
+
+    // Buffer drained: reads of a block or more go straight into the caller's memory
+    if (!buffer || count - done >= blockSize) {
+      const int n = readDirect(dest + done, count - done);
+      if (n <= 0) {
+        break;
+      }
+      done += n;
+      continue;
+    }
+
+    if (!fill()) {
+      break;
+    }
+  }
+  return static_cast<int>(done);
+}
+
+int BufferedFileReader::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+bool BufferedFileReader::seek(const size_t pos) {
+  if (pos > fileSize) {
+    return false;
+  }
+  if (pos >= blockStart && pos <= blockStart + blockLen) {
+    blockPos = pos - blockStart;
+    return true;
+  }
+  blockStart = pos;
+  blockPos = 0;
+  blockLen = 0;
+  return true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Block-buffered wrappers over an open FsFile for the cache serializers.
+//
+// Every HalFile call takes the storage mutex and goes to the SD driver, so the field-by-field writePod/readPod
+// pattern used by the section and book caches costs one locked call per field. These wrappers gather those into
+// fixed-size blocks: one underlying write per block flushed and one underlying read per block filled.
+// If the block buffer cannot be allocated they fall back to passing every call straight through to the file.
+
+class BufferedFileWriter {
+ public:
+  // One SD sector, so every flush is a whole-sector write for the FAT layer.
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 512;
+
+  explicit BufferedFileWriter(FsFile& file, size_t blockSize = DEFAULT_BLOCK_SIZE);
+  // Flushes any pending bytes; the underlying file is left open.
+  ~BufferedFileWriter();
+  BufferedFileWriter(const BufferedFileWriter&) = delete;
+  BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+  size_t write(const void* buf, size_t count);
+  size_t write(uint8_t b) { return write(&b, 1); }
+  // Push buffered bytes to the file. Returns false if this or any earlier flush came up short.
+  bool flush();
+  // Flushes, then repositions the underlying file (used to patch headers once the body is written).
+  bool seek(size_t pos);
+  // Logical position including bytes still held in the buffer. Does not touch the file.
+  size_t position() const { return blockStart + used; }
+  bool hasError() const { return error; }
+
+ private:
+  FsFile& file;
+  uint8_t* buffer = nullptr;
+  size_t blockSize;
+  size_t used = 0;
+  size_t blockStart;
+  bool error = false;
+};
+
+class BufferedFileReader {
+ public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 512;
+
+  explicit BufferedFileReader(FsFile& file, size_t blockSize = DEFAULT_BLOCK_SIZE);
+  // The underlying file is left open, positioned wherever the last fill put it; seek before reading it directly.
+  ~BufferedFileReader();
+  BufferedFileReader(const BufferedFileReader&) = delete;
+  BufferedFileReader& operator=(const BufferedFileReader&) = delete;
+
+  // Returns the number of bytes copied, which is short only at end of file or on a read error.
+  int read(void* buf, size_t count);
+  int read();  // read a single byte, -1 at end of file
+  // Seeking inside the buffered window is free; anywhere else only records the target; the file is repositioned
+  // lazily by the next read that needs data from it.
+  bool seek(size_t pos);
+  size_t position() const { return blockStart + blockPos; }
+  size_t size() const { return fileSize; }
+  int available() const { return position() < fileSize ? static_cast<int>(fileSize - position()) : 0; }
+
+ private:
+  FsFile& file;
+  uint8_t* buffer = nullptr;
+  size_t blockSize;
+  size_t blockStart;    // file offset of buffer[0]
+  size_t blockLen = 0;  // valid bytes in buffer
+  size_t blockPos = 0;  // read cursor within buffer
+  size_t filePos;       // where the underlying file is actually positioned
+  size_t fileSize;
+
+  bool fill();
+  int readDirect(uint8_t* dest, size_t count);
+};
@@ -0,0 +1,140 @@
+#include "Trace.h"
+
+#ifdef ENABLE_TRACE
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+constexpr size_t MAX_TRACKS = 8;
+constexpr uint8_t PHASE_BEGIN = 0;
+constexpr uint8_t PHASE_END = 1;
+
+struct Event {
+  const char* name;
+  uint32_t micros;
+  uint8_t phase;
+  uint8_t track;
+};
+
+// One track per task; the task's name is copied when it first records, so it can be exported after the task is gone
+struct TrackInfo {
+  std::atomic<TaskHandle_t> task{nullptr};
+  char name[configMAX_TASK_NAME_LEN + 1] = {};
+};
+
+Event events[TRACE_BUFFER_EVENTS];
+TrackInfo tracks[MAX_TRACKS];
+// Total events ever recorded; the slot is this modulo the buffer size. Claimed with one atomic add, so tasks
+// recording at the same time never share a slot.
+std::atomic<uint32_t> recorded{0};
+
+uint8_t currentTrack() {
+  const TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+    TaskHandle_t owner = tracks[i].task.load(std::memory_order_acquire);
+    if (owner == nullptr) {
+      if (tracks[i].task.compare_exchange_strong(owner, task)) {
+        strncpy(tracks[i].name, pcTaskGetName(task), configMAX_TASK_NAME_LEN);
+        return i;
+      }
+      // Lost the slot to another task; owner now holds that task
+    }
+    if (owner == task) {
+      return i;
+    }
+  }
+  return MAX_TRACKS - 1;  // more tasks than tracks: share the last one
+}
+
+void record(const char* name, const uint8_t phase) {
+  const uint32_t index = recorded.fetch_add(1, std::memory_order_relaxed) % TRACE_BUFFER_EVENTS;
+  events[index] = {name, static_cast<uint32_t>(micros()), phase, currentTrack()};
+}
+
+// Names are string literals from the code base, but keep the JSON well-formed whatever they contain
+void writeEscaped(char* out, const size_t outSize, const char* s) {
+  size_t n = 0;
+  for (; *s && n + 2 < outSize; s++) {
+    if (*s == '"' || *s == '\\') {
+      out[n++] = '\\';
+    }
+    out[n++] = static_cast<unsigned char>(*s) < 0x20 ? ' ' : *s;
+  }
+  out[n] = '\0';
+}
+}  // namespace
+
+namespace Trace {
+void begin(const char* name) { record(name, PHASE_BEGIN); }
+
+void end(const char* name) { record(name, PHASE_END); }
+
+size_t eventCount() { return std::min<uint32_t>(recorded.load(), TRACE_BUFFER_EVENTS); }
+
+bool exportChromeJson(const std::function<void(const char* data, size_t len)>& write) {
+  // Taken once: events recorded while exporting may overwrite the oldest ones being read, which at worst garbles
+  // the start of the trace
+  const uint32_t total = recorded.load();
+  const uint32_t count = std::min<uint32_t>(total, TRACE_BUFFER_EVENTS);
+  const uint32_t first = total - count;
+
+  char line[160];
+  char escaped[64];
+  const char* separator = "";
+  const auto emit = [&](const int len) {
+    if (len > 0) {
+      write(line, std::min(static_cast<size_t>(len), sizeof(line) - 1));
+    }
+  };
+  const auto writeString = [&write](const char* s) { write(s, strlen(s)); };
+
+  writeString("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+    if (tracks[i].task.load() == nullptr) {
+      continue;
+    }
+    writeEscaped(escaped, sizeof(escaped), tracks[i].name);
+    emit(snprintf(line, sizeof(line),
+                  "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                  separator, i, escaped));
+    separator = ",";
+  }
+
+  // micros() wraps every ~71 minutes; timestamps are made relative to the oldest event and unwrapped in order
+  uint64_t timestamp = 0;
+  uint32_t previous = count > 0 ? events[first % TRACE_BUFFER_EVENTS].micros : 0;
+  for (uint32_t n = first; n < total; n++) {
+    const Event& event = events[n % TRACE_BUFFER_EVENTS];
+    timestamp += event.micros - previous;
+    previous = event.micros;
+    writeEscaped(escaped, sizeof(escaped), event.name ? event.name : "?");
+    emit(snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%u}", separator,
+                  escaped, event.phase == PHASE_BEGIN ? 'B' : 'E', static_cast<unsigned long long>(timestamp),
+                  event.track));
+    separator = ",";
+  }
+  writeString("]}");
+  return true;
+}
+
+void clear() { recorded.store(0); }
+}  // namespace Trace
+
+#else
+
+namespace Trace {
+size_t eventCount() { return 0; }
+
+bool exportChromeJson(const std::function<void(const char* data, size_t len)>&) { return false; }
+
+void clear() {}
+}  // namespace Trace
+
+#endif
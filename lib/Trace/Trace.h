@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/*
+Define ENABLE_TRACE to record trace spans (set in platformio.ini for every build except slim).
+
+TRACE_SPAN("name") records a begin event where it is declared and an end event when the enclosing scope exits,
+each with a microsecond timestamp and the FreeRTOS task it ran on, into a fixed ring buffer in RAM. The name must
+be a string literal: only the pointer is stored. Once the buffer is full the oldest events are overwritten, so it
+always holds the last TRACE_BUFFER_EVENTS events - a few page turns, or the tail of a chapter index.
+
+Trace::exportChromeJson() writes the buffer as Chrome trace event JSON, which chrome://tracing and
+https://ui.perfetto.dev open as a timeline with one track per task. The web server serves it at /api/trace.
+
+Without ENABLE_TRACE the macros compile to nothing and no buffer is reserved.
+*/
+
+#ifndef TRACE_BUFFER_EVENTS
+#define TRACE_BUFFER_EVENTS 1024
+#endif
+
+namespace Trace {
+#ifdef ENABLE_TRACE
+void begin(const char* name);
+void end(const char* name);
+
+class Span {
+  const char* name;
+
+ public:
+  explicit Span(const char* name) : name(name) { begin(name); }
+  ~Span() { end(name); }
+  Span(const Span&) = delete;
+  Span& operator=(const Span&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(name) const Trace::Span TRACE_CONCAT(traceSpan, __LINE__)(name)
+#else
+#define TRACE_SPAN(name)
+#endif
+
+// Events currently held, 0 without ENABLE_TRACE
+size_t eventCount();
+// Write the held events as {"traceEvents":[...]} in pieces of at most a few hundred bytes. Returns false without
+// ENABLE_TRACE. Spans still open, or whose begin was already overwritten, are exported as they are; the viewers
+// draw them up to the end or from the start of the trace.
+bool exportChromeJson(const std::function<void(const char* data, size_t len)>& write);
+void clear();
+}  // namespace Trace
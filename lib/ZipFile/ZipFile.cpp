@@ -3,8 +3,11 @@
 #include <HalStorage.h>
 #include <InflateReader.h>
 #include <Logging.h>
+#include <Trace.h>
 
 #include <algorithm>
+#include <cstring>
+#include <new>
 
 struct ZipInflateCtx {
   InflateReader reader;  // Must be first — callback casts uzlib_uncomp* to ZipInflateCtx*
@@ -56,6 +59,10 @@ int zipReadCallback(uzlib_uncomp* uncomp) {
 }
 }  // namespace
 
+ZipFile::ZipFile(const std::string& filePath) : filePath(filePath) {}
+
+ZipFile::~ZipFile() { endStream(); }
+
 bool ZipFile::loadAllFileStatSlims() {
   const ScopedOpenClose zip{*this};
   if (!zip) return false;
@@ -442,6 +449,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
 }
 
 bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+  TRACE_SPAN("zip_extract");
   const ScopedOpenClose zip{*this};
   if (!zip) return false;
 
@@ -559,3 +567,104 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   LOG_ERR("ZIP", "Unsupported compression method");
   return false;
 }
+
+bool ZipFile::beginStream(const char* filename, const size_t chunkSize, size_t* inflatedSize) {
+  endStream();
+  if (!isOpen() && !open()) return false;
+
+  FileStatSlim fileStat = {};
+  if (!loadFileStatSlim(filename, &fileStat)) {
+    close();
+    return false;
+  }
+
+  if (fileStat.method != ZIP_METHOD_STORED && fileStat.method != ZIP_METHOD_DEFLATED) {
+    LOG_ERR("ZIP", "Unsupported compression method");
+    close();
+    return false;
+  }
+
+  const long fileOffset = getDataOffset(fileStat);
+  if (fileOffset < 0) {
+    close();
+    return false;
+  }
+
+  std::unique_ptr<ZipInflateCtx> ctx(new (std::nothrow) ZipInflateCtx());
+  if (!ctx) {
+    LOG_ERR("ZIP", "Failed to allocate stream context");
+    close();
+    return false;
+  }
+
+  ctx->readBuf = static_cast<uint8_t*>(malloc(chunkSize));
+  if (!ctx->readBuf) {
+    LOG_ERR("ZIP", "Failed to allocate memory for zip file read buffer");
+    close();
+    return false;
+  }
+  ctx->readBufSize = chunkSize;
+  ctx->file = &file;
+  ctx->fileRemaining = fileStat.compressedSize;
+
+  if (fileStat.method == ZIP_METHOD_DEFLATED) {
+    if (!ctx->reader.init(true)) {
+      LOG_ERR("ZIP", "Failed to init inflate reader");
+      free(ctx->readBuf);
+      close();
+      return false;
+    }
+    ctx->reader.setReadCallback(zipReadCallback);
+  }
+
+  file.seek(fileOffset);
+  streamMethod = fileStat.method;
+  streamRemaining = fileStat.uncompressedSize;
+  streamCtx = std::move(ctx);
+  if (inflatedSize) *inflatedSize = fileStat.uncompressedSize;
+  return true;
+}
+
+int ZipFile::readStream(uint8_t* dest, const size_t maxLen) {
+  TRACE_SPAN("inflate");
+  if (!streamCtx) return -1;
+  if (streamRemaining == 0 || maxLen == 0) return 0;
+
+  const size_t wanted = streamRemaining < maxLen ? streamRemaining : maxLen;
+
+  if (streamMethod == ZIP_METHOD_STORED) {
+    const int dataRead = file.read(dest, wanted);
+    if (dataRead <= 0) {
+      LOG_ERR("ZIP", "Could not read more bytes");
+      return -1;
+    }
+    streamRemaining -= dataRead;
+    return dataRead;
+  }
+
+  size_t produced = 0;
+  const InflateStatus status = streamCtx->reader.readAtMost(dest, wanted, &produced);
+  if (status == InflateStatus::Error) {
+    LOG_ERR("ZIP", "Decompression failed");
+    return -1;
+  }
+  if (status == InflateStatus::Done && produced != streamRemaining) {
+    LOG_ERR("ZIP", "Decompressed size mismatch (%zu bytes short)", static_cast<size_t>(streamRemaining - produced));
+    return -1;
+  }
+  if (produced == 0) {
+    LOG_ERR("ZIP", "Inflate made no progress");
+    return -1;
+  }
+
+  streamRemaining -= produced;
+  return static_cast<int>(produced);
+}
+
+void ZipFile::endStream() {
+  if (!streamCtx) return;
+  free(streamCtx->readBuf);
+  streamCtx.reset();  // InflateReader destructor frees the ring buffer
+  streamRemaining = 0;
+  close();
+}
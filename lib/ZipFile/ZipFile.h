@@ -2,9 +2,12 @@
 #include <HalStorage.h>
 
 #include <deque>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
+struct ZipInflateCtx;
+
 class ZipFile {
  public:
   struct FileStatSlim {
@@ -47,13 +50,18 @@ class ZipFile {
   uint32_t lastCentralDirPos = 0;
   bool lastCentralDirPosValid = false;
 
+  // Pull-based entry stream state (see beginStream)
+  std::unique_ptr<ZipInflateCtx> streamCtx;
+  uint16_t streamMethod = 0;
+  uint32_t streamRemaining = 0;  // Inflated bytes still expected from the open entry
+
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
-  ~ZipFile() = default;
+  explicit ZipFile(const std::string& filePath);
+  ~ZipFile();
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
   bool isOpen() const { return !!file; }
@@ -69,4 +77,14 @@ class ZipFile {
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
   bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+
+  // Pull-based alternative to readFileToStream: the caller drives the loop and inflates straight into its own
+  // buffer (e.g. expat's parse buffer), so nothing has to be staged on SD.
+  // beginStream() opens the zip and keeps it open, together with a chunkSize read buffer and (for deflated
+  // entries) the 32KB inflate window, until endStream() or destruction.
+  bool beginStream(const char* filename, size_t chunkSize, size_t* inflatedSize = nullptr);
+  // Returns the number of bytes written to dest, 0 once the entry is fully read, or -1 on error.
+  int readStream(uint8_t* dest, size_t maxLen);
+  void endStream();
+  bool isStreaming() const { return streamCtx != nullptr; }
 };
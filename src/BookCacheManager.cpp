@@ -0,0 +1,415 @@
+#include "BookCacheManager.h"
+
+#include <BufferedFile.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint8_t CACHE_INDEX_FILE_VERSION = 1;
+constexpr char CACHE_ROOT[] = "/.crosspoint";
+constexpr char CACHE_INDEX_FILE[] = "/.crosspoint/cache_index.bin";
+// Kept on eviction: it is the only user data in a book's cache directory
+constexpr char PROGRESS_FILE[] = "progress.bin";
+// An evicted directory only holds progress.bin; anything this small has nothing left worth evicting
+constexpr uint64_t EVICTED_RESIDUAL_BYTES = 4 * 1024;
+constexpr uint16_t MAX_ENTRIES = 4096;
+constexpr size_t MAX_WALK_DEPTH = 4;
+// Directory entries one maintenance step may read or delete, so a step stays short however big a book's cache is
+constexpr int ENTRIES_PER_STEP = 16;
+
+bool isBookCacheDir(const char* name) {
+  return strncmp(name, "epub_", 5) == 0 || strncmp(name, "xtc_", 4) == 0 || strncmp(name, "txt_", 4) == 0;
+}
+}  // namespace
+
+BookCacheManager BookCacheManager::instance;
+
+bool BookCacheManager::loadFromFile() {
+  entries.clear();
+  accessClock = 0;
+  FsFile file;
+  if (!Storage.exists(CACHE_INDEX_FILE) || !Storage.openFileForRead("BCM", CACHE_INDEX_FILE, file)) {
+    return false;
+  }
+  BufferedFileReader in(file);
+
+  uint8_t version;
+  serialization::readPod(in, version);
+  if (version != CACHE_INDEX_FILE_VERSION) {
+    LOG_DBG("BCM", "Ignoring cache index with version %u", version);
+    return false;
+  }
+  uint16_t count;
+  serialization::readPod(in, accessClock);
+  serialization::readPod(in, count);
+  if (count > MAX_ENTRIES) {
+    LOG_ERR("BCM", "Corrupt cache index: %u entries", count);
+    return false;
+  }
+  entries.reserve(count);
+  char name[256];
+  for (uint16_t i = 0; i < count; i++) {
+    Entry entry;
+    uint8_t nameLen;
+    serialization::readPod(in, nameLen);
+    if (in.read(name, nameLen) != nameLen) {
+      LOG_ERR("BCM", "Truncated cache index");
+      entries.clear();
+      return false;
+    }
+    entry.dirName.assign(name, nameLen);
+    serialization::readPod(in, entry.sizeBytes);
+    serialization::readPod(in, entry.lastAccess);
+    uint8_t sizeKnown;
+    serialization::readPod(in, sizeKnown);
+    entry.sizeKnown = sizeKnown != 0;
+    entries.push_back(std::move(entry));
+  }
+  return true;
+}
+
+bool BookCacheManager::saveToFile() {
+  Storage.mkdir(CACHE_ROOT);
+  FsFile file;
+  if (!Storage.openFileForWrite("BCM", CACHE_INDEX_FILE, file)) {
+    return false;
+  }
+  BufferedFileWriter out(file);
+  serialization::writePod(out, CACHE_INDEX_FILE_VERSION);
+  serialization::writePod(out, accessClock);
+  serialization::writePod(out, static_cast<uint16_t>(entries.size()));
+  for (const auto& entry : entries) {
+    const auto nameLen = static_cast<uint8_t>(std::min<size_t>(entry.dirName.size(), UINT8_MAX));
+    serialization::writePod(out, nameLen);
+    out.write(entry.dirName.data(), nameLen);
+    serialization::writePod(out, entry.sizeBytes);
+    serialization::writePod(out, entry.lastAccess);
+    serialization::writePod(out, static_cast<uint8_t>(entry.sizeKnown));
+  }
+  if (!out.flush()) {
+    LOG_ERR("BCM", "Failed to write cache index");
+    file.close();
+    Storage.remove(CACHE_INDEX_FILE);
+    return false;
+  }
+  dirty = false;
+  return true;
+}
+
+void BookCacheManager::ensureLoaded() {
+  if (!loaded) {
+    if (!loadFromFile()) {
+      // Rebuilt from the directory listing; every book starts out equally old
+      needsReconcile = true;
+    }
+    loaded = true;
+  }
+}
+
+BookCacheManager::Entry* BookCacheManager::findEntry(const std::string& dirName) {
+  const auto it =
+      std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) { return entry.dirName == dirName; });
+  return it != entries.end() ? &*it : nullptr;
+}
+
+void BookCacheManager::touch(const std::string& cachePath) {
+  const size_t slash = cachePath.find_last_of('/');
+  const std::string dirName = slash == std::string::npos ? cachePath : cachePath.substr(slash + 1);
+  if (!isBookCacheDir(dirName.c_str())) {
+    return;
+  }
+  ensureLoaded();
+
+  Entry* entry = findEntry(dirName);
+  if (!entry) {
+    if (entries.size() >= MAX_ENTRIES) {
+      return;
+    }
+    entries.push_back({dirName});
+    entry = &entries.back();
+  }
+  entry->lastAccess = ++accessClock;
+  // The reader is about to fill the directory; measure it again later
+  entry->sizeKnown = false;
+  if (walkDirName == dirName) {
+    // Never evict a book that was just opened, and measure it afresh
+    resetWalks();
+  }
+  saveToFile();
+}
+
+void BookCacheManager::invalidate() {
+  if (reconcileRoot) {
+    reconcileRoot.close();
+  }
+  reconcileFound.clear();
+  resetWalks();
+  needsReconcile = true;
+}
+
+void BookCacheManager::reconcileStep() {
+  if (!reconcileRoot) {
+    reconcileFound.clear();
+    reconcileRoot = Storage.open(CACHE_ROOT);
+    if (!reconcileRoot || !reconcileRoot.isDirectory()) {
+      if (reconcileRoot) reconcileRoot.close();
+      resetWalks();
+      entries.clear();
+      dirty = true;
+      needsReconcile = false;
+      return;
+    }
+  }
+
+  char name[128];
+  for (int i = 0; i < ENTRIES_PER_STEP; i++) {
+    auto file = reconcileRoot.openNextFile();
+    if (!file) {
+      reconcileRoot.close();
+      finishReconcile();
+      return;
+    }
+    if (file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      if (isBookCacheDir(name)) {
+        reconcileFound.emplace_back(name);
+      }
+    }
+    file.close();
+  }
+}
+
+void BookCacheManager::finishReconcile() {
+  const auto& onCard = reconcileFound;
+  if (!walkDirName.empty() && std::find(onCard.begin(), onCard.end(), walkDirName) == onCard.end()) {
+    resetWalks();
+  }
+
+  const size_t before = entries.size();
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&](const Entry& entry) {
+                                 return std::find(onCard.begin(), onCard.end(), entry.dirName) == onCard.end();
+                               }),
+                entries.end());
+  const size_t removed = before - entries.size();
+  size_t added = 0;
+  for (const auto& dirName : onCard) {
+    if (entries.size() >= MAX_ENTRIES) {
+      break;
+    }
+    if (!findEntry(dirName)) {
+      // Unknown directories sort as least recently read
+      entries.push_back({dirName});
+      added++;
+    }
+  }
+  if (added > 0 || removed > 0) {
+    dirty = true;
+  }
+  reconcileFound.clear();
+  reconcileFound.shrink_to_fit();
+  needsReconcile = false;
+  LOG_DBG("BCM", "Cache index reconciled: %u books (%u new)", static_cast<uint32_t>(entries.size()),
+          static_cast<uint32_t>(added));
+}
+
+BookCacheManager::Entry* BookCacheManager::findEvictionCandidate() {
+  Entry* newest = nullptr;
+  for (auto& entry : entries) {
+    if (!newest || entry.lastAccess > newest->lastAccess) {
+      newest = &entry;
+    }
+  }
+  Entry* oldest = nullptr;
+  for (auto& entry : entries) {
+    if (&entry == newest || entry.sizeBytes <= EVICTED_RESIDUAL_BYTES) {
+      continue;
+    }
+    if (!oldest || entry.lastAccess < oldest->lastAccess) {
+      oldest = &entry;
+    }
+  }
+  return oldest;
+}
+
+void BookCacheManager::startWalk(const Entry& entry, const bool evict) {
+  const std::string path = std::string(CACHE_ROOT) + "/" + entry.dirName;
+  walkDirName = entry.dirName;
+  walkBytes = 0;
+  if (evict) {
+    LOG_INF("BCM", "Evicting %s (%llu bytes)", path.c_str(), static_cast<unsigned long long>(entry.sizeBytes));
+    evictDirs.push_back({path});
+    return;
+  }
+  auto dir = Storage.open(path.c_str());
+  if (dir && dir.isDirectory()) {
+    measureDirs.push_back(std::move(dir));
+  } else {
+    if (dir) dir.close();
+    finishWalk();
+  }
+}
+
+void BookCacheManager::measureStep() {
+  int budget = ENTRIES_PER_STEP;
+  while (budget > 0 && !measureDirs.empty()) {
+    auto file = measureDirs.back().openNextFile();
+    if (!file) {
+      measureDirs.back().close();
+      measureDirs.pop_back();
+      continue;
+    }
+    budget--;
+    if (file.isDirectory()) {
+      if (measureDirs.size() <= MAX_WALK_DEPTH) {
+        measureDirs.push_back(std::move(file));
+        continue;
+      }
+    } else {
+      walkBytes += file.fileSize64();
+    }
+    file.close();
+  }
+  if (measureDirs.empty()) {
+    finishWalk();
+  }
+}
+
+void BookCacheManager::evictStep() {
+  struct Child {
+    std::string name;
+    bool isDir;
+    uint64_t size;
+  };
+
+  int budget = ENTRIES_PER_STEP;
+  while (budget > 0 && !evictDirs.empty()) {
+    // Collect names first; deleting while iterating a FAT directory skips entries. The directory is listed again on
+    // every pass, so the entries it keeps come first and are stepped over.
+    std::vector<Child> batch;
+    bool listed = false;
+    auto dir = Storage.open(evictDirs.back().path.c_str());
+    if (dir && dir.isDirectory()) {
+      char name[128];
+      uint16_t skipped = 0;
+      while (budget > 0) {
+        auto file = dir.openNextFile();
+        if (!file) {
+          listed = true;
+          break;
+        }
+        if (skipped < evictDirs.back().kept) {
+          skipped++;
+          file.close();
+          continue;
+        }
+        budget--;
+        file.getName(name, sizeof(name));
+        batch.push_back({name, file.isDirectory(), file.isDirectory() ? 0 : file.fileSize64()});
+        file.close();
+        if (batch.back().isDir) {
+          // Empty it before listing any further
+          break;
+        }
+      }
+    } else {
+      listed = true;
+    }
+    if (dir) dir.close();
+
+    const bool bookRoot = evictDirs.size() == 1;
+    const std::string path = evictDirs.back().path;
+    for (const auto& child : batch) {
+      const std::string childPath = path + "/" + child.name;
+      if (child.isDir) {
+        evictDirs.push_back({childPath});
+      } else if (bookRoot && child.name == PROGRESS_FILE) {
+        evictDirs.back().kept++;
+        walkBytes += child.size;
+      } else if (!Storage.remove(childPath.c_str())) {
+        LOG_ERR("BCM", "Failed to remove %s", childPath.c_str());
+        evictDirs.back().kept++;
+        walkBytes += child.size;
+      }
+    }
+
+    if (listed && (batch.empty() || !batch.back().isDir)) {
+      // Everything left in the directory stays
+      evictDirs.pop_back();
+      if (!bookRoot && !Storage.rmdir(path.c_str())) {
+        LOG_ERR("BCM", "Failed to remove %s", path.c_str());
+        evictDirs.back().kept++;
+      }
+    }
+  }
+  if (evictDirs.empty()) {
+    finishWalk();
+  }
+}
+
+void BookCacheManager::finishWalk() {
+  if (Entry* entry = findEntry(walkDirName)) {
+    entry->sizeBytes = walkBytes;
+    entry->sizeKnown = true;
+    dirty = true;
+  }
+  resetWalks();
+}
+
+void BookCacheManager::resetWalks() {
+  for (auto& dir : measureDirs) {
+    dir.close();
+  }
+  measureDirs.clear();
+  evictDirs.clear();
+  walkDirName.clear();
+  walkBytes = 0;
+}
+
+bool BookCacheManager::maintenanceStep(const uint64_t budgetBytes) {
+  if (!loaded) {
+    ensureLoaded();
+    return true;
+  }
+  if (needsReconcile) {
+    reconcileStep();
+    return true;
+  }
+  if (!measureDirs.empty()) {
+    measureStep();
+    return true;
+  }
+  if (!evictDirs.empty()) {
+    evictStep();
+    return true;
+  }
+
+  for (const auto& entry : entries) {
+    if (!entry.sizeKnown) {
+      startWalk(entry, false);
+      return true;
+    }
+  }
+
+  if (budgetBytes > 0) {
+    uint64_t total = 0;
+    for (const auto& entry : entries) {
+      total += entry.sizeBytes;
+    }
+    if (total > budgetBytes) {
+      if (const Entry* victim = findEvictionCandidate()) {
+        startWalk(*victim, true);
+        return true;
+      }
+    }
+  }
+
+  if (dirty) {
+    saveToFile();
+  }
+  return false;
+}
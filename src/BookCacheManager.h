@@ -0,0 +1,86 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * BookCacheManager
+ *
+ * Keeps the per-book cache directories under /.crosspoint (epub_*, xtc_*, txt_*) within a byte budget. A small index
+ * records each directory's size and when its book was last opened; when the total exceeds the budget the least
+ * recently read books are evicted. All SD work happens in maintenanceStep(), which reads or deletes at most a fixed
+ * number of directory entries per call and picks up where the previous call stopped. The main loop only drives it
+ * while the device is idle, and not while a book is open unless USB power is connected.
+ *
+ * Eviction deletes everything in a book's directory except progress.bin, so the reading position survives and the
+ * rest is rebuilt the next time the book is opened.
+ */
+class BookCacheManager {
+  struct Entry {
+    std::string dirName;
+    uint64_t sizeBytes = 0;
+    // Value of accessClock when the book was last opened. There is no wall clock, so this is only an ordering.
+    uint32_t lastAccess = 0;
+    bool sizeKnown = false;
+  };
+
+  // Static instance
+  static BookCacheManager instance;
+
+  // A directory an eviction is emptying, and how many of its entries stay (progress.bin, failed removals)
+  struct EvictDir {
+    std::string path;
+    uint16_t kept = 0;
+  };
+
+  std::vector<Entry> entries;
+  uint32_t accessClock = 0;
+  bool loaded = false;
+  bool needsReconcile = true;
+  bool dirty = false;
+
+  // Resumable state of the step under way, so no single step walks a whole directory tree
+  FsFile reconcileRoot;  // open on the cache root while reconcileStep() lists it
+  std::vector<std::string> reconcileFound;
+  std::string walkDirName;          // book directory being measured or evicted, empty if none
+  uint64_t walkBytes = 0;           // bytes found so far, or left behind by the eviction
+  std::vector<FsFile> measureDirs;  // open directories of a measuring walk, outermost first
+  std::vector<EvictDir> evictDirs;  // directories an eviction is emptying, innermost last
+
+  bool loadFromFile();
+  bool saveToFile();
+  void ensureLoaded();
+  // Sync the index with the cache directories actually on the card, a few root entries per call
+  void reconcileStep();
+  void finishReconcile();
+  Entry* findEntry(const std::string& dirName);
+  // Least recently read entry that still holds evictable data, never the most recently read one
+  Entry* findEvictionCandidate();
+  void startWalk(const Entry& entry, bool evict);
+  void measureStep();
+  void evictStep();
+  // Store the walk's result in its entry and forget the walk
+  void finishWalk();
+  void resetWalks();
+
+ public:
+  ~BookCacheManager() = default;
+
+  // Get singleton instance
+  static BookCacheManager& getInstance() { return instance; }
+
+  // Record that a book's cache directory is in use. Its size is re-measured on the next maintenance pass.
+  void touch(const std::string& cachePath);
+  // Cache directories were removed or added behind the manager's back (e.g. the clear cache action)
+  void invalidate();
+
+  // One bounded unit of maintenance: load the index, or read or delete up to ENTRIES_PER_STEP directory entries while
+  // reconciling the index, measuring a book or evicting one. budgetBytes of 0 means unlimited. Returns true if there
+  // is more work to do.
+  bool maintenanceStep(uint64_t budgetBytes);
+};
+
+// Helper macro to access the book cache manager
+#define BOOK_CACHE BookCacheManager::getInstance()
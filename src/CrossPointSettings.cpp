@@ -317,6 +317,25 @@ unsigned long CrossPointSettings::getSleepTimeoutMs() const {
   }
 }
 
+uint64_t CrossPointSettings::getBookCacheLimitBytes() const {
+  constexpr uint64_t MB = 1024 * 1024;
+  switch (bookCacheLimit) {
+    case CACHE_LIMIT_128MB:
+      return 128 * MB;
+    case CACHE_LIMIT_256MB:
+      return 256 * MB;
+    case CACHE_LIMIT_512MB:
+    default:
+      return 512 * MB;
+    case CACHE_LIMIT_1GB:
+      return 1024 * MB;
+    case CACHE_LIMIT_2GB:
+      return 2048 * MB;
+    case CACHE_LIMIT_UNLIMITED:
+      return 0;
+  }
+}
+
 int CrossPointSettings::getRefreshFrequency() const {
   switch (refreshFrequency) {
     case REFRESH_1:
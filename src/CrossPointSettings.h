@@ -154,6 +154,17 @@ class CrossPointSettings {
 
   enum TILT_PAGE_TURN { TILT_OFF = 0, TILT_NORMAL = 1, TILT_NVERTED = 2, TILT_PAGE_TURN_COUNT };
 
+  // Size budget for cached book data (sections, images, covers) before least recently read books are evicted
+  enum BOOK_CACHE_LIMIT {
+    CACHE_LIMIT_128MB = 0,
+    CACHE_LIMIT_256MB = 1,
+    CACHE_LIMIT_512MB = 2,
+    CACHE_LIMIT_1GB = 3,
+    CACHE_LIMIT_2GB = 4,
+    CACHE_LIMIT_UNLIMITED = 5,
+    BOOK_CACHE_LIMIT_COUNT
+  };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -223,6 +234,8 @@ class CrossPointSettings {
   uint8_t imageRendering = IMAGES_DISPLAY;
   // Tilt-based page turning (X3 only — requires QMI8658 IMU)
   uint8_t tiltPageTurn = TILT_OFF;
+  // Book cache size budget
+  uint8_t bookCacheLimit = CACHE_LIMIT_512MB;
   // Language setting (Language enum index, default 0 = EN)
   uint8_t language = 0;
 
@@ -258,6 +271,8 @@ class CrossPointSettings {
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  // 0 when unlimited
+  uint64_t getBookCacheLimitBytes() const;
 };
 
 // Helper macro to access settings
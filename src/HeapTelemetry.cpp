@@ -0,0 +1,72 @@
+#include "HeapTelemetry.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <esp_heap_caps.h>
+
+#include <algorithm>
+
+HeapTelemetry HeapTelemetry::instance;
+
+namespace {
+constexpr const char* CHECKPOINT_NAMES[] = {"boot", "bookOpen", "sectionBuild", "pageRender", "wifiStart",
+                                            "webServerStart"};
+static_assert(sizeof(CHECKPOINT_NAMES) / sizeof(CHECKPOINT_NAMES[0]) ==
+                  static_cast<size_t>(HeapTelemetry::Checkpoint::COUNT),
+              "Every checkpoint needs a name");
+}  // namespace
+
+uint8_t HeapTelemetry::Sample::fragmentationPercent() const {
+  if (freeBytes == 0 || largestFreeBlock >= freeBytes) {
+    return 0;
+  }
+  return static_cast<uint8_t>(100 - static_cast<uint64_t>(largestFreeBlock) * 100 / freeBytes);
+}
+
+HeapTelemetry::Sample HeapTelemetry::sample() {
+  // One walk of the heap gives all three numbers consistently; heap_caps_get_info takes the heap lock for it
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  Sample s;
+  s.freeBytes = info.total_free_bytes;
+  s.largestFreeBlock = info.largest_free_block;
+  s.allocatedBlocks = info.allocated_blocks;
+  return s;
+}
+
+const char* HeapTelemetry::name(const Checkpoint checkpoint) {
+  const auto index = static_cast<uint8_t>(checkpoint);
+  return index < static_cast<uint8_t>(Checkpoint::COUNT) ? CHECKPOINT_NAMES[index] : "unknown";
+}
+
+void HeapTelemetry::record(const Checkpoint checkpoint) {
+  const auto index = static_cast<uint8_t>(checkpoint);
+  if (index >= static_cast<uint8_t>(Checkpoint::COUNT)) {
+    return;
+  }
+  const Sample s = sample();
+  Stats& entry = stats[index];
+  if (entry.count == 0) {
+    entry.min = s;
+    entry.max = s;
+  } else {
+    entry.min.freeBytes = std::min(entry.min.freeBytes, s.freeBytes);
+    entry.min.largestFreeBlock = std::min(entry.min.largestFreeBlock, s.largestFreeBlock);
+    entry.min.allocatedBlocks = std::min(entry.min.allocatedBlocks, s.allocatedBlocks);
+    entry.max.freeBytes = std::max(entry.max.freeBytes, s.freeBytes);
+    entry.max.largestFreeBlock = std::max(entry.max.largestFreeBlock, s.largestFreeBlock);
+    entry.max.allocatedBlocks = std::max(entry.max.allocatedBlocks, s.allocatedBlocks);
+  }
+  entry.maxFragmentationPercent = std::max(entry.maxFragmentationPercent, s.fragmentationPercent());
+  entry.last = s;
+  entry.lastMillis = millis();
+  entry.count++;
+  LOG_DBG("HEAP", "%s: free %u, largest %u, blocks %u, frag %u%%", name(checkpoint), s.freeBytes,
+          s.largestFreeBlock, s.allocatedBlocks, s.fragmentationPercent());
+}
+
+void HeapTelemetry::reset() {
+  for (auto& entry : stats) {
+    entry = Stats();
+  }
+}
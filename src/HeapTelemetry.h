@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * HeapTelemetry
+ *
+ * Samples the heap (free bytes, largest free block, allocated block count) at named checkpoints right after the
+ * operations that decide whether the next big allocation fits - opening a book, laying out a chapter, rendering a
+ * page, bringing up Wi-Fi - and keeps the last sample plus the min/max seen at each checkpoint since boot. Everything
+ * lives in a fixed table in RAM, so recording never allocates. Shown on the memory diagnostics screen and served as
+ * JSON from /api/diagnostics.
+ */
+class HeapTelemetry {
+ public:
+  enum class Checkpoint : uint8_t { Boot, BookOpen, SectionBuild, PageRender, WifiStart, WebServerStart, COUNT };
+
+  struct Sample {
+    uint32_t freeBytes = 0;
+    uint32_t largestFreeBlock = 0;
+    uint32_t allocatedBlocks = 0;
+
+    // Share of the free heap that can't be had in one allocation, 0-100
+    uint8_t fragmentationPercent() const;
+  };
+
+  struct Stats {
+    uint32_t count = 0;
+    uint32_t lastMillis = 0;
+    Sample last;
+    // Each field's extreme on its own, not one sample
+    Sample min;
+    Sample max;
+    uint8_t maxFragmentationPercent = 0;
+  };
+
+ private:
+  // Static instance
+  static HeapTelemetry instance;
+
+  Stats stats[static_cast<uint8_t>(Checkpoint::COUNT)];
+
+ public:
+  static HeapTelemetry& getInstance() { return instance; }
+
+  static Sample sample();
+  static const char* name(Checkpoint checkpoint);
+
+  void record(Checkpoint checkpoint);
+  const Stats& get(const Checkpoint checkpoint) const { return stats[static_cast<uint8_t>(checkpoint)]; }
+  void reset();
+};
+
+// Helper macro to access the heap telemetry
+#define HEAP_TELEMETRY HeapTelemetry::getInstance()
@@ -174,6 +174,10 @@ inline std::vector<SettingInfo> getSettingsList(const SdCardFontRegistry* regist
         SettingInfo::Enum(StrId::STR_TIME_TO_SLEEP, &CrossPointSettings::sleepTimeout,
                           {StrId::STR_MIN_1, StrId::STR_MIN_5, StrId::STR_MIN_10, StrId::STR_MIN_15, StrId::STR_MIN_30},
                           "sleepTimeout", StrId::STR_CAT_SYSTEM),
+        SettingInfo::Enum(StrId::STR_BOOK_CACHE_LIMIT, &CrossPointSettings::bookCacheLimit,
+                          {StrId::STR_MB_128, StrId::STR_MB_256, StrId::STR_MB_512, StrId::STR_GB_1, StrId::STR_GB_2,
+                           StrId::STR_UNLIMITED},
+                          "bookCacheLimit", StrId::STR_CAT_SYSTEM),
         SettingInfo::Toggle(StrId::STR_SHOW_HIDDEN_FILES, &CrossPointSettings::showHiddenFiles, "showHiddenFiles",
                             StrId::STR_CAT_SYSTEM),
 
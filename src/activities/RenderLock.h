@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 class Activity;  // forward declaration
 
@@ -9,9 +10,12 @@ class RenderLock {
  public:
   explicit RenderLock();
   explicit RenderLock(Activity&);  // unused for now, but keep for compatibility
+  // Wait at most timeoutMs for the lock; check isHeld() before touching render state
+  explicit RenderLock(uint32_t timeoutMs);
   RenderLock(const RenderLock&) = delete;
   RenderLock& operator=(const RenderLock&) = delete;
   ~RenderLock();
   void unlock();
+  bool isHeld() const { return isLocked; }
   static bool peek();
 };
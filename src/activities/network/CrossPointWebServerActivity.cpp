@@ -2,6 +2,7 @@
 
 #include <DNSServer.h>
 #include <ESPmDNS.h>
+#include <FontCacheManager.h>
 #include <GfxRenderer.h>
 #include <I18n.h>
 #include <WiFi.h>
@@ -9,6 +10,7 @@
 
 #include <cstddef>
 
+#include "HeapTelemetry.h"
 #include "MappedInputManager.h"
 #include "NetworkModeSelectionActivity.h"
 #include "WifiSelectionActivity.h"
@@ -193,6 +195,10 @@ void CrossPointWebServerActivity::onWifiSelectionComplete(const bool connected)
 
 void CrossPointWebServerActivity::startAccessPoint() {
   LOG_DBG("WEBACT", "Starting Access Point mode...");
+  if (renderer.getFontCacheManager()) {
+    renderer.getFontCacheManager()->releaseMemory();
+  }
+  renderer.getWordWidthCache().clear();
   LOG_DBG("WEBACT", "Free heap before AP start: %d bytes", ESP.getFreeHeap());
 
   // Configure and start the AP
@@ -242,6 +248,7 @@ void CrossPointWebServerActivity::startAccessPoint() {
   LOG_DBG("WEBACT", "DNS server started for captive portal");
 
   LOG_DBG("WEBACT", "Free heap after AP start: %d bytes", ESP.getFreeHeap());
+  HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::WifiStart);
 
   // Start the web server
   startWebServer();
@@ -255,6 +262,7 @@ void CrossPointWebServerActivity::startWebServer() {
   webServer->begin();
 
   if (webServer->isRunning()) {
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::WebServerStart);
     state = WebServerActivityState::SERVER_RUNNING;
     LOG_DBG("WEBACT", "Web server started successfully");
     lastWifiBars = isApMode ? 0 : barsForRssi(WiFi.RSSI(), 0);
@@ -1,5 +1,6 @@
 #include "WifiSelectionActivity.h"
 
+#include <FontCacheManager.h>
 #include <GfxRenderer.h>
 #include <I18n.h>
 #include <Logging.h>
@@ -7,6 +8,7 @@
 
 #include <map>
 
+#include "HeapTelemetry.h"
 #include "MappedInputManager.h"
 #include "WifiCredentialStore.h"
 #include "activities/util/KeyboardEntryActivity.h"
@@ -16,6 +18,12 @@
 void WifiSelectionActivity::onEnter() {
   Activity::onEnter();
 
+  // The Wi-Fi stack and TLS need the heap more than the next page turn does
+  if (renderer.getFontCacheManager()) {
+    renderer.getFontCacheManager()->releaseMemory();
+  }
+  renderer.getWordWidthCache().clear();
+
   // Load saved WiFi credentials - SD card operations need lock as we use SPI
   // for both
   {
@@ -247,6 +255,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     snprintf(ipStr, sizeof(ipStr), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
     connectedIP = ipStr;
     autoConnecting = false;
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::WifiStart);
 
     // Save this as the last connected network - SD card operations need lock as
     // we use SPI for both
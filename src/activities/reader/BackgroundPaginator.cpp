@@ -0,0 +1,122 @@
+#include "BackgroundPaginator.h"
+
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include "activities/RenderLock.h"
+
+namespace {
+// Only index after this long without input, so reading and menus never compete with it
+constexpr uint32_t IDLE_BEFORE_INDEXING_MS = 3000;
+// The reader's loop() stops ticking while a sub-activity is on top; don't index behind a menu
+constexpr uint32_t FOREGROUND_TIMEOUT_MS = 500;
+constexpr uint32_t POLL_INTERVAL_MS = 250;
+// Short lock waits so a stop() from a task holding the lock is noticed promptly
+constexpr uint32_t LOCK_TIMEOUT_MS = 50;
+// Leave the foreground enough heap to open and render chapters while a background build runs
+constexpr uint32_t MIN_FREE_HEAP_FOR_INDEXING = 80 * 1024;
+constexpr uint32_t TASK_STACK_SIZE = 8192;
+}  // namespace
+
+void BackgroundPaginator::start(const std::shared_ptr<Epub>& epub, BookPageMap& pageMap) {
+  if (running || pageMap.isComplete() || !pageMap.getLayout()) {
+    return;
+  }
+  this->epub = epub;
+  this->pageMap = &pageMap;
+  stopRequested = false;
+  lastInputMs = millis();
+  running = true;
+  if (xTaskCreate(&taskTrampoline, "BackgroundPaginator", TASK_STACK_SIZE, this, tskIDLE_PRIORITY, &taskHandle) !=
+      pdPASS) {
+    LOG_ERR("BGP", "Failed to create background pagination task");
+    running = false;
+    taskHandle = nullptr;
+  }
+}
+
+void BackgroundPaginator::stop() {
+  if (running) {
+    stopRequested = true;
+    while (running) {
+      vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    stopRequested = false;
+    LOG_DBG("BGP", "Background pagination stopped");
+  }
+  // The task may also have exited on its own; either way drop its references so the book can be freed
+  taskHandle = nullptr;
+  pageMap = nullptr;
+  epub.reset();
+}
+
+void BackgroundPaginator::onReaderLoop(const int spineIndex) {
+  currentSpineIndex = spineIndex;
+  lastForegroundMs = millis();
+}
+
+void BackgroundPaginator::yield() { lastInputMs = millis(); }
+
+bool BackgroundPaginator::shouldRun() const {
+  const uint32_t now = millis();
+  return !stopRequested && now - lastInputMs >= IDLE_BEFORE_INDEXING_MS &&
+         now - lastForegroundMs < FOREGROUND_TIMEOUT_MS;
+}
+
+void BackgroundPaginator::taskTrampoline(void* param) {
+  auto* self = static_cast<BackgroundPaginator*>(param);
+  self->taskLoop();
+  self->running = false;
+  vTaskDelete(nullptr);
+}
+
+void BackgroundPaginator::taskLoop() {
+  LOG_DBG("BGP", "Background pagination started");
+  while (!stopRequested) {
+    vTaskDelay(pdMS_TO_TICKS(POLL_INTERVAL_MS));
+    if (!shouldRun() || ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_INDEXING) {
+      continue;
+    }
+
+    RenderLock lock(LOCK_TIMEOUT_MS);
+    if (!lock.isHeld() || !shouldRun()) {
+      continue;
+    }
+    if (!indexNextSpineItem()) {
+      break;
+    }
+  }
+}
+
+bool BackgroundPaginator::indexNextSpineItem() {
+  const auto* layout = pageMap->getLayout();
+  const int spineIndex = layout ? pageMap->findUnknownSpineIndex(currentSpineIndex) : -1;
+  if (spineIndex < 0) {
+    LOG_INF("BGP", "Page map complete: %u pages", pageMap->getTotalPages());
+    return false;
+  }
+
+  Section section(epub, spineIndex, renderer);
+  if (!section.loadSectionFile(layout->fontId, layout->lineCompression, layout->extraParagraphSpacing,
+                               layout->paragraphAlignment, layout->viewportWidth, layout->viewportHeight,
+                               layout->hyphenationEnabled, layout->embeddedStyle, layout->imageRendering,
+                               layout->focusReadingEnabled)) {
+    const uint32_t start = millis();
+    if (!section.createSectionFile(layout->fontId, layout->lineCompression, layout->extraParagraphSpacing,
+                                   layout->paragraphAlignment, layout->viewportWidth, layout->viewportHeight,
+                                   layout->hyphenationEnabled, layout->embeddedStyle, layout->imageRendering,
+                                   layout->focusReadingEnabled, nullptr, [this]() { return !shouldRun(); })) {
+      if (!shouldRun()) {
+        LOG_DBG("BGP", "Yielded while indexing spine item %d", spineIndex);
+        return true;
+      }
+      // A chapter that can't be built now won't build on retry either; leave it to the reader
+      LOG_ERR("BGP", "Failed to index spine item %d, stopping", spineIndex);
+      return false;
+    }
+    LOG_DBG("BGP", "Indexed spine item %d: %u pages in %lums", spineIndex, section.pageCount, millis() - start);
+  }
+  pageMap->setPageCount(spineIndex, section.pageCount);
+  return true;
+}
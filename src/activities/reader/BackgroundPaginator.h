@@ -0,0 +1,54 @@
+#pragma once
+#include <Epub.h>
+#include <Epub/BookPageMap.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
+
+class GfxRenderer;
+
+/**
+ * BackgroundPaginator
+ *
+ * Low-priority task that builds the section cache of every spine item while the reader sits idle, recording each
+ * chapter's page count in the book's BookPageMap. It works one chapter at a time under the RenderLock (layout uses
+ * the renderer's font metrics) and only while the reader is in the foreground with no recent input. Input abandons
+ * the chapter in progress at the next parse chunk, so a page turn never waits for a whole chapter; the next idle
+ * period resumes it from its last build checkpoint. The task exits once the map is complete.
+ */
+class BackgroundPaginator {
+  GfxRenderer& renderer;
+  std::shared_ptr<Epub> epub;
+  BookPageMap* pageMap = nullptr;
+
+  TaskHandle_t taskHandle = nullptr;
+  std::atomic<bool> running{false};
+  std::atomic<bool> stopRequested{false};
+  std::atomic<uint32_t> lastInputMs{0};
+  std::atomic<uint32_t> lastForegroundMs{0};
+  std::atomic<int> currentSpineIndex{0};
+
+  static void taskTrampoline(void* param);
+  void taskLoop();
+  bool shouldRun() const;
+  // Build (or load) one spine item whose page count is unknown. Returns false when the job should end.
+  bool indexNextSpineItem();
+
+ public:
+  explicit BackgroundPaginator(GfxRenderer& renderer) : renderer(renderer) {}
+  ~BackgroundPaginator() { stop(); }
+  BackgroundPaginator(const BackgroundPaginator&) = delete;
+  BackgroundPaginator& operator=(const BackgroundPaginator&) = delete;
+
+  // Start the task if the map is bound to a layout and still incomplete. No-op while it is running.
+  void start(const std::shared_ptr<Epub>& epub, BookPageMap& pageMap);
+  // Abandon any chapter in progress and wait for the task to exit. Safe to call while holding the RenderLock.
+  void stop();
+
+  // Called from the reader's loop(): keeps the job eligible to run and tells it where the reader is
+  void onReaderLoop(int spineIndex);
+  // Input or a page turn: abandon the chapter in progress and hold off until the reader is idle again
+  void yield();
+};
@@ -1,15 +1,17 @@
 #include "EpubReaderActivity.h"
 
-#include <Epub/Page.h>
-#include <Epub/blocks/TextBlock.h>
+#include <DisplayList.h>
+#include <Epub/PageView.h>
 #include <FontCacheManager.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <I18n.h>
 #include <Logging.h>
+#include <Trace.h>
 #include <esp_system.h>
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 
@@ -19,6 +21,7 @@
 #include "EpubReaderFootnotesActivity.h"
 #include "EpubReaderPercentSelectionActivity.h"
 #include "EpubReaderUtils.h"
+#include "HeapTelemetry.h"
 #include "KOReaderCredentialStore.h"
 #include "KOReaderSyncActivity.h"
 #include "MappedInputManager.h"
@@ -35,6 +38,14 @@ namespace {
 // pages per minute, first item is 1 to prevent division by zero if accessed
 constexpr int PAGE_TURN_RATES[] = {1, 1, 3, 6, 12};
 
+// Prefetched pages are a convenience: only hold them while the heap has room to spare, and never one that is
+// unusually large (e.g. a page of hundreds of short words).
+constexpr uint32_t MIN_FREE_HEAP_FOR_PREFETCH = 64 * 1024;
+constexpr uint32_t MAX_PREFETCH_PAGE_HEAP = 16 * 1024;
+
+// Time loop() spends laying out the rest of a chapter that was opened before it was fully built
+constexpr uint32_t SECTION_BUILD_SLICE_MS = 40;
+
 int clampPercent(int percent) {
   if (percent < 0) {
     return 0;
@@ -59,6 +70,7 @@ void EpubReaderActivity::onEnter() {
   ReaderUtils::applyOrientation(renderer, SETTINGS.orientation);
 
   epub->setupCacheDir();
+  pageMap.reset(new BookPageMap(epub->getCachePath(), epub->getSpineItemsCount()));
 
   FsFile f;
   if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
@@ -102,13 +114,16 @@ void EpubReaderActivity::onEnter() {
 
 void EpubReaderActivity::onExit() {
   Activity::onExit();
+  paginator.stop();
 
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  dropPrefetchedPages();
   section.reset();
+  pageMap.reset();
   epub.reset();
 }
 
@@ -119,6 +134,15 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  // Background pagination only runs while the reader is idle; automatic page turns count as reading, and the
+  // open chapter's own build goes first
+  paginator.onReaderLoop(currentSpineIndex);
+  if (automaticPageTurnActive || mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased() ||
+      (section && section->isBuilding())) {
+    paginator.yield();
+  }
+  continueSectionBuild();
+
   if (automaticPageTurnActive) {
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm) ||
         mappedInput.wasReleased(MappedInputManager::Button::Back)) {
@@ -148,11 +172,12 @@ void EpubReaderActivity::loop() {
   // Enter reader menu activity.
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     const int currentPage = section ? section->currentPage + 1 : 0;
-    const int totalPages = section ? section->pageCount : 0;
+    // 0 while the chapter is still being laid out; the menu then leaves the page count out
+    const int totalPages = knownSectionPageCount();
     float bookProgress = 0.0f;
-    if (epub->getBookSize() > 0 && section && section->pageCount > 0) {
-      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-      bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+    if (epub->getBookSize() > 0 && totalPages > 0) {
+      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(totalPages);
+      bookProgress = calculateBookProgress(chapterProgress) * 100.0f;
     }
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
     startActivityForResult(std::make_unique<EpubReaderMenuActivity>(
@@ -252,6 +277,21 @@ void EpubReaderActivity::jumpToPercent(int percent) {
     return;
   }
 
+  // With every chapter paginated the percentage maps to an exact page
+  if (pageMap && pageMap->isComplete() && pageMap->getTotalPages() > 0) {
+    const uint32_t totalPages = pageMap->getTotalPages();
+    const uint32_t targetPage =
+        std::min(totalPages * static_cast<uint32_t>(clampPercent(percent)) / 100, totalPages - 1);
+    int targetSpineIndex, targetPageInSpine;
+    if (pageMap->locatePage(targetPage, targetSpineIndex, targetPageInSpine)) {
+      RenderLock lock(*this);
+      currentSpineIndex = targetSpineIndex;
+      nextPageNumber = targetPageInSpine;
+      section.reset();
+      return;
+    }
+  }
+
   const size_t bookSize = epub->getBookSize();
   if (bookSize == 0) {
     return;
@@ -313,8 +353,10 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     case EpubReaderMenuActivity::MenuAction::SELECT_CHAPTER: {
       const int spineIdx = currentSpineIndex;
       const std::string path = epub->getPath();
+      const BookPageMap* completePageMap = pageMap && pageMap->isComplete() ? pageMap.get() : nullptr;
       startActivityForResult(
-          std::make_unique<EpubReaderChapterSelectionActivity>(renderer, mappedInput, epub, path, spineIdx),
+          std::make_unique<EpubReaderChapterSelectionActivity>(renderer, mappedInput, epub, path, spineIdx,
+                                                               completePageMap),
           [this](const ActivityResult& result) {
             if (!result.isCancelled && currentSpineIndex != std::get<ChapterResult>(result.data).spineIndex) {
               RenderLock lock(*this);
@@ -338,9 +380,10 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::GO_TO_PERCENT: {
       float bookProgress = 0.0f;
-      if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
-        const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-        bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+      const int totalPages = knownSectionPageCount();
+      if (epub && epub->getBookSize() > 0 && totalPages > 0) {
+        const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(totalPages);
+        bookProgress = calculateBookProgress(chapterProgress) * 100.0f;
       }
       const int initialPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
       startActivityForResult(
@@ -356,19 +399,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
       if (section && section->currentPage >= 0 && section->currentPage < section->pageCount) {
         auto p = section->loadPageFromSectionFile();
         if (p) {
-          std::string fullText;
-          for (const auto& el : p->elements) {
-            if (el->getTag() == TAG_PageLine) {
-              const auto& line = static_cast<const PageLine&>(*el);
-              if (line.getBlock()) {
-                const auto& words = line.getBlock()->getWords();
-                for (const auto& w : words) {
-                  if (!fullText.empty()) fullText += " ";
-                  fullText += w;
-                }
-              }
-            }
-          }
+          const std::string fullText = p->getText();
           if (!fullText.empty()) {
             startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, fullText),
                                    [this](const ActivityResult& result) {});
@@ -387,11 +418,13 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     case EpubReaderMenuActivity::MenuAction::DELETE_CACHE: {
       {
         RenderLock lock(*this);
+        paginator.stop();
         if (epub && section) {
           uint16_t backupSpine = currentSpineIndex;
           uint16_t backupPage = section->currentPage;
-          uint16_t backupPageCount = section->pageCount;
+          uint16_t backupPageCount = knownSectionPageCount();
           section.reset();
+          pageMap.reset();
           epub->clearCache();
           epub->setupCacheDir();
           if (!saveProgress(backupSpine, backupPage, backupPageCount)) {
@@ -412,8 +445,16 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::SYNC: {
       if (KOREADER_STORE.hasCredentials()) {
+        // The sync position is relative to the whole chapter
+        {
+          RenderLock lock(*this);
+          if (section && section->isBuilding() && !section->continueSectionBuild()) {
+            nextPageNumber = section->currentPage;
+            section.reset();
+          }
+        }
         const int currentPage = section ? section->currentPage : nextPageNumber;
-        const int totalPages = section ? section->pageCount : cachedChapterTotalPageCount;
+        const int totalPages = section ? knownSectionPageCount() : cachedChapterTotalPageCount;
         std::optional<uint16_t> paragraphIndex;
         if (section && currentPage >= 0 && currentPage < section->pageCount) {
           const uint16_t paragraphPage =
@@ -447,10 +488,12 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         LOG_DBG("KOSync", "Releasing epub for sync (heap before: %u)", (unsigned)ESP.getFreeHeap());
         {
           RenderLock lock(*this);
+          paginator.stop();
           if (section) {
             nextPageNumber = section->currentPage;
           }
           section.reset();
+          pageMap.reset();
           epub.reset();
         }
         LOG_DBG("KOSync", "Epub released (heap after: %u)", (unsigned)ESP.getFreeHeap());
@@ -475,7 +518,7 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
     RenderLock lock(*this);
     if (section) {
       cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
+      cachedChapterTotalPageCount = knownSectionPageCount();
       nextPageNumber = section->currentPage;
     }
 
@@ -509,7 +552,7 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
     RenderLock lock(*this);
     if (section) {
       cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
+      cachedChapterTotalPageCount = knownSectionPageCount();
       nextPageNumber = section->currentPage;
     }
     section.reset();
@@ -517,6 +560,18 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
 }
 
 void EpubReaderActivity::pageTurn(bool isForwardTurn) {
+  paginator.yield();
+  if (isForwardTurn && section->isBuilding() && section->currentPage + 2 > section->pageCount) {
+    // Turning onto a page the build hasn't reached yet: lay out up to it (and the one after) now
+    RenderLock lock(*this);
+    const int targetPageCount = section->currentPage + 2;
+    if (!section->continueSectionBuild([this, targetPageCount]() { return section->pageCount >= targetPageCount; })) {
+      nextPageNumber = section->currentPage;
+      section.reset();
+      requestUpdate();
+      return;
+    }
+  }
   if (isForwardTurn) {
     if (section->currentPage < section->pageCount - 1) {
       section->currentPage++;
@@ -605,6 +660,8 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     LOG_DBG("ERS", "Loading file: %s, index: %d", filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
+    // New section means a new chapter or new layout settings/orientation; earlier pages no longer apply
+    dropPrefetchedPages();
 
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
@@ -616,18 +673,30 @@ void EpubReaderActivity::render(RenderLock&& lock) {
 
       const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
 
-      if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+      // Lay out only as far as the page about to be shown and the one after it; loop() builds the rest of the
+      // chapter afterwards. Anchors, last-page and percent jumps and reflow repositioning need the whole chapter.
+      const bool needsWholeChapter = !pendingAnchor.empty() || pendingPageJump.has_value() || pendingPercentJump ||
+                                     (cachedChapterTotalPageCount > 0 && currentSpineIndex == cachedSpineIndex);
+      const int targetPageCount = std::max(nextPageNumber, 0) + 2;
+      const auto targetPagesBuilt = [this, needsWholeChapter, targetPageCount]() {
+        return !needsWholeChapter && section->pageCount >= targetPageCount;
+      };
+
+      if (!section->beginSectionBuild(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                       viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
-                                      SETTINGS.imageRendering, SETTINGS.focusReadingEnabled, popupFn)) {
+                                      SETTINGS.imageRendering, SETTINGS.focusReadingEnabled, popupFn) ||
+          !section->continueSectionBuild(targetPagesBuilt)) {
         LOG_ERR("ERS", "Failed to persist page data to SD");
         section.reset();
         showPendingSyncSaveError();
         return;
       }
+      HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::SectionBuild);
     } else {
       LOG_DBG("ERS", "Cache found, skipping build...");
     }
+    updatePageMap(viewportWidth, viewportHeight);
 
     if (pendingPageJump.has_value()) {
       if (*pendingPageJump >= section->pageCount && section->pageCount > 0) {
@@ -701,7 +770,10 @@ void EpubReaderActivity::render(RenderLock&& lock) {
   }
 
   {
-    auto p = section->loadPageFromSectionFile();
+    auto p = takePrefetchedPage(section->currentPage);
+    if (!p) {
+      p = section->loadPageFromSectionFile();
+    }
     if (!p) {
       LOG_ERR("ERS", "Failed to load page from SD - clearing section cache");
       section->clearCache();
@@ -713,15 +785,17 @@ void EpubReaderActivity::render(RenderLock&& lock) {
       return;
     }
 
-    // Collect footnotes from the loaded page
-    currentPageFootnotes = std::move(p->footnotes);
+    // Collect footnotes from the loaded page (copied, the page may be kept for a later redraw)
+    currentPageFootnotes.assign(p->getFootnotes(), p->getFootnotes() + p->getFootnoteCount());
 
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    renderContents(*p, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::PageRender);
+    retainAndPrefetchPages(std::move(p));
   }
   silentIndexNextChapterIfNeeded(viewportWidth, viewportHeight);
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  saveProgress(currentSpineIndex, section->currentPage, knownSectionPageCount());
 
   showPendingSyncSaveError();
 
@@ -732,7 +806,7 @@ void EpubReaderActivity::render(RenderLock&& lock) {
 }
 
 void EpubReaderActivity::silentIndexNextChapterIfNeeded(const uint16_t viewportWidth, const uint16_t viewportHeight) {
-  if (!epub || !section || section->pageCount < 2) {
+  if (!epub || !section || section->isBuilding() || section->pageCount < 2) {
     return;
   }
 
@@ -760,28 +834,170 @@ void EpubReaderActivity::silentIndexNextChapterIfNeeded(const uint16_t viewportW
                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle,
                                      SETTINGS.imageRendering, SETTINGS.focusReadingEnabled)) {
     LOG_ERR("ERS", "Failed silent indexing for chapter: %d", nextSpineIndex);
+    return;
+  }
+  if (pageMap) {
+    pageMap->setPageCount(nextSpineIndex, nextSection.pageCount);
+  }
+}
+
+void EpubReaderActivity::updatePageMap(const uint16_t viewportWidth, const uint16_t viewportHeight) {
+  if (!pageMap) {
+    return;
+  }
+  BookPageMap::Layout layout;
+  layout.fontId = SETTINGS.getReaderFontId();
+  layout.lineCompression = SETTINGS.getReaderLineCompression();
+  layout.extraParagraphSpacing = SETTINGS.extraParagraphSpacing;
+  layout.paragraphAlignment = SETTINGS.paragraphAlignment;
+  layout.viewportWidth = viewportWidth;
+  layout.viewportHeight = viewportHeight;
+  layout.hyphenationEnabled = SETTINGS.hyphenationEnabled;
+  layout.embeddedStyle = SETTINGS.embeddedStyle;
+  layout.imageRendering = SETTINGS.imageRendering;
+  layout.focusReadingEnabled = SETTINGS.focusReadingEnabled;
+
+  // A layout change invalidates the counts, so a paginator still working on the old layout has to go first
+  if (pageMap->getLayout() && *pageMap->getLayout() != layout) {
+    paginator.stop();
+  }
+  pageMap->setLayout(layout);
+  if (!section->isBuilding()) {
+    pageMap->setPageCount(currentSpineIndex, section->pageCount);
+  }
+  paginator.start(epub, *pageMap);
+}
+
+void EpubReaderActivity::continueSectionBuild() {
+  if (!section || !section->isBuilding()) {
+    return;
+  }
+  // Short slices keep button handling responsive while the rest of the chapter is laid out
+  RenderLock lock(*this);
+  if (!section || !section->isBuilding()) {
+    return;
+  }
+  const uint32_t sliceStart = millis();
+  if (!section->continueSectionBuild([sliceStart]() { return millis() - sliceStart >= SECTION_BUILD_SLICE_MS; })) {
+    LOG_ERR("ERS", "Failed to finish building section %d", currentSpineIndex);
+    nextPageNumber = section->currentPage;
+    section.reset();
+    lock.unlock();
+    requestUpdate();
+    return;
+  }
+  if (!section->isBuilding()) {
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::SectionBuild);
+    if (pageMap) {
+      pageMap->setPageCount(currentSpineIndex, section->pageCount);
+    }
+    saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  }
+}
+
+int EpubReaderActivity::knownSectionPageCount() const {
+  return section && !section->isBuilding() ? section->pageCount : 0;
+}
+
+float EpubReaderActivity::calculateBookProgress(const float chapterProgress) const {
+  if (pageMap && pageMap->isComplete() && pageMap->getTotalPages() > 0) {
+    const float chapterPages = pageMap->getPageCount(currentSpineIndex).value_or(0);
+    return (static_cast<float>(pageMap->getSpineStartPage(currentSpineIndex)) + chapterProgress * chapterPages) /
+           static_cast<float>(pageMap->getTotalPages());
+  }
+  return epub->calculateProgress(currentSpineIndex, chapterProgress);
+}
+
+std::unique_ptr<PageView> EpubReaderActivity::takePrefetchedPage(const int pageNumber) {
+  for (auto& slot : prefetchedPages) {
+    if (slot.page && slot.pageNumber == pageNumber) {
+      slot.pageNumber = -1;
+      return std::move(slot.page);
+    }
+  }
+  return nullptr;
+}
+
+void EpubReaderActivity::retainAndPrefetchPages(std::unique_ptr<PageView> shownPage) {
+  const int current = section->currentPage;
+
+  // Keep only the neighbours of the page now on screen, then the page itself
+  for (auto& slot : prefetchedPages) {
+    if (slot.pageNumber != current - 1 && slot.pageNumber != current + 1) {
+      slot = {};
+    }
+  }
+  const auto store = [this](const int pageNumber, std::unique_ptr<PageView> page) {
+    for (auto& slot : prefetchedPages) {
+      if (!slot.page) {
+        slot.pageNumber = pageNumber;
+        slot.page = std::move(page);
+        return;
+      }
+    }
+  };
+  if (ESP.getFreeHeap() >= MIN_FREE_HEAP_FOR_PREFETCH) {
+    store(current, std::move(shownPage));
+  }
+
+  // Read the next page now, after the refresh, so the next turn starts rasterizing straight away.
+  // The display driver blocks this task for the whole waveform, so this is the earliest point it can run.
+  const int next = current + 1;
+  const bool haveNext =
+      std::any_of(std::begin(prefetchedPages), std::end(prefetchedPages),
+                  [next](const PrefetchedPage& slot) { return slot.page && slot.pageNumber == next; });
+  if (!haveNext && next < section->pageCount && ESP.getFreeHeap() >= MIN_FREE_HEAP_FOR_PREFETCH) {
+    // A loaded page is a single blob, so its size is the heap it holds
+    auto page = section->loadPage(next);
+    if (page && page->size() <= MAX_PREFETCH_PAGE_HEAP) {
+      store(next, std::move(page));
+    } else {
+      LOG_DBG("ERS", "Not prefetching page %d (%u bytes)", next, page ? static_cast<uint32_t>(page->size()) : 0);
+    }
+  }
+
+  // The previous page is the first to go when heap gets tight
+  if (ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_PREFETCH) {
+    for (auto& slot : prefetchedPages) {
+      if (slot.pageNumber == current - 1) {
+        slot = {};
+      }
+    }
+  }
+}
+
+void EpubReaderActivity::dropPrefetchedPages() {
+  for (auto& slot : prefetchedPages) {
+    slot = {};
   }
 }
 
 bool EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
   return EpubReaderUtils::saveProgress(*epub, spineIndex, currentPage, pageCount);
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
+void EpubReaderActivity::renderContents(const PageView& page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
+  TRACE_SPAN("page_render");
   const auto t0 = millis();
 
-  // Font prewarm: scan pass accumulates text, then prewarm, then real render
+  // Font prewarm: the scan pass records the page's display list and its glyphs are prewarmed, then every pass below
+  // replays the list (pages in an SD card font can't be recorded and are laid out again each pass)
+  DisplayList displayList;
   auto* fcm = renderer.getFontCacheManager();
   auto scope = fcm->createPrewarmScope();
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);  // scan pass
-  scope.endScanAndPrewarm();
+  page.record(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, displayList);  // scan pass
+  scope.endScanAndPrewarm(displayList);
   const auto tPrewarm = millis();
 
   // Force special handling for pages with images when anti-aliasing is on
-  bool imagePageWithAA = page->hasImages() && SETTINGS.textAntiAliasing;
+  bool imagePageWithAA = page.hasImages() && SETTINGS.textAntiAliasing;
 
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  // With anti-aliasing the gray planes are drawn in the same pass as the BW frame when they fit in memory, otherwise
+  // in one more pass each after the BW frame is shown
+  const bool singlePassGray = SETTINGS.textAntiAliasing && renderer.beginSinglePassGrayscale();
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, &displayList);
+  renderer.setRenderMode(GfxRenderer::BW);
   renderStatusBar();
   const auto tBwRender = millis();
 
@@ -792,13 +1008,13 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     // Step 1: Display page with image area blanked (text appears, image area white)
     // Step 2: Re-render with images and display again (images appear clean)
     int16_t imgX, imgY, imgW, imgH;
-    if (page->getImageBoundingBox(imgX, imgY, imgW, imgH)) {
+    if (page.getImageBoundingBox(imgX, imgY, imgW, imgH)) {
       renderer.fillRect(imgX + orientedMarginLeft, imgY + orientedMarginTop, imgW, imgH, false);
       renderer.displayBuffer(HalDisplay::FAST_REFRESH);
 
       // Re-render page content to restore images into the blanked area
       // Status bar is not re-rendered here to avoid reading stale dynamic values (e.g. battery %)
-      page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, &displayList);
       renderer.displayBuffer(HalDisplay::FAST_REFRESH);
     } else {
       renderer.displayBuffer(HalDisplay::HALF_REFRESH);
@@ -809,25 +1025,30 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   }
   const auto tDisplay = millis();
 
-  // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
+  // Save bw buffer to reset buffer state after grayscale data sync. The single pass keeps it aside itself when it
+  // hands the gray planes over.
+  if (!singlePassGray) {
+    renderer.storeBwBuffer();
+  }
   const auto tBwStore = millis();
 
   // grayscale rendering
   // TODO: Only do this if font supports it
   if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-    const auto tGrayLsb = millis();
-
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-    const auto tGrayMsb = millis();
+    if (singlePassGray) {
+      renderer.endSinglePassGrayscale();
+    } else {
+      renderer.clearScreen(0x00);
+      renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, &displayList);
+      renderer.copyGrayscaleLsbBuffers();
+
+      renderer.clearScreen(0x00);
+      renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop, &displayList);
+      renderer.copyGrayscaleMsbBuffers();
+    }
+    const auto tGrayRender = millis();
 
     // display grayscale part
     renderer.displayGrayBuffer();
@@ -840,9 +1061,9 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     const auto tEnd = millis();
     LOG_DBG("ERS",
             "Page render: prewarm=%lums bw_render=%lums display=%lums bw_store=%lums "
-            "gray_lsb=%lums gray_msb=%lums gray_display=%lums bw_restore=%lums total=%lums",
-            tPrewarm - t0, tBwRender - tPrewarm, tDisplay - tBwRender, tBwStore - tDisplay, tGrayLsb - tBwStore,
-            tGrayMsb - tGrayLsb, tGrayDisplay - tGrayMsb, tBwRestore - tGrayDisplay, tEnd - t0);
+            "gray_render=%lums gray_display=%lums bw_restore=%lums total=%lums",
+            tPrewarm - t0, tBwRender - tPrewarm, tDisplay - tBwRender, tBwStore - tDisplay, tGrayRender - tBwStore,
+            tGrayDisplay - tGrayRender, tBwRestore - tGrayDisplay, tEnd - t0);
   } else {
     // restore the bw data
     renderer.restoreBwBuffer();
@@ -859,9 +1080,10 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
 void EpubReaderActivity::renderStatusBar() const {
   // Calculate progress in book
   const int currentPage = section->currentPage + 1;
-  const float pageCount = section->pageCount;
+  // 0 while the chapter is still being laid out, which the status bar shows as the current page alone
+  const int pageCount = knownSectionPageCount();
   const float sectionChapterProg = (pageCount > 0) ? (static_cast<float>(currentPage) / pageCount) : 0;
-  const float bookProgress = epub->calculateProgress(currentSpineIndex, sectionChapterProg) * 100;
+  const float bookProgress = calculateBookProgress(sectionChapterProg) * 100;
 
   std::string title;
 
@@ -961,10 +1183,10 @@ ScreenshotInfo EpubReaderActivity::getScreenshotInfo() const {
   }
   if (section) {
     info.currentPage = section->currentPage + 1;
-    info.totalPages = section->pageCount;
-    if (epub && epub->getBookSize() > 0 && section->pageCount > 0) {
-      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-      int pct = static_cast<int>(epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f + 0.5f);
+    info.totalPages = knownSectionPageCount();
+    if (epub && epub->getBookSize() > 0 && info.totalPages > 0) {
+      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(info.totalPages);
+      int pct = static_cast<int>(calculateBookProgress(chapterProgress) * 100.0f + 0.5f);
       if (pct < 0) pct = 0;
       if (pct > 100) pct = 100;
       info.progressPercent = pct;
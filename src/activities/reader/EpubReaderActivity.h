@@ -1,16 +1,21 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/BookPageMap.h>
 #include <Epub/FootnoteEntry.h>
 #include <Epub/Section.h>
 
 #include <optional>
 
+#include "BackgroundPaginator.h"
 #include "EpubReaderMenuActivity.h"
 #include "activities/Activity.h"
 
 class EpubReaderActivity final : public Activity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  // Per-chapter page counts under the current layout, filled in by the reader and the background paginator
+  std::unique_ptr<BookPageMap> pageMap;
+  BackgroundPaginator paginator;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   std::optional<uint16_t> pendingPageJump;
@@ -42,11 +47,31 @@ class EpubReaderActivity final : public Activity {
   SavedPosition savedPositions[MAX_FOOTNOTE_DEPTH] = {};
   int footnoteDepth = 0;
 
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
-                      int orientedMarginBottom, int orientedMarginLeft);
+  // Page prefetch: the page on screen and its neighbours stay loaded so a turn either way (or a redraw after
+  // a menu) rasterizes without touching the SD card. The slots belong to `section` and are dropped with it.
+  struct PrefetchedPage {
+    int pageNumber = -1;
+    std::unique_ptr<PageView> page;
+  };
+  static constexpr int PREFETCH_SLOTS = 3;  // previous, current and next page
+  PrefetchedPage prefetchedPages[PREFETCH_SLOTS];
+  std::unique_ptr<PageView> takePrefetchedPage(int pageNumber);
+  void retainAndPrefetchPages(std::unique_ptr<PageView> shownPage);
+  void dropPrefetchedPages();
+
+  void renderContents(const PageView& page, int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                      int orientedMarginLeft);
   void renderStatusBar() const;
   void silentIndexNextChapterIfNeeded(uint16_t viewportWidth, uint16_t viewportHeight);
+  // Lay out another slice of a section that was opened before it was fully built
+  void continueSectionBuild();
+  // Page count of the open section, or 0 while it is still being built and the count isn't final
+  int knownSectionPageCount() const;
   bool saveProgress(int spineIndex, int currentPage, int pageCount);
+  // Book progress (0-1): exact from the page map once every chapter is paginated, otherwise estimated from sizes
+  float calculateBookProgress(float chapterProgress) const;
+  // Record the open section's page count and keep paginating the rest of the book in the background
+  void updatePageMap(uint16_t viewportWidth, uint16_t viewportHeight);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
   void onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction action);
@@ -60,11 +85,13 @@ class EpubReaderActivity final : public Activity {
 
  public:
   explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Epub> epub)
-      : Activity("EpubReader", renderer, mappedInput), epub(std::move(epub)) {}
+      : Activity("EpubReader", renderer, mappedInput), epub(std::move(epub)), paginator(renderer) {}
   void onEnter() override;
   void onExit() override;
   void loop() override;
   void render(RenderLock&& lock) override;
   bool isReaderActivity() const override { return true; }
+  // Finish laying out a partially built chapter at full speed
+  bool skipLoopDelay() override { return section && section->isBuilding(); }
   ScreenshotInfo getScreenshotInfo() const override;
 };
@@ -122,12 +122,24 @@ void EpubReaderChapterSelectionActivity::render(RenderLock&&) {
 
     auto item = epub->getTocItem(itemIndex);
 
+    // Right-aligned book page the chapter starts on, once the whole book is paginated
+    std::string pageLabel;
+    int pageLabelWidth = 0;
+    if (pageMap && item.spineIndex >= 0) {
+      pageLabel = std::to_string(pageMap->getSpineStartPage(item.spineIndex) + 1);
+      pageLabelWidth = renderer.getTextWidth(UI_10_FONT_ID, pageLabel.c_str());
+    }
+
     // Indent per TOC level while keeping content within the gutter-safe region.
     const int indentSize = contentX + 20 + (item.level - 1) * 15;
     const std::string chapterName =
-        renderer.truncatedText(UI_10_FONT_ID, item.title.c_str(), contentWidth - 40 - indentSize);
+        renderer.truncatedText(UI_10_FONT_ID, item.title.c_str(), contentWidth - 40 - indentSize - pageLabelWidth);
 
     renderer.drawText(UI_10_FONT_ID, indentSize, displayY, chapterName.c_str(), !isSelected);
+    if (!pageLabel.empty()) {
+      renderer.drawText(UI_10_FONT_ID, contentX + contentWidth - 20 - pageLabelWidth, displayY, pageLabel.c_str(),
+                        !isSelected);
+    }
   }
 
   const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_SELECT), tr(STR_DIR_UP), tr(STR_DIR_DOWN));
@@ -1,5 +1,6 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/BookPageMap.h>
 
 #include <memory>
 
@@ -9,6 +10,8 @@
 class EpubReaderChapterSelectionActivity final : public Activity {
   std::shared_ptr<Epub> epub;
   std::string epubPath;
+  // Complete page map of the book, or null; when set each chapter shows the page it starts on
+  const BookPageMap* pageMap;
   ButtonNavigator buttonNavigator;
   int currentSpineIndex = 0;
   int selectorIndex = 0;
@@ -23,10 +26,11 @@ class EpubReaderChapterSelectionActivity final : public Activity {
  public:
   explicit EpubReaderChapterSelectionActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
                                               const std::shared_ptr<Epub>& epub, const std::string& epubPath,
-                                              const int currentSpineIndex)
+                                              const int currentSpineIndex, const BookPageMap* pageMap = nullptr)
       : Activity("EpubReaderChapterSelection", renderer, mappedInput),
         epub(epub),
         epubPath(epubPath),
+        pageMap(pageMap),
         currentSpineIndex(currentSpineIndex) {}
   void onEnter() override;
   void onExit() override;
@@ -3,9 +3,11 @@
 #include <FsHelpers.h>
 #include <HalStorage.h>
 
+#include "BookCacheManager.h"
 #include "CrossPointSettings.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
+#include "HeapTelemetry.h"
 #include "Txt.h"
 #include "TxtReaderActivity.h"
 #include "Xtc.h"
@@ -30,6 +32,7 @@ std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
 
   auto epub = std::unique_ptr<Epub>(new Epub(path, "/.crosspoint"));
   if (epub->load(true, SETTINGS.embeddedStyle == 0)) {
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::BookOpen);
     return epub;
   }
 
@@ -45,6 +48,7 @@ std::unique_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
 
   auto xtc = std::unique_ptr<Xtc>(new Xtc(path, "/.crosspoint"));
   if (xtc->load()) {
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::BookOpen);
     return xtc;
   }
 
@@ -60,6 +64,7 @@ std::unique_ptr<Txt> ReaderActivity::loadTxt(const std::string& path) {
 
   auto txt = std::unique_ptr<Txt>(new Txt(path, "/.crosspoint"));
   if (txt->load()) {
+    HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::BookOpen);
     return txt;
   }
 
@@ -76,6 +81,7 @@ void ReaderActivity::goToLibrary(const std::string& fromBookPath) {
 void ReaderActivity::onGoToEpubReader(std::unique_ptr<Epub> epub) {
   const auto epubPath = epub->getPath();
   currentBookPath = epubPath;
+  BOOK_CACHE.touch(epub->getCachePath());
   activityManager.replaceActivity(std::make_unique<EpubReaderActivity>(renderer, mappedInput, std::move(epub)));
 }
 
@@ -86,12 +92,14 @@ void ReaderActivity::onGoToBmpViewer(const std::string& path) {
 void ReaderActivity::onGoToXtcReader(std::unique_ptr<Xtc> xtc) {
   const auto xtcPath = xtc->getPath();
   currentBookPath = xtcPath;
+  BOOK_CACHE.touch(xtc->getCachePath());
   activityManager.replaceActivity(std::make_unique<XtcReaderActivity>(renderer, mappedInput, std::move(xtc)));
 }
 
 void ReaderActivity::onGoToTxtReader(std::unique_ptr<Txt> txt) {
   const auto txtPath = txt->getPath();
   currentBookPath = txtPath;
+  BOOK_CACHE.touch(txt->getCachePath());
   activityManager.replaceActivity(std::make_unique<TxtReaderActivity>(renderer, mappedInput, std::move(txt)));
 }
 
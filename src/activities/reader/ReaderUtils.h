@@ -91,4 +91,12 @@ void renderAntiAliased(GfxRenderer& renderer, RenderFn&& renderFn) {
   renderer.restoreBwBuffer();
 }
 
+// Anti-aliasing for content drawn in one pass with its gray planes (see GfxRenderer::beginSinglePassGrayscale()).
+// Call once the BW frame is displayed: shows the gray planes and restores the BW frame.
+inline void displaySinglePassGrayscale(GfxRenderer& renderer) {
+  renderer.endSinglePassGrayscale();
+  renderer.displayGrayBuffer();
+  renderer.restoreBwBuffer();
+}
+
 }  // namespace ReaderUtils
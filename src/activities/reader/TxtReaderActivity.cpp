@@ -381,13 +381,17 @@ void TxtReaderActivity::renderPage() {
   renderLines();  // scan pass — text accumulated, no drawing
   scope.endScanAndPrewarm();
 
-  // BW rendering
+  // BW rendering, with the gray planes drawn in the same pass when they fit in memory
+  const bool singlePassGray = SETTINGS.textAntiAliasing && renderer.beginSinglePassGrayscale();
   renderLines();
+  renderer.setRenderMode(GfxRenderer::BW);
   renderStatusBar();
 
   ReaderUtils::displayWithRefreshCycle(renderer, pagesUntilFullRefresh);
 
-  if (SETTINGS.textAntiAliasing) {
+  if (singlePassGray) {
+    ReaderUtils::displaySinglePassGrayscale(renderer);
+  } else if (SETTINGS.textAntiAliasing) {
     ReaderUtils::renderAntiAliased(renderer, [&renderLines]() { renderLines(); });
   }
   // scope destructor clears font cache via FontCacheManager
@@ -240,12 +240,10 @@ void XtcReaderActivity::renderPage() {
     return;
   }
 
-  // Clear screen first
-  renderer.clearScreen();
-
-  // Copy page bitmap using GfxRenderer's drawPixel
-  // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
+  // XTC/XTCH pages are pre-rendered with status bar included, so render full page. A page rendered for this screen
+  // is combined into the framebuffer a byte at a time with drawScreenBitmap(); anything else is drawn per pixel.
+  using Layout = GfxRenderer::ScreenBitmapLayout;
+  using Op = GfxRenderer::ScreenBitmapOp;
 
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
@@ -271,67 +269,52 @@ void XtcReaderActivity::renderPage() {
       return (bit1 << 1) | bit2;
     };
 
+    // Draw one frame of the page: combine the two planes with opFirst and opSecond, or, if the page doesn't fit the
+    // screen, clear to clearColor and draw the pixels matching drawPixelValue in pixelState
+    auto drawFrame = [&](const uint8_t* first, const Op opFirst, const uint8_t* second, const Op opSecond,
+                         const uint8_t clearColor, const bool pixelState, auto drawPixelValue) {
+      if (renderer.drawScreenBitmap(first, pageWidth, pageHeight, Layout::ColumnsRightToLeft, opFirst)) {
+        renderer.drawScreenBitmap(second, pageWidth, pageHeight, Layout::ColumnsRightToLeft, opSecond);
+        return;
+      }
+      renderer.clearScreen(clearColor);
+      for (uint16_t y = 0; y < pageHeight; y++) {
+        for (uint16_t x = 0; x < pageWidth; x++) {
+          if (drawPixelValue(getPixelValue(x, y))) {
+            renderer.drawPixel(x, y, pixelState);
+          }
+        }
+      }
+    };
+
+    // BW frame: all non-white pixels black, so white is ~bit1 & ~bit2
+    auto drawBw = [&] {
+      drawFrame(plane1, Op::CopyInverted, plane2, Op::AndNot, 0xFF, true, [](const uint8_t pv) { return pv >= 1; });
+    };
+
     // Optimized grayscale rendering without storeBwBuffer (saves 48KB peak memory)
     // Flow: BW display → LSB/MSB passes → grayscale display → re-render BW for next frame
 
-    // Count pixel distribution for debugging
-    uint32_t pixelCounts[4] = {0, 0, 0, 0};
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        pixelCounts[getPixelValue(x, y)]++;
-      }
-    }
-    LOG_DBG("XTR", "Pixel distribution: White=%lu, DarkGrey=%lu, LightGrey=%lu, Black=%lu", pixelCounts[0],
-            pixelCounts[1], pixelCounts[2], pixelCounts[3]);
-
     // Pass 1: BW buffer - draw all non-white pixels as black
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    drawBw();
 
     ReaderUtils::displayWithRefreshCycle(renderer, pagesUntilFullRefresh);
 
-    // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
+    // Pass 2: LSB buffer - mark DARK gray only (XTH value 1): bit2 & ~bit1
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
-    renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) == 1) {  // Dark grey only
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    drawFrame(plane2, Op::Copy, plane1, Op::AndNot, 0x00, false, [](const uint8_t pv) { return pv == 1; });
     renderer.copyGrayscaleLsbBuffers();
 
-    // Pass 3: MSB buffer - mark LIGHT AND DARK gray (XTH value 1 or 2)
+    // Pass 3: MSB buffer - mark LIGHT AND DARK gray (XTH value 1 or 2): bit1 ^ bit2
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
-    renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        const uint8_t pv = getPixelValue(x, y);
-        if (pv == 1 || pv == 2) {  // Dark grey or Light grey
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    drawFrame(plane1, Op::Copy, plane2, Op::Xor, 0x00, false, [](const uint8_t pv) { return pv == 1 || pv == 2; });
     renderer.copyGrayscaleMsbBuffers();
 
     // Display grayscale overlay
     renderer.displayGrayBuffer();
 
     // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
-    renderer.clearScreen();
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    drawBw();
 
     // Cleanup grayscale buffers with current frame buffer
     renderer.cleanupGrayscaleWithFrameBuffer();
@@ -340,11 +323,12 @@ void XtcReaderActivity::renderPage() {
 
     LOG_DBG("XTR", "Rendered page %lu/%lu (2-bit grayscale)", currentPage + 1, xtc->getPageCount());
     return;
-  } else {
+  } else if (!renderer.drawScreenBitmap(pageBuffer, pageWidth, pageHeight)) {
     // 1-bit mode: 8 pixels per byte, MSB first
     const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
 
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
+    renderer.clearScreen();
+    for (uint16_t srcY = 0; srcY < pageHeight; srcY++) {
       const size_t srcRowStart = srcY * srcRowBytes;
 
       for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
@@ -358,8 +342,8 @@ void XtcReaderActivity::renderPage() {
         }
       }
     }
+    // White pixels are already cleared by clearScreen()
   }
-  // White pixels are already cleared by clearScreen()
 
   free(pageBuffer);
 
@@ -0,0 +1,97 @@
+#include "MemoryDiagnosticsActivity.h"
+
+#include <Arduino.h>
+#include <GfxRenderer.h>
+#include <I18n.h>
+
+#include <cstdio>
+#include <iterator>
+
+#include "HeapTelemetry.h"
+#include "MappedInputManager.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+
+namespace {
+// Columns of the checkpoint table, as fractions of the content width
+constexpr int COLUMN_PERMILLE[] = {0, 380, 470, 620, 780, 900};
+constexpr const char* COLUMN_HEADERS[] = {"", "n", "free", "min free", "min blk", "frag"};
+
+unsigned kb(const uint32_t bytes) { return static_cast<unsigned>(bytes / 1024); }
+}  // namespace
+
+void MemoryDiagnosticsActivity::onEnter() {
+  Activity::onEnter();
+  requestUpdate();
+}
+
+void MemoryDiagnosticsActivity::render(RenderLock&&) {
+  const auto& metrics = UITheme::getInstance().getMetrics();
+  const auto pageWidth = renderer.getScreenWidth();
+  const int left = metrics.contentSidePadding;
+  const int contentWidth = pageWidth - 2 * metrics.contentSidePadding;
+  const int lineHeight = renderer.getLineHeight(SMALL_FONT_ID) + 6;
+  const auto columnX = [left, contentWidth](const int column) {
+    return left + contentWidth * COLUMN_PERMILLE[column] / 1000;
+  };
+
+  renderer.clearScreen();
+  GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, tr(STR_MEMORY_DIAGNOSTICS));
+
+  int y = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+  char line[96];
+  const auto now = HeapTelemetry::sample();
+  snprintf(line, sizeof(line), "Free %u KB of %u KB, largest block %u KB", kb(now.freeBytes),
+           kb(ESP.getHeapSize()), kb(now.largestFreeBlock));
+  renderer.drawText(UI_10_FONT_ID, left, y, line);
+  y += renderer.getLineHeight(UI_10_FONT_ID) + 4;
+  snprintf(line, sizeof(line), "%u blocks, %u%% fragmented, low water %u KB",
+           static_cast<unsigned>(now.allocatedBlocks), now.fragmentationPercent(), kb(ESP.getMinFreeHeap()));
+  renderer.drawText(UI_10_FONT_ID, left, y, line);
+  y += renderer.getLineHeight(UI_10_FONT_ID) + metrics.verticalSpacing;
+
+  for (int column = 1; column < static_cast<int>(std::size(COLUMN_HEADERS)); column++) {
+    renderer.drawText(SMALL_FONT_ID, columnX(column), y, COLUMN_HEADERS[column], true, EpdFontFamily::BOLD);
+  }
+  y += lineHeight;
+  renderer.drawLine(left, y - 3, left + contentWidth, y - 3);
+
+  // Sizes in KB: last free, lowest free and lowest largest block seen there, and the worst fragmentation
+  for (uint8_t i = 0; i < static_cast<uint8_t>(HeapTelemetry::Checkpoint::COUNT); i++) {
+    const auto checkpoint = static_cast<HeapTelemetry::Checkpoint>(i);
+    const auto& stats = HEAP_TELEMETRY.get(checkpoint);
+    renderer.drawText(SMALL_FONT_ID, columnX(0), y, HeapTelemetry::name(checkpoint));
+    snprintf(line, sizeof(line), "%u", static_cast<unsigned>(stats.count));
+    renderer.drawText(SMALL_FONT_ID, columnX(1), y, line);
+    if (stats.count > 0) {
+      snprintf(line, sizeof(line), "%u", kb(stats.last.freeBytes));
+      renderer.drawText(SMALL_FONT_ID, columnX(2), y, line);
+      snprintf(line, sizeof(line), "%u", kb(stats.min.freeBytes));
+      renderer.drawText(SMALL_FONT_ID, columnX(3), y, line);
+      snprintf(line, sizeof(line), "%u", kb(stats.min.largestFreeBlock));
+      renderer.drawText(SMALL_FONT_ID, columnX(4), y, line);
+      snprintf(line, sizeof(line), "%u%%", stats.maxFragmentationPercent);
+      renderer.drawText(SMALL_FONT_ID, columnX(5), y, line);
+    }
+    y += lineHeight;
+  }
+
+  const auto labels = mappedInput.mapLabels(tr(STR_BACK), tr(STR_REFRESH), tr(STR_CLEAR_BUTTON), "");
+  GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
+  renderer.displayBuffer();
+}
+
+void MemoryDiagnosticsActivity::loop() {
+  if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
+    finish();
+    return;
+  }
+  if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
+    requestUpdate();
+    return;
+  }
+  if (mappedInput.wasPressed(MappedInputManager::Button::Left)) {
+    HEAP_TELEMETRY.reset();
+    requestUpdate();
+  }
+}
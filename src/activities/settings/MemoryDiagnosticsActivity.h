@@ -0,0 +1,14 @@
+#pragma once
+
+#include "activities/Activity.h"
+
+// Debug screen for HeapTelemetry: the heap right now and what each checkpoint has seen since boot
+class MemoryDiagnosticsActivity final : public Activity {
+ public:
+  explicit MemoryDiagnosticsActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
+      : Activity("MemoryDiagnostics", renderer, mappedInput) {}
+
+  void onEnter() override;
+  void loop() override;
+  void render(RenderLock&&) override;
+};
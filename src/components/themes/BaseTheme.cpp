@@ -716,12 +716,20 @@ void BaseTheme::drawStatusBar(GfxRenderer& renderer, const float bookProgress, c
     // Right aligned text for progress counter
     char progressStr[32];
 
+    // A pageCount of 0 means the chapter's page count isn't known yet; show the current page alone
+    char pageStr[16];
+    if (pageCount > 0) {
+      snprintf(pageStr, sizeof(pageStr), "%d/%d", currentPage, pageCount);
+    } else {
+      snprintf(pageStr, sizeof(pageStr), "%d", currentPage);
+    }
+
     if (SETTINGS.statusBarBookProgressPercentage && SETTINGS.statusBarChapterPageCount) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%", currentPage, pageCount, bookProgress);
+      snprintf(progressStr, sizeof(progressStr), "%s  %.0f%%", pageStr, bookProgress);
     } else if (SETTINGS.statusBarBookProgressPercentage) {
       snprintf(progressStr, sizeof(progressStr), "%.0f%%", bookProgress);
     } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d", currentPage, pageCount);
+      snprintf(progressStr, sizeof(progressStr), "%s", pageStr);
     }
 
     progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
@@ -16,8 +16,10 @@
 
 #include <cstring>
 
+#include "BookCacheManager.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "HeapTelemetry.h"
 #include "KOReaderCredentialStore.h"
 #include "MappedInputManager.h"
 #include "OpdsServerStore.h"
@@ -127,6 +129,11 @@ EpdFont ui12RegularFont(&ubuntu_12_regular);
 EpdFont ui12BoldFont(&ubuntu_12_bold);
 EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
 
+// Book cache maintenance pacing: one step per interval once the device has been idle this long
+constexpr unsigned long CACHE_MAINTENANCE_INTERVAL_MS = 1000;
+constexpr unsigned long CACHE_MAINTENANCE_IDLE_MS = 30 * 1000;
+constexpr unsigned long CACHE_MAINTENANCE_CHARGING_IDLE_MS = 5 * 1000;
+
 // measurement of power button press duration calibration value
 unsigned long t1 = 0;
 unsigned long t2 = 0;
@@ -343,6 +350,8 @@ void setup() {
     activityManager.goToReader(path);
   }
 
+  HEAP_TELEMETRY.record(HeapTelemetry::Checkpoint::Boot);
+
   // Ensure we're not still holding the power button before leaving setup
   waitForPowerRelease();
 }
@@ -456,6 +465,19 @@ void loop() {
     }
   }
 
+  // Book cache maintenance touches the SD card, so it only runs while the device sits idle (or idles on the charger)
+  // and never while an activity needs a responsive loop. Sitting idle is normal while reading, so it stays off with a
+  // book open unless USB power is connected. Each step reads or deletes a bounded number of directory entries.
+  static unsigned long lastCacheStepTime = 0;
+  const unsigned long idleTime = millis() - lastActivityTime;
+  const bool usbPowered = gpio.isUsbConnected();
+  if (!activityManager.skipLoopDelay() && (usbPowered || !activityManager.isReaderActivity()) &&
+      millis() - lastCacheStepTime >= CACHE_MAINTENANCE_INTERVAL_MS &&
+      (idleTime >= CACHE_MAINTENANCE_IDLE_MS || (usbPowered && idleTime >= CACHE_MAINTENANCE_CHARGING_IDLE_MS))) {
+    lastCacheStepTime = millis();
+    BOOK_CACHE.maintenanceStep(SETTINGS.getBookCacheLimitBytes());
+  }
+
   // Add delay at the end of the loop to prevent tight spinning
   // When an activity requests skip loop delay (e.g., webserver running), use yield() for faster response
   // Otherwise, use longer delay to save power
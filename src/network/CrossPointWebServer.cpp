@@ -5,6 +5,7 @@
 #include <FsHelpers.h>
 #include <HalStorage.h>
 #include <Logging.h>
+#include <Trace.h>
 #include <WiFi.h>
 #include <esp_task_wdt.h>
 
@@ -12,6 +13,7 @@
 
 #include "CrossPointSettings.h"
 #include "FontInstaller.h"
+#include "HeapTelemetry.h"
 #include "OpdsServerStore.h"
 #include "SdCardFontGlobals.h"
 #include "SdCardFontSystem.h"
@@ -145,6 +147,9 @@ void CrossPointWebServer::begin() {
   server->on("/js/jszip.min.js", HTTP_GET, [this] { handleJszip(); });
 
   server->on("/api/status", HTTP_GET, [this] { handleStatus(); });
+  server->on("/api/diagnostics", HTTP_GET, [this] { handleDiagnostics(); });
+  server->on("/api/trace", HTTP_GET, [this] { handleTrace(); });
+  server->on("/api/trace/clear", HTTP_POST, [this] { handleTraceClear(); });
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
   server->on("/download", HTTP_GET, [this] { handleDownload(); });
 
@@ -381,6 +386,75 @@ void CrossPointWebServer::handleStatus() const {
   server->send(200, "application/json", json);
 }
 
+void CrossPointWebServer::handleDiagnostics() const {
+  const auto writeSample = [](JsonObject obj, const HeapTelemetry::Sample& sample) {
+    obj["free"] = sample.freeBytes;
+    obj["largestBlock"] = sample.largestFreeBlock;
+    obj["allocatedBlocks"] = sample.allocatedBlocks;
+  };
+
+  JsonDocument doc;
+  doc["uptime"] = millis() / 1000;
+  JsonObject heap = doc["heap"].to<JsonObject>();
+  heap["size"] = ESP.getHeapSize();
+  heap["minFreeEver"] = ESP.getMinFreeHeap();
+  const auto now = HeapTelemetry::sample();
+  writeSample(heap["now"].to<JsonObject>(), now);
+  heap["now"]["fragmentation"] = now.fragmentationPercent();
+
+  JsonObject checkpoints = doc["checkpoints"].to<JsonObject>();
+  for (uint8_t i = 0; i < static_cast<uint8_t>(HeapTelemetry::Checkpoint::COUNT); i++) {
+    const auto checkpoint = static_cast<HeapTelemetry::Checkpoint>(i);
+    const auto& stats = HEAP_TELEMETRY.get(checkpoint);
+    JsonObject entry = checkpoints[HeapTelemetry::name(checkpoint)].to<JsonObject>();
+    entry["count"] = stats.count;
+    if (stats.count == 0) {
+      continue;
+    }
+    entry["lastUptimeMs"] = stats.lastMillis;
+    entry["maxFragmentation"] = stats.maxFragmentationPercent;
+    writeSample(entry["last"].to<JsonObject>(), stats.last);
+    entry["last"]["fragmentation"] = stats.last.fragmentationPercent();
+    writeSample(entry["min"].to<JsonObject>(), stats.min);
+    writeSample(entry["max"].to<JsonObject>(), stats.max);
+  }
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handleTrace() const {
+  if (Trace::eventCount() == 0) {
+    server->send(404, "text/plain", "No trace events (tracing is disabled in this build or nothing was recorded)");
+    return;
+  }
+  server->sendHeader("Content-Disposition", "attachment; filename=\"crosspoint-trace.json\"");
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "application/json", "");
+  // Events arrive a line at a time; batch them so each chunk is a reasonable TCP write
+  char chunk[1024];
+  size_t used = 0;
+  Trace::exportChromeJson([this, &chunk, &used](const char* data, const size_t len) {
+    if (used + len > sizeof(chunk)) {
+      server->sendContent(chunk, used);
+      used = 0;
+    }
+    memcpy(chunk + used, data, len);
+    used += len;
+  });
+  if (used > 0) {
+    server->sendContent(chunk, used);
+  }
+  // End of streamed response, empty chunk to signal client
+  server->sendContent("");
+}
+
+void CrossPointWebServer::handleTraceClear() const {
+  Trace::clear();
+  server->send(200, "text/plain", "Trace cleared");
+}
+
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
   FsFile root = Storage.open(path);
   if (!root) {
@@ -93,6 +93,9 @@ class CrossPointWebServer {
   void handleJszip() const;
   void handleNotFound() const;
   void handleStatus() const;
+  void handleDiagnostics() const;
+  void handleTrace() const;
+  void handleTraceClear() const;
   void handleFileList() const;
   void handleFileListData() const;
   void handleDownload() const;
@@ -0,0 +1,342 @@
+// Counts the underlying HalFile calls made while indexing the EPUBs in test/epubs, once writing and reading the
+// section cache field by field straight on FsFile and once through BufferedFileWriter/BufferedFileReader.
+//
+// The chapter text comes out of each EPUB through the real ZipFile/InflateReader code. Pages are laid out with a
+// fixed words-per-line grid (no fonts on host) and serialized in the same field order as Page/PageLine/TextBlock,
+// followed by the page LUT and a patched header, like Section::createSectionFile. Every page is then loaded back
+// the way Section::loadPageFromSectionFile does it and compared against what was written.
+
+#include <BufferedFile.h>
+#include <HalStorage.h>
+#include <Serialization.h>
+#include <ZipFile.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t WORDS_PER_LINE = 8;
+constexpr size_t LINES_PER_PAGE = 24;
+constexpr uint8_t TAG_PAGE_LINE = 1;
+
+using Line = std::vector<std::string>;
+using PageRecord = std::vector<Line>;
+
+struct PhaseStats {
+  HalFileCallStats write;
+  HalFileCallStats read;
+};
+
+std::string readZipText(ZipFile& zip, const std::string& path) {
+  size_t size = 0;
+  uint8_t* data = zip.readFileToMemory(path.c_str(), &size, true);
+  if (!data) {
+    return {};
+  }
+  std::string text(reinterpret_cast<char*>(data), size);
+  free(data);
+  return text;
+}
+
+std::string attributeValue(const std::string& tag, const char* name) {
+  const std::string key = std::string(name) + "=\"";
+  const size_t start = tag.find(key);
+  if (start == std::string::npos) {
+    return {};
+  }
+  const size_t end = tag.find('"', start + key.size());
+  return end == std::string::npos ? std::string() : tag.substr(start + key.size(), end - start - key.size());
+}
+
+// Manifest hrefs of every XHTML item, resolved against the OPF directory
+std::vector<std::string> listChapters(ZipFile& zip) {
+  const std::string container = readZipText(zip, "META-INF/container.xml");
+  const std::string opfPath = attributeValue(container, "full-path");
+  if (opfPath.empty()) {
+    return {};
+  }
+  const size_t slash = opfPath.find_last_of('/');
+  const std::string base = slash == std::string::npos ? "" : opfPath.substr(0, slash + 1);
+
+  const std::string opf = readZipText(zip, opfPath);
+  std::vector<std::string> chapters;
+  for (size_t pos = opf.find("<item"); pos != std::string::npos; pos = opf.find("<item", pos + 1)) {
+    const size_t end = opf.find('>', pos);
+    const std::string tag = opf.substr(pos, end - pos);
+    if (attributeValue(tag, "media-type") == "application/xhtml+xml") {
+      chapters.push_back(base + attributeValue(tag, "href"));
+    }
+  }
+  return chapters;
+}
+
+std::vector<PageRecord> layoutPages(const std::string& xhtml) {
+  std::vector<std::string> words;
+  std::string word;
+  bool inTag = false;
+  for (const char c : xhtml) {
+    if (c == '<' || c == '>' || c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+      if (!word.empty()) {
+        words.push_back(std::move(word));
+        word.clear();
+      }
+      inTag = c == '<' || (inTag && c != '>');
+    } else if (!inTag) {
+      word.push_back(c);
+    }
+  }
+
+  std::vector<PageRecord> pages;
+  for (size_t i = 0; i < words.size(); i += WORDS_PER_LINE) {
+    if (pages.empty() || pages.back().size() == LINES_PER_PAGE) {
+      pages.emplace_back();
+    }
+    const size_t end = std::min(words.size(), i + WORDS_PER_LINE);
+    pages.back().emplace_back(words.begin() + i, words.begin() + end);
+  }
+  return pages;
+}
+
+// Out is FsFile or BufferedFileWriter; both go through the serialization:: overloads
+template <typename Out>
+void writePage(Out& out, const PageRecord& page) {
+  serialization::writePod(out, static_cast<uint16_t>(page.size()));
+  int16_t y = 0;
+  for (const auto& line : page) {
+    serialization::writePod(out, TAG_PAGE_LINE);
+    serialization::writePod(out, static_cast<int16_t>(0));
+    serialization::writePod(out, y);
+    y += 20;
+
+    serialization::writePod(out, static_cast<uint16_t>(line.size()));
+    for (const auto& w : line) serialization::writeString(out, w);
+    int16_t x = 0;
+    for (const auto& w : line) {
+      serialization::writePod(out, x);
+      x += static_cast<int16_t>(w.size() * 10);
+    }
+    for (size_t i = 0; i < line.size(); i++) serialization::writePod(out, static_cast<uint8_t>(0));
+    serialization::writePod(out, static_cast<uint8_t>(0));  // no focus split
+
+    // BlockStyle: alignment + textAlignDefined, 8 margin/padding fields, textIndent + textIndentDefined
+    serialization::writePod(out, static_cast<uint8_t>(0));
+    serialization::writePod(out, false);
+    for (int i = 0; i < 8; i++) serialization::writePod(out, static_cast<int16_t>(0));
+    serialization::writePod(out, static_cast<int16_t>(0));
+    serialization::writePod(out, false);
+  }
+  serialization::writePod(out, static_cast<uint16_t>(0));  // footnotes
+}
+
+template <typename In>
+bool readPage(In& in, PageRecord& page) {
+  uint16_t count;
+  serialization::readPod(in, count);
+  page.assign(count, {});
+  for (auto& line : page) {
+    uint8_t tag;
+    int16_t xPos, yPos;
+    serialization::readPod(in, tag);
+    serialization::readPod(in, xPos);
+    serialization::readPod(in, yPos);
+    if (tag != TAG_PAGE_LINE) {
+      return false;
+    }
+
+    uint16_t wc;
+    serialization::readPod(in, wc);
+    line.resize(wc);
+    for (auto& w : line) serialization::readString(in, w);
+    for (uint16_t i = 0; i < wc; i++) {
+      int16_t x;
+      serialization::readPod(in, x);
+    }
+    for (uint16_t i = 0; i < wc; i++) {
+      uint8_t style;
+      serialization::readPod(in, style);
+    }
+    uint8_t hasFocus;
+    serialization::readPod(in, hasFocus);
+
+    uint8_t alignment;
+    bool defined;
+    int16_t field;
+    serialization::readPod(in, alignment);
+    serialization::readPod(in, defined);
+    for (int i = 0; i < 9; i++) serialization::readPod(in, field);
+    serialization::readPod(in, defined);
+  }
+  uint16_t fnCount;
+  serialization::readPod(in, fnCount);
+  return fnCount == 0;
+}
+
+template <typename Out>
+void writeSection(Out& out, const std::vector<PageRecord>& pages) {
+  serialization::writePod(out, static_cast<uint16_t>(0));  // page count placeholder
+  serialization::writePod(out, static_cast<uint32_t>(0));  // LUT offset placeholder
+  std::vector<uint32_t> lut;
+  for (const auto& page : pages) {
+    lut.push_back(static_cast<uint32_t>(out.position()));
+    writePage(out, page);
+  }
+  const auto lutOffset = static_cast<uint32_t>(out.position());
+  for (const auto offset : lut) serialization::writePod(out, offset);
+  out.seek(0);
+  serialization::writePod(out, static_cast<uint16_t>(pages.size()));
+  serialization::writePod(out, lutOffset);
+}
+
+template <typename In>
+bool loadPage(In& in, const uint16_t index, PageRecord& page) {
+  in.seek(sizeof(uint16_t));
+  uint32_t lutOffset;
+  serialization::readPod(in, lutOffset);
+  in.seek(lutOffset + sizeof(uint32_t) * index);
+  uint32_t pagePos;
+  serialization::readPod(in, pagePos);
+  in.seek(pagePos);
+  return readPage(in, page);
+}
+
+bool runSection(const std::string& path, const std::vector<PageRecord>& pages, const bool buffered,
+                PhaseStats& stats) {
+  FsFile file;
+  halFileCallStats = {};
+  if (!Storage.openFileForWrite("BNC", path, file)) {
+    return false;
+  }
+  if (buffered) {
+    BufferedFileWriter out(file);
+    writeSection(out, pages);
+    if (!out.flush()) {
+      return false;
+    }
+  } else {
+    writeSection(file, pages);
+  }
+  file.close();
+  stats.write = halFileCallStats;
+
+  // One open per page turn, as in Section::loadPageFromSectionFile
+  halFileCallStats = {};
+  for (uint16_t i = 0; i < pages.size(); i++) {
+    if (!Storage.openFileForRead("BNC", path, file)) {
+      return false;
+    }
+    PageRecord loaded;
+    bool ok;
+    if (buffered) {
+      BufferedFileReader in(file);
+      ok = loadPage(in, i, loaded);
+    } else {
+      ok = loadPage(file, i, loaded);
+    }
+    file.close();
+    if (!ok || loaded != pages[i]) {
+      fprintf(stderr, "  FAIL: page %u of %s did not round-trip (%s)\n", i, path.c_str(),
+              buffered ? "buffered" : "direct");
+      return false;
+    }
+  }
+  stats.read = halFileCallStats;
+  return true;
+}
+
+void accumulate(HalFileCallStats& total, const HalFileCallStats& s) {
+  total.reads += s.reads;
+  total.writes += s.writes;
+  total.seeks += s.seeks;
+  total.other += s.other;
+  total.bytesRead += s.bytesRead;
+  total.bytesWritten += s.bytesWritten;
+}
+
+void printRow(const char* label, const HalFileCallStats& direct, const HalFileCallStats& buffered) {
+  printf("  %-6s %10u %10u %7.1fx   (reads %u->%u, writes %u->%u, seeks %u->%u)\n", label, direct.total(),
+         buffered.total(), buffered.total() ? static_cast<double>(direct.total()) / buffered.total() : 0.0,
+         direct.reads, buffered.reads, direct.writes, buffered.writes, direct.seeks, buffered.seeks);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::string epubDir = argc > 1 ? argv[1] : "test/epubs";
+  const std::string scratchDir = argc > 2 ? argv[2] : "build/buffered_file_io/scratch";
+  std::filesystem::create_directories(scratchDir);
+
+  std::vector<std::string> epubs;
+  for (const auto& entry : std::filesystem::directory_iterator(epubDir)) {
+    if (entry.path().extension() == ".epub") {
+      epubs.push_back(entry.path().string());
+    }
+  }
+  std::sort(epubs.begin(), epubs.end());
+
+  PhaseStats directTotal, bufferedTotal;
+  size_t totalPages = 0;
+  int failures = 0;
+  for (const auto& epubPath : epubs) {
+    ZipFile zip(epubPath);
+    const auto chapters = listChapters(zip);
+    size_t bookPages = 0;
+    PhaseStats bookDirect, bookBuffered;
+    for (size_t c = 0; c < chapters.size(); c++) {
+      const auto pages = layoutPages(readZipText(zip, chapters[c]));
+      if (pages.empty()) {
+        continue;
+      }
+      const std::string sectionPath = scratchDir + "/" + std::to_string(c) + ".bin";
+      PhaseStats direct, buffered;
+      if (!runSection(sectionPath, pages, false, direct) || !runSection(sectionPath, pages, true, buffered)) {
+        failures++;
+        continue;
+      }
+      if (direct.write.bytesWritten != buffered.write.bytesWritten) {
+        fprintf(stderr, "  FAIL: %s chapter %zu wrote %llu bytes direct vs %llu buffered\n", epubPath.c_str(), c,
+                static_cast<unsigned long long>(direct.write.bytesWritten),
+                static_cast<unsigned long long>(buffered.write.bytesWritten));
+        failures++;
+      }
+      accumulate(bookDirect.write, direct.write);
+      accumulate(bookDirect.read, direct.read);
+      accumulate(bookBuffered.write, buffered.write);
+      accumulate(bookBuffered.read, buffered.read);
+      bookPages += pages.size();
+      Storage.remove(sectionPath.c_str());
+    }
+
+    printf("%s: %zu chapters, %zu pages\n", std::filesystem::path(epubPath).filename().c_str(), chapters.size(),
+           bookPages);
+    printf("  %-6s %10s %10s %8s\n", "", "direct", "buffered", "saving");
+    printRow("index", bookDirect.write, bookBuffered.write);
+    printRow("load", bookDirect.read, bookBuffered.read);
+
+    accumulate(directTotal.write, bookDirect.write);
+    accumulate(directTotal.read, bookDirect.read);
+    accumulate(bufferedTotal.write, bookBuffered.write);
+    accumulate(bufferedTotal.read, bookBuffered.read);
+    totalPages += bookPages;
+  }
+
+  printf("All books: %zu pages\n", totalPages);
+  printRow("index", directTotal.write, bufferedTotal.write);
+  printRow("load", directTotal.read, bufferedTotal.read);
+
+  if (totalPages == 0) {
+    fprintf(stderr, "No pages indexed from %s\n", epubDir.c_str());
+    return 1;
+  }
+  if (bufferedTotal.write.total() >= directTotal.write.total() ||
+      bufferedTotal.read.total() >= directTotal.read.total()) {
+    fprintf(stderr, "Buffered I/O did not reduce the number of file calls\n");
+    failures++;
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -94,6 +94,9 @@ static const EpdFontData kTestFontData = {
   .kernRightClassCount = 2,
   .ligaturePairs     = nullptr,
   .ligaturePairCount = 0,
+  .kernLeftDirect    = nullptr,
+  .kernRightDirect   = nullptr,
+  .ligatureStartBits = nullptr,
 };
 // clang-format on
 
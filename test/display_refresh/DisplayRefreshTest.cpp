@@ -0,0 +1,128 @@
+// Checks how GfxRenderer::displayBuffer() refreshes the panel: fast refreshes of an unchanged frame are skipped, a
+// small change only refreshes the panel window around it, and large changes, half refreshes and the first frame
+// after a grayscale refresh still go out whole.
+
+#include <HalDisplay.h>
+#include <HostReader.h>
+
+#include <cstdio>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_EQ(a, b)                                                                                       \
+  do {                                                                                                        \
+    if ((a) != (b)) {                                                                                         \
+      fprintf(stderr, "  FAIL: %s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #a,                   \
+              static_cast<long long>(a), static_cast<long long>(b));                                          \
+      testsFailed++;                                                                                          \
+      return;                                                                                                 \
+    }                                                                                                         \
+  } while (0)
+
+#define PASS() testsPassed++
+
+namespace {
+HalDisplay::RefreshStats before;
+
+void mark() { before = display.getRefreshStats(); }
+uint32_t fastSince() { return display.getRefreshStats().fast - before.fast; }
+uint32_t halfSince() { return display.getRefreshStats().half - before.half; }
+uint32_t windowSince() { return display.getRefreshStats().window - before.window; }
+
+// Start every test from a known frame on the panel
+void showBlankFrame(GfxRenderer& renderer) {
+  renderer.setOrientation(GfxRenderer::Portrait);
+  renderer.clearScreen();
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+}
+}  // namespace
+
+void testUnchangedFrameIsSkipped(GfxRenderer& renderer) {
+  printf("testUnchangedFrameIsSkipped...\n");
+  showBlankFrame(renderer);
+  mark();
+  renderer.clearScreen();
+  renderer.displayBuffer();
+  ASSERT_EQ(fastSince(), 0);
+  ASSERT_EQ(windowSince(), 0);
+  PASS();
+}
+
+void testSmallChangeRefreshesWindow(GfxRenderer& renderer) {
+  printf("testSmallChangeRefreshesWindow...\n");
+  showBlankFrame(renderer);
+  mark();
+  // A portrait menu row: logical x 20..219, y 100..129 is panel x 100..129, y 260..459
+  renderer.fillRect(20, 100, 200, 30);
+  renderer.displayBuffer();
+  ASSERT_EQ(fastSince(), 0);
+  ASSERT_EQ(windowSince(), 1);
+  // Widened to whole 80x16 tiles
+  const auto& window = display.getLastWindow();
+  ASSERT_EQ(window.x, 80);
+  ASSERT_EQ(window.w, 80);
+  ASSERT_EQ(window.y, 256);
+  ASSERT_EQ(window.h, 208);
+
+  // Only what changed since that refresh goes out next
+  mark();
+  renderer.fillRect(20, 300, 10, 10);
+  renderer.displayBuffer();
+  ASSERT_EQ(windowSince(), 1);
+  ASSERT_EQ(display.getLastWindow().x, 240);
+  ASSERT_EQ(display.getLastWindow().y, 448);
+  ASSERT_EQ(display.getLastWindow().h, 16);
+  PASS();
+}
+
+void testLargeChangeRefreshesWholePanel(GfxRenderer& renderer) {
+  printf("testLargeChangeRefreshesWholePanel...\n");
+  showBlankFrame(renderer);
+  mark();
+  renderer.fillRect(0, 0, renderer.getScreenWidth(), renderer.getScreenHeight() / 2 + 40);
+  renderer.displayBuffer();
+  ASSERT_EQ(fastSince(), 1);
+  ASSERT_EQ(windowSince(), 0);
+  PASS();
+}
+
+void testHalfRefreshStaysWhole(GfxRenderer& renderer) {
+  printf("testHalfRefreshStaysWhole...\n");
+  showBlankFrame(renderer);
+  mark();
+  renderer.fillRect(20, 100, 10, 10);
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  ASSERT_EQ(halfSince(), 1);
+  ASSERT_EQ(windowSince(), 0);
+  // ...and counts as sent
+  renderer.displayBuffer();
+  ASSERT_EQ(fastSince(), 0);
+  PASS();
+}
+
+void testGrayRefreshForgetsSentFrame(GfxRenderer& renderer) {
+  printf("testGrayRefreshForgetsSentFrame...\n");
+  showBlankFrame(renderer);
+  renderer.displayGrayBuffer();
+  mark();
+  renderer.displayBuffer();
+  ASSERT_EQ(fastSince(), 1);
+  ASSERT_EQ(windowSince(), 0);
+  PASS();
+}
+
+int main() {
+  HostReader reader;
+  GfxRenderer& renderer = reader.getRenderer();
+
+  printf("=== Display Refresh Tests ===\n\n");
+  testUnchangedFrameIsSkipped(renderer);
+  testSmallChangeRefreshesWindow(renderer);
+  testLargeChangeRefreshesWholePanel(renderer);
+  testHalfRefreshStaysWhole(renderer);
+  testGrayRefreshForgetsSentFrame(renderer);
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,214 @@
+// Runs every EPUB in test/epubs through the real reader pipeline on host (Epub, ZipFile, Section,
+// ChapterHtmlSlimParser, ParsedText, GfxRenderer with the builtin Noto Serif 14) and reports where the time and
+// heap go, per chapter:
+//   build   Section::createSectionFile: inflate, parse, CSS, line breaking, page serialization
+//   load    loading every page of the chapter back from its section file
+//   render  drawing every page into the in-memory framebuffer, with the same font prewarm pass as the reader
+// Indexing the book (OPF, TOC, book.bin, CSS cache) is reported on its own line. Allocation counts and peak heap
+// cover everything the phase allocated through malloc or new, measured from what was live when it started.
+//
+// Pages are laid out with the reader's defaults in portrait: Noto Serif 14, normal line spacing, justified, extra
+// paragraph spacing, embedded styles, images shown, 5px screen margin and no status bar.
+//
+// Usage: EpubPipelineBenchmark <epub dir> <scratch dir> [--repeat <n>] [--trace <file>]
+// With --repeat every book is indexed and laid out n times from a cold cache and the fastest run is reported.
+// --trace writes the trace spans recorded over the whole run as Chrome trace JSON (open it in ui.perfetto.dev).
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/PageView.h>
+#include <Epub/Section.h>
+#include <HostHeap.h>
+#include <HostReader.h>
+#include <Trace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(const Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Heap used by one phase, from a hostHeapMark() taken when it started
+struct HeapUse {
+  uint64_t allocations = 0;
+  uint64_t peakBytes = 0;
+};
+
+class HeapMeter {
+  uint64_t startAllocations;
+
+ public:
+  HeapMeter() : startAllocations(hostHeapStats.allocations) { hostHeapMark(); }
+  HeapUse read() const { return {hostHeapStats.allocations - startAllocations, hostHeapStats.peakAboveBaseline()}; }
+};
+
+struct ChapterResult {
+  int spineIndex = 0;
+  int pages = 0;
+  bool ok = false;
+  double buildMs = 0;
+  double loadMs = 0;
+  double renderMs = 0;
+  HeapUse heap;
+
+  double totalMs() const { return buildMs + loadMs + renderMs; }
+};
+
+struct BookResult {
+  std::string name;
+  bool ok = false;
+  double indexMs = 0;
+  HeapUse indexHeap;
+  std::vector<ChapterResult> chapters;
+
+  double totalMs() const {
+    double total = indexMs;
+    for (const auto& chapter : chapters) {
+      total += chapter.totalMs();
+    }
+    return total;
+  }
+};
+
+ChapterResult runChapter(const std::shared_ptr<Epub>& epub, const int spineIndex, HostReader& reader) {
+  ChapterResult result;
+  result.spineIndex = spineIndex;
+
+  const HeapMeter heap;
+  Section section(epub, spineIndex, reader.getRenderer());
+  auto start = Clock::now();
+  result.ok = reader.buildSection(section);
+  result.buildMs = elapsedMs(start);
+  result.pages = section.pageCount;
+
+  for (int page = 0; result.ok && page < section.pageCount; page++) {
+    start = Clock::now();
+    const auto view = section.loadPage(page);
+    result.loadMs += elapsedMs(start);
+    if (!view) {
+      fprintf(stderr, "Failed to load page %d of spine item %d\n", page, spineIndex);
+      result.ok = false;
+      break;
+    }
+
+    start = Clock::now();
+    reader.renderPage(*view);
+    result.renderMs += elapsedMs(start);
+  }
+  result.heap = heap.read();
+  return result;
+}
+
+BookResult runBook(const std::filesystem::path& epubPath, const std::string& scratchDir, HostReader& reader) {
+  BookResult result;
+  result.name = epubPath.filename().string();
+  std::filesystem::remove_all(scratchDir);
+  std::filesystem::create_directories(scratchDir);
+
+  const HeapMeter heap;
+  const auto start = Clock::now();
+  auto epub = std::make_shared<Epub>(epubPath.string(), scratchDir);
+  result.ok = epub->load(true);
+  result.indexMs = elapsedMs(start);
+  result.indexHeap = heap.read();
+  if (!result.ok) {
+    fprintf(stderr, "Failed to load %s\n", result.name.c_str());
+    return result;
+  }
+
+  for (int i = 0; i < epub->getSpineItemsCount(); i++) {
+    result.chapters.push_back(runChapter(epub, i, reader));
+    result.ok = result.ok && result.chapters.back().ok;
+  }
+  return result;
+}
+
+void printBook(const BookResult& book) {
+  printf("%s\n", book.name.c_str());
+  printf("  %-7s %6s %10s %10s %10s %10s %9s %9s\n", "spine", "pages", "build ms", "load ms", "render ms", "total ms",
+         "allocs", "peak KB");
+  printf("  %-7s %6s %10.2f %10s %10s %10.2f %9llu %9.1f\n", "index", "-", book.indexMs, "-", "-", book.indexMs,
+         static_cast<unsigned long long>(book.indexHeap.allocations), book.indexHeap.peakBytes / 1024.0);
+  for (const auto& chapter : book.chapters) {
+    printf("  %-7d %6d %10.2f %10.2f %10.2f %10.2f %9llu %9.1f%s\n", chapter.spineIndex, chapter.pages,
+           chapter.buildMs, chapter.loadMs, chapter.renderMs, chapter.totalMs(),
+           static_cast<unsigned long long>(chapter.heap.allocations), chapter.heap.peakBytes / 1024.0,
+           chapter.ok ? "" : "  FAILED");
+  }
+  printf("  total %.2f ms\n\n", book.totalMs());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <epub dir> <scratch dir> [--repeat <n>] [--trace <file>]\n", argv[0]);
+    return 2;
+  }
+  const std::filesystem::path epubDir = argv[1];
+  const std::string scratchDir = argv[2];
+  int repeat = 1;
+  const char* tracePath = nullptr;
+  for (int i = 3; i + 1 < argc; i++) {
+    if (strcmp(argv[i], "--repeat") == 0) {
+      repeat = std::max(1, atoi(argv[i + 1]));
+    } else if (strcmp(argv[i], "--trace") == 0) {
+      tracePath = argv[i + 1];
+    }
+  }
+
+  std::vector<std::filesystem::path> epubs;
+  for (const auto& entry : std::filesystem::directory_iterator(epubDir)) {
+    if (entry.path().extension() == ".epub") {
+      epubs.push_back(entry.path());
+    }
+  }
+  std::sort(epubs.begin(), epubs.end());
+  if (epubs.empty()) {
+    fprintf(stderr, "No EPUBs in %s\n", epubDir.c_str());
+    return 2;
+  }
+
+  HostReader reader;
+
+  bool ok = true;
+  double totalMs = 0;
+  for (const auto& epubPath : epubs) {
+    BookResult best;
+    for (int run = 0; run < repeat; run++) {
+      BookResult result = runBook(epubPath, scratchDir, reader);
+      if (run == 0 || result.totalMs() < best.totalMs()) {
+        best = std::move(result);
+      }
+    }
+    printBook(best);
+    ok = ok && best.ok;
+    totalMs += best.totalMs();
+  }
+  std::filesystem::remove_all(scratchDir);
+
+  printf("%zu books, %.2f ms\n", epubs.size(), totalMs);
+  if (tracePath) {
+    FILE* traceFile = fopen(tracePath, "w");
+    if (!traceFile) {
+      fprintf(stderr, "Failed to open %s\n", tracePath);
+      return 1;
+    }
+    Trace::exportChromeJson([traceFile](const char* data, const size_t len) { fwrite(data, 1, len, traceFile); });
+    fclose(traceFile);
+    printf("%zu trace events written to %s\n", Trace::eventCount(), tracePath);
+  }
+  return ok ? 0 : 1;
+}
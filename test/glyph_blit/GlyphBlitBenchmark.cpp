@@ -0,0 +1,258 @@
+// Microbenchmark for GlyphBlitter, the glyph writer behind GfxRenderer::drawText(). Draws the printable ASCII
+// glyphs of a 1-bit font (Ubuntu 12, the UI font) and a 2-bit font (Noto Serif 14, the default reader font) with the
+// per-pixel drawPixel() loop the renderer used before and with the blitter, and reports glyphs/second for each
+// orientation.
+//
+// Before timing anything it checks that both paths leave identical framebuffers for every orientation, text
+// rotation, render mode and pixel state, with glyphs placed across the screen edges so clipping is covered too.
+//
+// Usage: GlyphBlitBenchmark [--iterations <n>]
+
+#include <Arduino.h>
+#include <EpdFont.h>
+#include <GlyphBlitter.h>
+#include <HalDisplay.h>
+#include <HostReader.h>
+#include <RenderFixtures.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr GfxRenderer::RenderMode MODES[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB,
+                                             GfxRenderer::GRAYSCALE_MSB};
+
+using Clock = std::chrono::steady_clock;
+using TextRotation = GlyphBlitter::TextRotation;
+
+// A glyph bitmap copied out of the font, so compressed glyphs don't depend on the decompressor's hot group
+struct Glyph {
+  std::vector<uint8_t> bitmap;
+  int width;
+  int height;
+};
+
+struct Font {
+  const char* name;
+  bool is2Bit;
+  std::vector<Glyph> glyphs;
+};
+
+struct Placement {
+  const Glyph* glyph;
+  int x;
+  int y;
+};
+
+Font loadFont(const char* name, const GfxRenderer& renderer, const EpdFontData* data) {
+  Font font{name, data->is2Bit, {}};
+  const EpdFont epdFont(data);
+  for (uint32_t cp = 0x21; cp < 0x7F; cp++) {
+    const EpdGlyph* glyph = epdFont.getGlyph(cp);
+    const uint8_t* bitmap = glyph ? renderer.getGlyphBitmap(data, glyph) : nullptr;
+    if (!bitmap || glyph->width == 0 || glyph->height == 0) {
+      continue;
+    }
+    const size_t bits = static_cast<size_t>(glyph->width) * glyph->height * (data->is2Bit ? 2 : 1);
+    font.glyphs.push_back({std::vector<uint8_t>(bitmap, bitmap + (bits + 7) / 8), glyph->width, glyph->height});
+  }
+  return font;
+}
+
+// The loop renderCharImpl() ran before GlyphBlitter: one drawPixel() per glyph pixel. Off-screen pixels are skipped
+// here instead of being logged by drawPixel().
+void drawPerPixel(const GfxRenderer& renderer, const Glyph& glyph, const bool is2Bit, const TextRotation rotation,
+                  const int originX, const int originY, const bool pixelState) {
+  const GfxRenderer::RenderMode renderMode = renderer.getRenderMode();
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  int pixelPosition = 0;
+  for (int glyphY = 0; glyphY < glyph.height; glyphY++) {
+    for (int glyphX = 0; glyphX < glyph.width; glyphX++, pixelPosition++) {
+      int screenX, screenY;
+      if (rotation == TextRotation::Rotated90CW) {
+        screenX = originX + glyphY;
+        screenY = originY - glyphX;
+      } else {
+        screenX = originX + glyphX;
+        screenY = originY + glyphY;
+      }
+      if (screenX < 0 || screenX >= screenWidth || screenY < 0 || screenY >= screenHeight) {
+        continue;
+      }
+
+      if (is2Bit) {
+        const uint8_t byte = glyph.bitmap[pixelPosition >> 2];
+        const uint8_t bmpVal = 3 - ((byte >> ((3 - (pixelPosition & 3)) * 2)) & 0x3);
+        if (renderMode == GfxRenderer::BW && bmpVal < 3) {
+          renderer.drawPixel(screenX, screenY, pixelState);
+        } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          renderer.drawPixel(screenX, screenY, false);
+        } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
+          renderer.drawPixel(screenX, screenY, false);
+        }
+      } else if ((glyph.bitmap[pixelPosition >> 3] >> (7 - (pixelPosition & 7))) & 1) {
+        renderer.drawPixel(screenX, screenY, pixelState);
+      }
+    }
+  }
+}
+
+void drawBlitter(const GlyphBlitter& blitter, const GfxRenderer& renderer, const Glyph& glyph, const bool is2Bit,
+                 const int originX, const int originY, const bool pixelState) {
+  blitter.blit(glyph.bitmap.data(), is2Bit, glyph.width, glyph.height, originX, originY, renderer.getRenderMode(),
+               pixelState);
+}
+
+// Every glyph at a spread of positions reaching past each screen edge
+std::vector<Placement> edgePlacements(const Font& font, const int screenWidth, const int screenHeight) {
+  std::vector<Placement> placements;
+  int i = 0;
+  for (int y = -24; y < screenHeight + 24; y += 29) {
+    for (int x = -24; x < screenWidth + 24; x += 23) {
+      placements.push_back({&font.glyphs[i++ % font.glyphs.size()], x, y});
+    }
+  }
+  return placements;
+}
+
+// Glyphs set like a page of text, all on screen
+std::vector<Placement> pagePlacements(const Font& font, const int screenWidth, const int screenHeight) {
+  std::vector<Placement> placements;
+  int lineHeight = 0;
+  for (const auto& glyph : font.glyphs) {
+    lineHeight = std::max(lineHeight, glyph.height);
+  }
+  size_t i = 0;
+  for (int y = 0; y + lineHeight <= screenHeight; y += lineHeight) {
+    int x = 0;
+    while (true) {
+      const Glyph& glyph = font.glyphs[i % font.glyphs.size()];
+      if (x + glyph.width > screenWidth) break;
+      placements.push_back({&glyph, x, y});
+      x += glyph.width + 1;
+      i++;
+    }
+  }
+  return placements;
+}
+
+bool checkFont(GfxRenderer& renderer, const Font& font) {
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  std::vector<uint8_t> expected(HalDisplay::BUFFER_SIZE);
+  int failures = 0;
+  int cases = 0;
+  uint32_t seed = 1;
+
+  for (const auto& orientation : ORIENTATIONS) {
+    renderer.setOrientation(orientation.orientation);
+    const auto placements = edgePlacements(font, renderer.getScreenWidth(), renderer.getScreenHeight());
+    for (const auto rotation : {TextRotation::None, TextRotation::Rotated90CW}) {
+      GlyphBlitter blitter;
+      blitter.init(renderer, rotation);
+      for (const auto mode : MODES) {
+        renderer.setRenderMode(mode);
+        for (const bool pixelState : {true, false}) {
+          fillNoise(frameBuffer, seed);
+          for (const auto& p : placements) {
+            drawPerPixel(renderer, *p.glyph, font.is2Bit, rotation, p.x, p.y, pixelState);
+          }
+          std::memcpy(expected.data(), frameBuffer, expected.size());
+
+          fillNoise(frameBuffer, seed++);
+          for (const auto& p : placements) {
+            drawBlitter(blitter, renderer, *p.glyph, font.is2Bit, p.x, p.y, pixelState);
+          }
+          cases++;
+          if (std::memcmp(expected.data(), frameBuffer, expected.size()) != 0) {
+            fprintf(stderr, "FAIL %s %s %s mode %d state %d: blitter output differs from drawPixel\n", font.name,
+                    orientation.name, rotation == TextRotation::None ? "unrotated" : "rotated", mode, pixelState);
+            failures++;
+          }
+        }
+      }
+    }
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+  printf("%s: %d/%d orientation/rotation/mode/state combinations match\n", font.name, cases - failures, cases);
+  return failures == 0;
+}
+
+template <typename Draw>
+double glyphsPerSecond(const std::vector<Placement>& placements, const int iterations, Draw draw) {
+  const auto start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (const auto& p : placements) {
+      draw(p);
+    }
+  }
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return static_cast<double>(placements.size()) * iterations / seconds;
+}
+
+void benchmarkFont(GfxRenderer& renderer, const Font& font, const int iterations) {
+  renderer.setRenderMode(GfxRenderer::BW);
+  for (const auto& orientation : ORIENTATIONS) {
+    renderer.setOrientation(orientation.orientation);
+    const auto placements = pagePlacements(font, renderer.getScreenWidth(), renderer.getScreenHeight());
+    GlyphBlitter blitter;
+    blitter.init(renderer, TextRotation::None);
+
+    renderer.clearScreen();
+    const double before = glyphsPerSecond(placements, iterations, [&](const Placement& p) {
+      drawPerPixel(renderer, *p.glyph, font.is2Bit, TextRotation::None, p.x, p.y, true);
+    });
+    renderer.clearScreen();
+    const double after = glyphsPerSecond(placements, iterations, [&](const Placement& p) {
+      drawBlitter(blitter, renderer, *p.glyph, font.is2Bit, p.x, p.y, true);
+    });
+    printf("%-12s %-18s drawPixel: %6.2f Mglyphs/s  GlyphBlitter: %6.2f Mglyphs/s  (%.1fx)\n", font.name,
+           orientation.name, before / 1e6, after / 1e6, after / before);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = 200;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = std::max(1, atoi(argv[++i]));
+    } else {
+      fprintf(stderr, "Usage: %s [--iterations <n>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  HostReader reader;
+  GfxRenderer& renderer = reader.getRenderer();
+  const Font fonts[] = {
+      loadFont("ubuntu_12", renderer, &ubuntu_12_regular),
+      loadFont("notoserif_14", renderer,
+               renderer.getFontMap().at(reader.getFontId()).getData(EpdFontFamily::REGULAR)),
+  };
+
+  bool ok = true;
+  for (const auto& font : fonts) {
+    if (font.glyphs.empty()) {
+      fprintf(stderr, "FAIL %s: no glyph bitmaps\n", font.name);
+      return 1;
+    }
+    ok = checkFont(renderer, font) && ok;
+  }
+  if (!ok) {
+    return 1;
+  }
+
+  printf("BW, unrotated text, %d iterations of a screen of glyphs\n", iterations);
+  for (const auto& font : fonts) {
+    benchmarkFont(renderer, font, iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,164 @@
+// Checks FontDecompressor's glyph cache over real page turns: glyphs decompressed for one page are copied from the
+// cache for the next instead of inflating their groups again, the cache stays within its byte budget, a cached page
+// draws the same pixels as a cold one, and trimGlyphCache() gives the memory back.
+//
+// Usage: GlyphCacheTest <epub dir> <scratch dir>
+
+#include <Epub.h>
+#include <Epub/PageView.h>
+#include <Epub/Section.h>
+#include <FontDecompressor.h>
+#include <HalDisplay.h>
+#include <HostReader.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_TRUE(cond)                                                 \
+  do {                                                                    \
+    if (!(cond)) {                                                        \
+      fprintf(stderr, "  FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      testsFailed++;                                                      \
+      return;                                                             \
+    }                                                                     \
+  } while (0)
+
+#define PASS() testsPassed++
+
+namespace {
+
+struct Book {
+  std::shared_ptr<Epub> epub;
+  std::vector<std::unique_ptr<PageView>> pages;
+};
+
+// The first chapter with a few pages of text
+bool loadBook(HostReader& reader, const std::string& epubPath, const std::string& scratchDir, Book& book) {
+  std::filesystem::remove_all(scratchDir);
+  std::filesystem::create_directories(scratchDir);
+  book.epub = std::make_shared<Epub>(epubPath, scratchDir);
+  if (!book.epub->load(true)) {
+    return false;
+  }
+  for (int spine = 0; spine < book.epub->getSpineItemsCount(); spine++) {
+    Section section(book.epub, spine, reader.getRenderer());
+    if (!reader.buildSection(section) || section.pageCount < 3) {
+      continue;
+    }
+    for (int page = 0; page < section.pageCount; page++) {
+      book.pages.push_back(section.loadPage(page));
+      if (!book.pages.back()) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+std::vector<uint8_t> frame(GfxRenderer& renderer) {
+  const uint8_t* frameBuffer = renderer.getFrameBuffer();
+  return std::vector<uint8_t>(frameBuffer, frameBuffer + HalDisplay::BUFFER_SIZE);
+}
+
+}  // namespace
+
+void testPageTurnReusesGlyphs(HostReader& reader, FontDecompressor& decompressor, const Book& book) {
+  printf("testPageTurnReusesGlyphs...\n");
+  decompressor.trimGlyphCache();
+  reader.renderPage(*book.pages[0]);
+  const FontDecompressor::Stats cold = decompressor.getStats();
+  ASSERT_TRUE(cold.groupsDecompressed > 0);
+  ASSERT_TRUE(cold.glyphCacheHits == 0);
+
+  // The next page shares most of its glyphs with the first
+  reader.renderPage(*book.pages[1]);
+  const FontDecompressor::Stats next = decompressor.getStats();
+  printf("  page 1: %u groups inflated, page 2: %u groups inflated, %u of %u glyphs cached\n",
+         cold.groupsDecompressed, next.groupsDecompressed, next.glyphCacheHits,
+         next.glyphCacheHits + next.glyphCacheMisses);
+  ASSERT_TRUE(next.glyphCacheHits > next.glyphCacheMisses);
+  ASSERT_TRUE(next.groupsDecompressed < cold.groupsDecompressed);
+
+  // Turning back inflates nothing
+  reader.renderPage(*book.pages[0]);
+  const FontDecompressor::Stats back = decompressor.getStats();
+  ASSERT_TRUE(back.groupsDecompressed == 0);
+  ASSERT_TRUE(back.glyphCacheMisses == 0);
+  PASS();
+}
+
+void testCachedPageMatchesColdPage(HostReader& reader, FontDecompressor& decompressor, const Book& book) {
+  printf("testCachedPageMatchesColdPage...\n");
+  GfxRenderer& renderer = reader.getRenderer();
+  for (const auto mode : {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB}) {
+    renderer.setRenderMode(mode);
+    decompressor.trimGlyphCache();
+    reader.renderPage(*book.pages[2]);
+    const std::vector<uint8_t> cold = frame(renderer);
+    reader.renderPage(*book.pages[1]);
+    reader.renderPage(*book.pages[2]);
+    ASSERT_TRUE(decompressor.getStats().glyphCacheHits > 0);
+    ASSERT_TRUE(frame(renderer) == cold);
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+  PASS();
+}
+
+void testCacheStaysWithinBudget(HostReader& reader, FontDecompressor& decompressor, const Book& book) {
+  printf("testCacheStaysWithinBudget...\n");
+  for (const auto& page : book.pages) {
+    reader.renderPage(*page);
+    ASSERT_TRUE(decompressor.getStats().glyphCacheBytes <= FontDecompressor::GLYPH_CACHE_BUDGET);
+  }
+  ASSERT_TRUE(decompressor.getStats().glyphCacheBytes > 0);
+  PASS();
+}
+
+void testTrimReleasesCache(HostReader& reader, FontDecompressor& decompressor, const Book& book) {
+  printf("testTrimReleasesCache...\n");
+  reader.renderPage(*book.pages[0]);
+  const uint32_t full = decompressor.getStats().glyphCacheBytes;
+  decompressor.trimGlyphCache(full / 2);
+  ASSERT_TRUE(decompressor.getStats().glyphCacheBytes <= full / 2);
+  ASSERT_TRUE(decompressor.getStats().glyphCacheBytes > 0);
+
+  decompressor.trimGlyphCache();
+  ASSERT_TRUE(decompressor.getStats().glyphCacheBytes == 0);
+  reader.renderPage(*book.pages[0]);
+  ASSERT_TRUE(decompressor.getStats().groupsDecompressed > 0);
+  ASSERT_TRUE(decompressor.getStats().glyphCacheHits == 0);
+  PASS();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <epub dir> <scratch dir>\n", argv[0]);
+    return 2;
+  }
+
+  HostReader reader;
+  FontDecompressor& decompressor = *reader.getRenderer().getFontCacheManager()->getDecompressor();
+  Book book;
+  const std::string epubPath = (std::filesystem::path(argv[1]) / "test_kerning_ligature.epub").string();
+  if (!loadBook(reader, epubPath, argv[2], book)) {
+    fprintf(stderr, "FAIL: no chapter of %s with three pages\n", epubPath.c_str());
+    return 1;
+  }
+
+  printf("=== Glyph Cache Tests ===\n\n");
+  testPageTurnReusesGlyphs(reader, decompressor, book);
+  testCachedPageMatchesColdPage(reader, decompressor, book);
+  testCacheStaysWithinBudget(reader, decompressor, book);
+  testTrimReleasesCache(reader, decompressor, book);
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,37 @@
+#include "Arduino.h"
+
+#include <chrono>
+#include <thread>
+
+#include "HostHeap.h"
+
+EspClass ESP;
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+
+uint32_t heapLeft(const int64_t used) {
+  if (used <= 0) {
+    return HOST_DEVICE_HEAP_BYTES;
+  }
+  return used >= HOST_DEVICE_HEAP_BYTES ? 0 : static_cast<uint32_t>(HOST_DEVICE_HEAP_BYTES - used);
+}
+}  // namespace
+
+unsigned long millis() {
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+uint32_t EspClass::getHeapSize() const { return HOST_DEVICE_HEAP_BYTES; }
+
+uint32_t EspClass::getFreeHeap() const { return heapLeft(hostHeapStats.liveBytes - hostHeapStats.baselineBytes); }
+
+uint32_t EspClass::getMinFreeHeap() const { return heapLeft(hostHeapStats.peakBytes - hostHeapStats.baselineBytes); }
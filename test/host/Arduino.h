@@ -0,0 +1,30 @@
+#pragma once
+
+// Host stand-in for the Arduino core: the clock, delay() and the ESP heap queries the libraries use. Free heap is
+// reported as what would be left of a device-sized heap given the bytes the program currently has allocated (see
+// HostHeap.h), so low-heap fallbacks trigger on host under the same conditions as on device.
+
+#include <WString.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void yield() {}
+
+class EspClass {
+ public:
+  uint32_t getHeapSize() const;
+  uint32_t getFreeHeap() const;
+  // No fragmentation on host: the largest block is whatever is free
+  uint32_t getMaxAllocHeap() const { return getFreeHeap(); }
+  uint32_t getMinFreeHeap() const;
+};
+
+extern EspClass ESP;
@@ -0,0 +1,79 @@
+#include "HalDisplay.h"
+
+#include <HalGPIO.h>
+
+#include <cstring>
+
+HalDisplay display;
+HalGPIO gpio;
+
+namespace {
+// Copy a 1-bit image (rows padded to whole bytes, 0 = black) into the framebuffer. Transparent drawing only
+// carries the image's black pixels over.
+void blit(uint8_t* frameBuffer, const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+          const uint16_t h, const bool transparent) {
+  const uint16_t imageWidthBytes = (w + 7) / 8;
+  for (uint16_t row = 0; row < h && y + row < HalDisplay::DISPLAY_HEIGHT; row++) {
+    uint8_t* dst = frameBuffer + (y + row) * HalDisplay::DISPLAY_WIDTH_BYTES;
+    const uint8_t* src = imageData + row * imageWidthBytes;
+    for (uint16_t col = 0; col < w && x + col < HalDisplay::DISPLAY_WIDTH; col++) {
+      const bool white = src[col / 8] & (0x80 >> (col % 8));
+      if (transparent && white) {
+        continue;
+      }
+      const uint16_t px = x + col;
+      if (white) {
+        dst[px / 8] |= 0x80 >> (px % 8);
+      } else {
+        dst[px / 8] &= ~(0x80 >> (px % 8));
+      }
+    }
+  }
+}
+}  // namespace
+
+void HalDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+
+void HalDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                           const uint16_t h, bool) const {
+  blit(frameBuffer, imageData, x, y, w, h, false);
+}
+
+void HalDisplay::drawImageTransparent(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                                      const uint16_t h, bool) const {
+  blit(frameBuffer, imageData, x, y, w, h, true);
+}
+
+void HalDisplay::displayBuffer(const RefreshMode mode, bool) { refreshDisplay(mode); }
+
+void HalDisplay::displayWindow(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h, bool) {
+  refreshStats.window++;
+  lastWindow = {x, y, w, h};
+}
+
+void HalDisplay::refreshDisplay(const RefreshMode mode, bool) {
+  switch (mode) {
+    case FULL_REFRESH:
+      refreshStats.full++;
+      break;
+    case HALF_REFRESH:
+      refreshStats.half++;
+      break;
+    case FAST_REFRESH:
+      refreshStats.fast++;
+      break;
+  }
+}
+
+void HalDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  copyGrayscaleLsbBuffers(lsbBuffer);
+  copyGrayscaleMsbBuffers(msbBuffer);
+}
+
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { memcpy(grayLsbBuffer, lsbBuffer, BUFFER_SIZE); }
+
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { memcpy(grayMsbBuffer, msbBuffer, BUFFER_SIZE); }
+
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { memcpy(frameBuffer, bwBuffer, BUFFER_SIZE); }
+
+void HalDisplay::displayGrayBuffer(bool) { refreshStats.gray++; }
@@ -0,0 +1,73 @@
+#pragma once
+
+// Host stand-in for lib/hal/HalDisplay.h: the X4 panel's framebuffers kept in memory. Refreshes only count, so a
+// host run can read back what a page drew and how often the screen would have been updated.
+
+#include <cstdint>
+
+class HalDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  struct RefreshStats {
+    uint32_t full = 0;
+    uint32_t half = 0;
+    uint32_t fast = 0;
+    uint32_t gray = 0;
+    uint32_t window = 0;
+  };
+  struct Window {
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t w = 0;
+    uint16_t h = 0;
+  };
+
+  void begin() {}
+
+  void clearScreen(uint8_t color = 0xFF) const;
+  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 bool fromProgmem = false) const;
+  void drawImageTransparent(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            bool fromProgmem = false) const;
+
+  void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
+  void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  void deepSleep() {}
+
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+
+  void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  void cleanupGrayscaleBuffers(const uint8_t* bwBuffer);
+  void displayGrayBuffer(bool turnOffScreen = false);
+
+  uint16_t getDisplayWidth() const { return DISPLAY_WIDTH; }
+  uint16_t getDisplayHeight() const { return DISPLAY_HEIGHT; }
+  uint16_t getDisplayWidthBytes() const { return DISPLAY_WIDTH_BYTES; }
+  uint32_t getBufferSize() const { return BUFFER_SIZE; }
+
+  // Host only: the planes last handed over for a grayscale refresh, the refreshes requested so far and the last
+  // window refreshed
+  const uint8_t* getGrayscaleLsbBuffer() const { return grayLsbBuffer; }
+  const uint8_t* getGrayscaleMsbBuffer() const { return grayMsbBuffer; }
+  const RefreshStats& getRefreshStats() const { return refreshStats; }
+  const Window& getLastWindow() const { return lastWindow; }
+
+ private:
+  // Mutable like the device driver's buffer, which the const draw calls write through
+  mutable uint8_t frameBuffer[BUFFER_SIZE] = {};
+  uint8_t grayLsbBuffer[BUFFER_SIZE] = {};
+  uint8_t grayMsbBuffer[BUFFER_SIZE] = {};
+  RefreshStats refreshStats;
+  Window lastWindow;
+};
+
+extern HalDisplay display;
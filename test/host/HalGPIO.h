@@ -0,0 +1,12 @@
+#pragma once
+
+// Host stand-in for lib/hal/HalGPIO.h. There are no buttons, battery or USB on host; the device is always an X4.
+
+class HalGPIO {
+ public:
+  bool deviceIsX3() const { return false; }
+  bool deviceIsX4() const { return true; }
+  bool isUsbConnected() const { return false; }
+};
+
+extern HalGPIO gpio;
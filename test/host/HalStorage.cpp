@@ -0,0 +1,267 @@
+#include "HalStorage.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+HalFileCallStats halFileCallStats;
+HalStorage HalStorage::instance;
+
+HalFile::~HalFile() {
+  if (fp) {
+    fclose(fp);
+  }
+  if (dir) {
+    closedir(dir);
+  }
+}
+
+HalFile::HalFile(HalFile&& other) noexcept
+    : fp(std::exchange(other.fp, nullptr)), dir(std::exchange(other.dir, nullptr)), path(std::move(other.path)) {}
+
+HalFile& HalFile::operator=(HalFile&& other) noexcept {
+  if (this != &other) {
+    if (fp) {
+      fclose(fp);
+    }
+    if (dir) {
+      closedir(dir);
+    }
+    fp = std::exchange(other.fp, nullptr);
+    dir = std::exchange(other.dir, nullptr);
+    path = std::move(other.path);
+  }
+  return *this;
+}
+
+void HalFile::flush() {
+  halFileCallStats.other++;
+  if (fp) {
+    fflush(fp);
+  }
+}
+
+size_t HalFile::getName(char* name, const size_t len) {
+  if (len == 0) {
+    return 0;
+  }
+  const size_t slash = path.find_last_of('/');
+  const std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+  const size_t n = std::min(base.size(), len - 1);
+  memcpy(name, base.data(), n);
+  name[n] = '\0';
+  return n;
+}
+
+// Not counted: on device size() is served from the open file's directory entry without taking the lock
+size_t HalFile::size() {
+  if (!fp) {
+    return 0;
+  }
+  struct stat st{};
+  fflush(fp);
+  return fstat(fileno(fp), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+bool HalFile::seek(const size_t pos) {
+  halFileCallStats.seeks++;
+  return fp && fseek(fp, static_cast<long>(pos), SEEK_SET) == 0;
+}
+
+bool HalFile::seekCur(const int64_t offset) {
+  halFileCallStats.seeks++;
+  return fp && fseek(fp, static_cast<long>(offset), SEEK_CUR) == 0;
+}
+
+int HalFile::available() const {
+  halFileCallStats.other++;
+  if (!fp) {
+    return 0;
+  }
+  const long pos = ftell(fp);
+  struct stat st{};
+  if (fstat(fileno(fp), &st) != 0 || pos < 0 || st.st_size < pos) {
+    return 0;
+  }
+  return static_cast<int>(st.st_size - pos);
+}
+
+size_t HalFile::position() const {
+  halFileCallStats.other++;
+  return fp ? static_cast<size_t>(ftell(fp)) : 0;
+}
+
+int HalFile::read(void* buf, const size_t count) {
+  halFileCallStats.reads++;
+  if (!fp) {
+    return -1;
+  }
+  const size_t n = fread(buf, 1, count, fp);
+  halFileCallStats.bytesRead += n;
+  return static_cast<int>(n);
+}
+
+int HalFile::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+size_t HalFile::write(const void* buf, const size_t count) {
+  halFileCallStats.writes++;
+  if (!fp) {
+    return 0;
+  }
+  const size_t n = fwrite(buf, 1, count, fp);
+  halFileCallStats.bytesWritten += n;
+  return n;
+}
+
+bool HalFile::rename(const char* newPath) {
+  halFileCallStats.other++;
+  if (!fp || ::rename(path.c_str(), newPath) != 0) {
+    return false;
+  }
+  path = newPath;
+  return true;
+}
+
+void HalFile::rewindDirectory() {
+  if (dir) {
+    rewinddir(dir);
+  }
+}
+
+HalFile HalFile::openNextFile() {
+  halFileCallStats.other++;
+  HalFile next;
+  if (!dir) {
+    return next;
+  }
+  for (const dirent* entry = readdir(dir); entry; entry = readdir(dir)) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      next = Storage.open((path + "/" + entry->d_name).c_str());
+      break;
+    }
+  }
+  return next;
+}
+
+bool HalFile::close() {
+  halFileCallStats.other++;
+  if (dir) {
+    closedir(dir);
+    dir = nullptr;
+    return true;
+  }
+  if (!fp) {
+    return false;
+  }
+  const bool ok = fclose(fp) == 0;
+  fp = nullptr;
+  return ok;
+}
+
+HalFile HalStorage::open(const char* path, const oflag_t oflag) {
+  HalFile file;
+  struct stat st{};
+  const bool exists = stat(path, &st) == 0;
+  if (exists && S_ISDIR(st.st_mode)) {
+    file.dir = opendir(path);
+  } else if ((oflag & O_ACCMODE) == O_RDONLY) {
+    file.fp = fopen(path, "rb");
+  } else if (oflag & O_APPEND) {
+    file.fp = fopen(path, (oflag & O_ACCMODE) == O_RDWR ? "a+b" : "ab");
+  } else if ((oflag & O_TRUNC) || (!exists && (oflag & O_CREAT))) {
+    file.fp = fopen(path, (oflag & O_ACCMODE) == O_RDWR ? "w+b" : "wb");
+  } else {
+    // Existing file opened for writing without truncation: stdio only offers that as read/write
+    file.fp = fopen(path, "r+b");
+  }
+  if (file.isOpen()) {
+    file.path = path;
+  }
+  return file;
+}
+
+bool HalStorage::mkdir(const char* path, const bool pFlag) {
+  const std::string full = path;
+  if (pFlag) {
+    for (size_t i = 1; i < full.size(); i++) {
+      if (full[i] == '/') {
+        ::mkdir(full.substr(0, i).c_str(), 0755);
+      }
+    }
+  }
+  return ::mkdir(full.c_str(), 0755) == 0 || exists(path);
+}
+
+bool HalStorage::exists(const char* path) {
+  struct stat st{};
+  return stat(path, &st) == 0;
+}
+
+bool HalStorage::remove(const char* path) { return unlink(path) == 0; }
+
+bool HalStorage::rename(const char* oldPath, const char* newPath) { return ::rename(oldPath, newPath) == 0; }
+
+bool HalStorage::rmdir(const char* path) { return ::rmdir(path) == 0; }
+
+bool HalStorage::removeDir(const char* path) {
+  DIR* dir = opendir(path);
+  if (!dir) {
+    return false;
+  }
+  bool ok = true;
+  for (const dirent* entry = readdir(dir); entry; entry = readdir(dir)) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    const std::string child = std::string(path) + "/" + entry->d_name;
+    struct stat st{};
+    if (stat(child.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+      ok = removeDir(child.c_str()) && ok;
+    } else {
+      ok = unlink(child.c_str()) == 0 && ok;
+    }
+  }
+  closedir(dir);
+  return ::rmdir(path) == 0 && ok;
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const char* path, HalFile& file) {
+  if (file.isOpen()) {
+    file.close();
+  }
+  file.fp = fopen(path, "rb");
+  if (!file.fp) {
+    fprintf(stderr, "[ERR] [%s] Failed to open file for reading: %s\n", moduleName, path);
+    return false;
+  }
+  file.path = path;
+  return true;
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const char* path, HalFile& file) {
+  if (file.isOpen()) {
+    file.close();
+  }
+  // Read/write so section builders can seek back and patch their headers
+  file.fp = fopen(path, "w+b");
+  if (!file.fp) {
+    fprintf(stderr, "[ERR] [%s] Failed to open file for writing: %s\n", moduleName, path);
+    return false;
+  }
+  file.path = path;
+  return true;
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
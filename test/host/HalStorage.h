@@ -0,0 +1,94 @@
+#pragma once
+
+// Host stand-in for lib/hal/HalStorage.h, backed by stdio and POSIX directories. Only the subset used by the
+// host-built libraries is provided. Every HalFile call that would take the storage mutex on device is counted in
+// halFileCallStats so host benchmarks can report how many locked SD calls a code path makes.
+
+#include <Print.h>
+#include <dirent.h>
+#include <fcntl.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+using oflag_t = int;
+
+struct HalFileCallStats {
+  uint32_t reads = 0;
+  uint32_t writes = 0;
+  uint32_t seeks = 0;
+  uint32_t other = 0;  // position/available/flush/close
+  uint64_t bytesRead = 0;
+  uint64_t bytesWritten = 0;
+
+  uint32_t total() const { return reads + writes + seeks + other; }
+};
+
+extern HalFileCallStats halFileCallStats;
+
+class HalFile : public Print {
+  friend class HalStorage;
+  FILE* fp = nullptr;
+  DIR* dir = nullptr;  // set instead of fp when a directory was opened
+  std::string path;
+
+ public:
+  HalFile() = default;
+  ~HalFile();
+  HalFile(HalFile&& other) noexcept;
+  HalFile& operator=(HalFile&& other) noexcept;
+  HalFile(const HalFile&) = delete;
+  HalFile& operator=(const HalFile&) = delete;
+
+  void flush() override;
+  size_t getName(char* name, size_t len);
+  size_t size();
+  size_t fileSize() { return size(); }
+  uint64_t fileSize64() { return size(); }
+  bool seek(size_t pos);
+  bool seek64(uint64_t pos) { return seek(static_cast<size_t>(pos)); }
+  bool seekCur(int64_t offset);
+  bool seekSet(size_t offset) { return seek(offset); }
+  int available() const;
+  size_t position() const;
+  int read(void* buf, size_t count);
+  int read();
+  size_t write(const void* buf, size_t count);
+  size_t write(const uint8_t* buf, size_t count) override { return write(static_cast<const void*>(buf), count); }
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  bool rename(const char* newPath);
+  bool isDirectory() const { return dir != nullptr; }
+  void rewindDirectory();
+  HalFile openNextFile();
+  bool close();
+  bool isOpen() const { return fp != nullptr || dir != nullptr; }
+  operator bool() const { return isOpen(); }
+};
+
+class HalStorage {
+ public:
+  // Opens directories too; of the flags only O_RDONLY, O_WRONLY, O_RDWR, O_CREAT, O_TRUNC and O_APPEND are honoured
+  HalFile open(const char* path, oflag_t oflag = O_RDONLY);
+  bool mkdir(const char* path, bool pFlag = true);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* oldPath, const char* newPath);
+  bool rmdir(const char* path);
+  // Remove a directory and everything in it
+  bool removeDir(const char* path);
+
+  bool openFileForRead(const char* moduleName, const char* path, HalFile& file);
+  bool openFileForRead(const char* moduleName, const std::string& path, HalFile& file);
+  bool openFileForWrite(const char* moduleName, const char* path, HalFile& file);
+  bool openFileForWrite(const char* moduleName, const std::string& path, HalFile& file);
+
+  static HalStorage& getInstance() { return instance; }
+
+ private:
+  static HalStorage instance;
+};
+
+#define Storage HalStorage::getInstance()
+
+using FsFile = HalFile;
@@ -0,0 +1,90 @@
+#include "HostHeap.h"
+
+#include <malloc.h>
+
+#include <cstdlib>
+#include <new>
+
+HostHeapStats hostHeapStats;
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+}
+
+namespace {
+// Sizes come from the allocator itself, so blocks freed here that were allocated before counting started (or inside
+// libc) only ever make the live count low, never corrupt it
+void countAlloc(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  hostHeapStats.allocations++;
+  hostHeapStats.liveBytes += static_cast<int64_t>(malloc_usable_size(ptr));
+  if (hostHeapStats.liveBytes > hostHeapStats.peakBytes) {
+    hostHeapStats.peakBytes = hostHeapStats.liveBytes;
+  }
+}
+
+void countFree(void* ptr) {
+  if (ptr) {
+    hostHeapStats.liveBytes -= static_cast<int64_t>(malloc_usable_size(ptr));
+  }
+}
+}  // namespace
+
+void hostHeapMark() {
+  hostHeapStats.baselineBytes = hostHeapStats.liveBytes;
+  hostHeapStats.peakBytes = hostHeapStats.liveBytes;
+}
+
+extern "C" {
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+void* __wrap_calloc(const size_t count, const size_t size) {
+  void* ptr = __real_calloc(count, size);
+  countAlloc(ptr);
+  return ptr;
+}
+
+void* __wrap_realloc(void* ptr, const size_t size) {
+  countFree(ptr);
+  void* result = __real_realloc(ptr, size);
+  // A failed realloc leaves the old block in place
+  countAlloc(result ? result : (size ? ptr : nullptr));
+  return result;
+}
+
+void __wrap_free(void* ptr) {
+  countFree(ptr);
+  __real_free(ptr);
+}
+}
+
+void* operator new(const size_t size) {
+  void* ptr = __wrap_malloc(size ? size : 1);
+  if (!ptr) {
+    abort();
+  }
+  return ptr;
+}
+
+void* operator new[](const size_t size) { return operator new(size); }
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept { return __wrap_malloc(size ? size : 1); }
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept { return __wrap_malloc(size ? size : 1); }
+
+void operator delete(void* ptr) noexcept { __wrap_free(ptr); }
+
+void operator delete[](void* ptr) noexcept { __wrap_free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { __wrap_free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { __wrap_free(ptr); }
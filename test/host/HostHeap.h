@@ -0,0 +1,24 @@
+#pragma once
+
+// Heap accounting for host builds. HostHeap.cpp replaces the global operator new/delete and, when linked with
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free, the C allocator calls made by the libraries (expat,
+// uzlib, ZipFile), so every allocation the code under test makes is counted.
+
+#include <cstdint>
+
+// Heap the code would have to itself on device once a book is open; ESP.getFreeHeap() counts down from this
+constexpr uint32_t HOST_DEVICE_HEAP_BYTES = 192 * 1024;
+
+struct HostHeapStats {
+  uint64_t allocations = 0;
+  int64_t liveBytes = 0;
+  int64_t peakBytes = 0;      // highest liveBytes since the last hostHeapMark()
+  int64_t baselineBytes = 0;  // liveBytes at the last hostHeapMark()
+
+  uint64_t peakAboveBaseline() const { return peakBytes > baselineBytes ? peakBytes - baselineBytes : 0; }
+};
+
+extern HostHeapStats hostHeapStats;
+
+// Start a measurement: what is allocated now becomes the baseline, and the peak restarts from it
+void hostHeapMark();
@@ -0,0 +1,111 @@
+#include "HostReader.h"
+
+#include <DisplayList.h>
+#include <HalDisplay.h>
+#include <Logging.h>
+#include <builtinFonts/notoserif_14_bold.h>
+#include <builtinFonts/notoserif_14_bolditalic.h>
+#include <builtinFonts/notoserif_14_italic.h>
+#include <builtinFonts/notoserif_14_regular.h>
+#include <fontIds.h>
+
+namespace {
+constexpr int SCREEN_MARGIN = 5;
+constexpr float LINE_COMPRESSION = 1.0f;
+constexpr bool EXTRA_PARAGRAPH_SPACING = true;
+constexpr uint8_t PARAGRAPH_ALIGNMENT = 0;  // justified
+constexpr bool HYPHENATION_ENABLED = false;
+constexpr bool EMBEDDED_STYLE = true;
+constexpr uint8_t IMAGE_RENDERING = 0;  // display images
+constexpr bool FOCUS_READING = false;
+
+EpdFont notoserif14RegularFont(&notoserif_14_regular);
+EpdFont notoserif14BoldFont(&notoserif_14_bold);
+EpdFont notoserif14ItalicFont(&notoserif_14_italic);
+EpdFont notoserif14BoldItalicFont(&notoserif_14_bolditalic);
+EpdFontFamily notoserif14FontFamily(&notoserif14RegularFont, &notoserif14BoldFont, &notoserif14ItalicFont,
+                                    &notoserif14BoldItalicFont);
+}  // namespace
+
+HostReader::HostReader() : renderer(display), fontCacheManager(renderer.getFontMap(), renderer.getSdCardFonts()) {
+  display.begin();
+  renderer.begin();
+  if (!fontDecompressor.init()) {
+    LOG_ERR("HRD", "Font decompressor init failed");
+  }
+  fontCacheManager.setFontDecompressor(&fontDecompressor);
+  renderer.setFontCacheManager(&fontCacheManager);
+  renderer.insertFont(NOTOSERIF_14_FONT_ID, notoserif14FontFamily);
+}
+
+int HostReader::getFontId() const { return NOTOSERIF_14_FONT_ID; }
+
+HostReader::Viewport HostReader::getViewport() const {
+  int top, right, bottom, left;
+  renderer.getOrientedViewableTRBL(&top, &right, &bottom, &left);
+  top += SCREEN_MARGIN;
+  right += SCREEN_MARGIN;
+  bottom += SCREEN_MARGIN;
+  left += SCREEN_MARGIN;
+  return {top, left, static_cast<uint16_t>(renderer.getScreenWidth() - left - right),
+          static_cast<uint16_t>(renderer.getScreenHeight() - top - bottom)};
+}
+
+bool HostReader::buildSection(Section& section) const {
+  const Viewport viewport = getViewport();
+  return section.createSectionFile(getFontId(), LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                                   viewport.width, viewport.height, HYPHENATION_ENABLED, EMBEDDED_STYLE,
+                                   IMAGE_RENDERING, FOCUS_READING);
+}
+
+void HostReader::renderPage(const PageView& page, const bool useDisplayList) {
+  const Viewport viewport = getViewport();
+  // BW pages start white, the grayscale planes start from all bits clear like the reader's anti-aliasing pass
+  renderer.clearScreen(renderer.getRenderMode() == GfxRenderer::BW ? 0xFF : 0x00);
+  auto scope = fontCacheManager.createPrewarmScope();
+  if (!useDisplayList) {
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop);  // scan pass
+    scope.endScanAndPrewarm();
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop);
+    return;
+  }
+  DisplayList displayList;
+  page.record(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, displayList);  // scan pass
+  scope.endScanAndPrewarm(displayList);
+  page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, &displayList);
+}
+
+void HostReader::renderPageAntiAliased(const PageView& page, const bool singlePass) {
+  const Viewport viewport = getViewport();
+  renderer.setRenderMode(GfxRenderer::BW);
+  renderer.clearScreen();
+  DisplayList displayList;
+  auto scope = fontCacheManager.createPrewarmScope();
+  page.record(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, displayList);  // scan pass
+  scope.endScanAndPrewarm(displayList);
+
+  if (singlePass && renderer.beginSinglePassGrayscale()) {
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, &displayList);
+    renderer.setRenderMode(GfxRenderer::BW);
+    renderer.displayBuffer();
+    renderer.endSinglePassGrayscale();
+  } else {
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, &displayList);
+    renderer.displayBuffer();
+    if (!renderer.storeBwBuffer()) {
+      LOG_ERR("HRD", "Failed to store BW buffer");
+      return;
+    }
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, &displayList);
+    renderer.copyGrayscaleLsbBuffers();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    page.render(renderer, getFontId(), viewport.marginLeft, viewport.marginTop, &displayList);
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.setRenderMode(GfxRenderer::BW);
+  }
+  renderer.displayGrayBuffer();
+  renderer.restoreBwBuffer();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+// What the host pipeline tests share of the reader: a GfxRenderer on the in-memory display with the builtin
+// Noto Serif 14 loaded through the font decompressor, and the reader's default layout. Sections are laid out and
+// pages drawn the way EpubReaderActivity does it.
+
+#include <Epub/PageView.h>
+#include <Epub/Section.h>
+#include <FontCacheManager.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+
+class HostReader {
+ public:
+  // Layout of the reader's defaults: normal line spacing, justified, extra paragraph spacing, embedded styles,
+  // images shown, 5px screen margin and no status bar
+  struct Viewport {
+    int marginTop;
+    int marginLeft;
+    uint16_t width;
+    uint16_t height;
+  };
+
+  HostReader();
+  HostReader(const HostReader&) = delete;
+  HostReader& operator=(const HostReader&) = delete;
+
+  GfxRenderer& getRenderer() { return renderer; }
+  int getFontId() const;
+  // For the renderer's current orientation
+  Viewport getViewport() const;
+
+  bool buildSection(Section& section) const;
+  // Clear the screen and draw the page in the current render mode, with the reader's font prewarm pass first. The
+  // prewarm pass records a display list that the page is drawn from, unless useDisplayList is false; the page is
+  // then laid out again the way pages in SD card fonts are.
+  void renderPage(const PageView& page, bool useDisplayList = true);
+  // The reader's anti-aliased page turn: prewarm, BW frame and refresh, then both gray planes handed to the display
+  // and the BW frame restored. singlePass draws the BW frame and both gray planes in one BW_AND_GRAYSCALE pass
+  // instead of a BW pass followed by separate LSB and MSB passes.
+  void renderPageAntiAliased(const PageView& page, bool singlePass = true);
+
+ private:
+  GfxRenderer renderer;
+  FontDecompressor fontDecompressor;
+  FontCacheManager fontCacheManager;
+};
@@ -0,0 +1,132 @@
+// Host stand-ins for the image converters built on JPEGDEC and PNGdec, which only exist in the device build.
+// Dimensions come from the image headers so pages lay out exactly as on device. Decoding draws the image's box
+// outline instead of its pixels, through the same pixel writer and pixel cache as the real decoders, so later
+// renders of the page take the cached path like they would on device. JPEG covers are not converted.
+
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <JpegToBmpConverter.h>
+#include <Logging.h>
+
+#include <Epub/converters/DirectPixelWriter.h>
+#include <Epub/converters/JpegToFramebufferConverter.h>
+#include <Epub/converters/PixelCache.h>
+#include <Epub/converters/PngToFramebufferConverter.h>
+
+#include <cstring>
+
+namespace {
+uint16_t readBe16(const uint8_t* p) { return static_cast<uint16_t>(p[0] << 8 | p[1]); }
+
+uint32_t readBe32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 | static_cast<uint32_t>(p[2]) << 8 |
+         p[3];
+}
+
+bool readPngDimensions(const std::string& imagePath, ImageDimensions& out) {
+  FsFile file;
+  uint8_t header[24];
+  if (!Storage.openFileForRead("PNG", imagePath, file) || file.read(header, sizeof(header)) != sizeof(header) ||
+      memcmp(header + 12, "IHDR", 4) != 0) {
+    return false;
+  }
+  out.width = static_cast<int16_t>(readBe32(header + 16));
+  out.height = static_cast<int16_t>(readBe32(header + 20));
+  return true;
+}
+
+// Walk the marker segments up to the first start-of-frame, which carries the image size
+bool readJpegDimensions(const std::string& imagePath, ImageDimensions& out) {
+  FsFile file;
+  uint8_t buf[9];
+  if (!Storage.openFileForRead("JPG", imagePath, file) || file.read(buf, 2) != 2 || buf[0] != 0xFF ||
+      buf[1] != 0xD8) {
+    return false;
+  }
+  while (file.read(buf, 4) == 4 && buf[0] == 0xFF) {
+    const uint8_t marker = buf[1];
+    const uint16_t length = readBe16(buf + 2);
+    const bool startOfFrame = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+    if (startOfFrame) {
+      if (file.read(buf, 5) != 5) {
+        return false;
+      }
+      out.height = static_cast<int16_t>(readBe16(buf + 1));
+      out.width = static_cast<int16_t>(readBe16(buf + 3));
+      return true;
+    }
+    if (length < 2 || !file.seekCur(length - 2)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+bool drawPlaceholder(GfxRenderer& renderer, const RenderConfig& config) {
+  PixelCache cache;
+  const bool caching = !config.cachePath.empty() &&
+                       cache.allocate(config.maxWidth, config.maxHeight, config.x, config.y);
+  DirectPixelWriter pw;
+  pw.init(renderer);
+  for (int row = 0; row < config.maxHeight; row++) {
+    const int y = config.y + row;
+    pw.beginRow(y);
+    for (int col = 0; col < config.maxWidth; col++) {
+      const int x = config.x + col;
+      const bool edge = row == 0 || col == 0 || row == config.maxHeight - 1 || col == config.maxWidth - 1;
+      // 2-bit levels, 0 black to 3 white
+      const uint8_t value = edge ? 0 : 3;
+      pw.writePixel(x, value);
+      if (caching) {
+        cache.setPixel(x, y, value);
+      }
+    }
+  }
+  if (caching) {
+    cache.writeToFile(config.cachePath);
+  }
+  return true;
+}
+}  // namespace
+
+bool JpegToFramebufferConverter::getDimensionsStatic(const std::string& imagePath, ImageDimensions& out) {
+  return readJpegDimensions(imagePath, out);
+}
+
+bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string&, GfxRenderer& renderer,
+                                                     const RenderConfig& config) {
+  return drawPlaceholder(renderer, config);
+}
+
+bool JpegToFramebufferConverter::supportsFormat(const std::string& extension) {
+  return FsHelpers::hasJpgExtension(extension);
+}
+
+bool PngToFramebufferConverter::getDimensionsStatic(const std::string& imagePath, ImageDimensions& out) {
+  return readPngDimensions(imagePath, out);
+}
+
+bool PngToFramebufferConverter::decodeToFramebuffer(const std::string&, GfxRenderer& renderer,
+                                                    const RenderConfig& config) {
+  return drawPlaceholder(renderer, config);
+}
+
+bool PngToFramebufferConverter::supportsFormat(const std::string& extension) {
+  return FsHelpers::hasPngExtension(extension);
+}
+
+bool JpegToBmpConverter::jpegFileToBmpStream(FsFile&, Print&, bool) {
+  LOG_ERR("JPG", "JPEG conversion is not available on host");
+  return false;
+}
+
+bool JpegToBmpConverter::jpegFileToBmpStreamWithSize(FsFile&, Print&, int, int) {
+  LOG_ERR("JPG", "JPEG conversion is not available on host");
+  return false;
+}
+
+bool JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(FsFile&, Print&, int, int) {
+  LOG_ERR("JPG", "JPEG conversion is not available on host");
+  return false;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Host stand-in for lib/Logging/Logging.h. Errors go to stderr, everything else is dropped.
+// Like the device logPrintf, the format is not type-checked (the firmware logs size_t with %d in places).
+// The device header pulls the Arduino core in through HardwareSerial.h, and the libraries rely on that.
+
+#include <Arduino.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+inline void hostLogError(const char* origin, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "[ERR] [%s] ", origin);
+  vfprintf(stderr, format, args);
+  fputc('\n', stderr);
+  va_end(args);
+}
+
+#define LOG_ERR(origin, format, ...) hostLogError(origin, format __VA_OPT__(, ) __VA_ARGS__)
+#define LOG_INF(origin, format, ...)
+#define LOG_DBG(origin, format, ...)
@@ -0,0 +1,30 @@
+#pragma once
+
+// Fixtures the host rendering tests and benchmarks share: the four screen orientations with the names their reports
+// and golden images use, and a framebuffer filled with reproducible noise so that drawing is checked against pixels
+// that are already set as well as clear ones.
+
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+
+#include <cstdint>
+#include <random>
+
+struct OrientationName {
+  GfxRenderer::Orientation orientation;
+  const char* name;
+};
+
+constexpr OrientationName ORIENTATIONS[] = {
+    {GfxRenderer::Portrait, "portrait"},
+    {GfxRenderer::LandscapeClockwise, "landscape_cw"},
+    {GfxRenderer::PortraitInverted, "portrait_inverted"},
+    {GfxRenderer::LandscapeCounterClockwise, "landscape_ccw"},
+};
+
+inline void fillNoise(uint8_t* frameBuffer, const uint32_t seed) {
+  std::mt19937 rng(seed);
+  for (uint32_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+    frameBuffer[i] = static_cast<uint8_t>(rng());
+  }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+// Host stand-in for the Arduino String class, covering what the host-built libraries use.
+
+#include <cstring>
+#include <string>
+
+class String {
+  std::string s;
+
+ public:
+  String() = default;
+  String(const char* str) : s(str ? str : "") {}
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return static_cast<unsigned int>(s.size()); }
+  bool isEmpty() const { return s.empty(); }
+  bool endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+  }
+  bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+
+  String& operator+=(const String& other) {
+    s += other.s;
+    return *this;
+  }
+  friend String operator+(String lhs, const String& rhs) { return lhs += rhs; }
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator==(const char* other) const { return s == (other ? other : ""); }
+};
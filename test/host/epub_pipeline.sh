@@ -0,0 +1,102 @@
+# Sourced by the run_*.sh scripts that link the whole EPUB pipeline on host. Defines
+#   build_epub_pipeline <build dir> <binary> <sources...>
+# which compiles the given test sources together with the reader pipeline (Epub, ZipFile, expat, uzlib, fonts,
+# GfxRenderer and the test/host stand-ins) into <binary>.
+
+build_epub_pipeline() {
+  local build_dir="$1" binary="$2"
+  shift 2
+  local root_dir
+  root_dir="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+  # The whole EPUB library except the framebuffer converters, which need JPEGDEC/PNGdec (test/host stands in for
+  # them)
+  local epub_sources
+  mapfile -t epub_sources < <(find "$root_dir/lib/Epub" -name '*.cpp' \
+    ! -name 'JpegToFramebufferConverter.cpp' ! -name 'PngToFramebufferConverter.cpp' | sort)
+
+  local sources=(
+    "$@"
+    "$root_dir/test/host/Arduino.cpp"
+    "$root_dir/test/host/HalDisplay.cpp"
+    "$root_dir/test/host/HalStorage.cpp"
+    "$root_dir/test/host/HostHeap.cpp"
+    "$root_dir/test/host/HostReader.cpp"
+    "$root_dir/test/host/ImageConverters.cpp"
+    "${epub_sources[@]}"
+    "$root_dir/lib/EpdFont/EpdFont.cpp"
+    "$root_dir/lib/EpdFont/EpdFontFamily.cpp"
+    "$root_dir/lib/EpdFont/FontDecompressor.cpp"
+    "$root_dir/lib/EpdFont/SdCardFont.cpp"
+    "$root_dir/lib/FsHelpers/FsHelpers.cpp"
+    "$root_dir/lib/GfxRenderer/Bitmap.cpp"
+    "$root_dir/lib/GfxRenderer/BitmapHelpers.cpp"
+    "$root_dir/lib/GfxRenderer/DisplayList.cpp"
+    "$root_dir/lib/GfxRenderer/FontCacheManager.cpp"
+    "$root_dir/lib/GfxRenderer/GfxRenderer.cpp"
+    "$root_dir/lib/GfxRenderer/WordWidthCache.cpp"
+    "$root_dir/lib/InflateReader/InflateReader.cpp"
+    "$root_dir/lib/PngToBmpConverter/PngToBmpConverter.cpp"
+    "$root_dir/lib/Serialization/BufferedFile.cpp"
+    "$root_dir/lib/Trace/Trace.cpp"
+    "$root_dir/lib/Utf8/Utf8.cpp"
+    "$root_dir/lib/ZipFile/ZipFile.cpp"
+  )
+
+  local includes=(
+    -I"$root_dir/test/host"
+    -I"$root_dir/lib/Epub"
+    -I"$root_dir/lib/EpdFont"
+    -I"$root_dir/lib/FsHelpers"
+    -I"$root_dir/lib/GfxRenderer"
+    -I"$root_dir/lib/InflateReader"
+    -I"$root_dir/lib/JpegToBmpConverter"
+    -I"$root_dir/lib/PngToBmpConverter"
+    -I"$root_dir/lib/Serialization"
+    -I"$root_dir/lib/Trace"
+    -I"$root_dir/lib/Utf8"
+    -I"$root_dir/lib/XmlParserUtils"
+    -I"$root_dir/lib/ZipFile"
+    -I"$root_dir/lib/expat"
+    -I"$root_dir/lib/uzlib/src"
+    -I"$root_dir/src"
+  )
+
+  local cxxflags=(
+    -std=c++20
+    -O2
+    -Wall
+    -Wextra
+    -pedantic
+    # Serialization.h defines static helpers for every stream type; only some are used here
+    -Wno-unused-function
+    # The generated builtin fonts leave their glyph-miss hooks to default initialization
+    -Wno-missing-field-initializers
+    -fno-exceptions
+    # Same expat configuration as the firmware build
+    -DXML_GE=0
+    -DXML_CONTEXT_BYTES=1024
+    # Trace spans on, with room for a whole book (see Trace.h)
+    -DENABLE_TRACE
+    -DTRACE_BUFFER_EVENTS=65536
+    "${includes[@]}"
+  )
+
+  # Count every allocation the libraries make, including the C ones from expat, uzlib and ZipFile (see HostHeap.h)
+  local ldflags=(
+    -Wl,--gc-sections
+    -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+  )
+
+  mkdir -p "$build_dir"
+  # The vendored uzlib ships without its checksum sources; drop the unused checksum path like the firmware link does
+  cc -O2 -ffunction-sections -c "$root_dir/lib/uzlib/src/tinflate.c" -o "$build_dir/tinflate.o"
+  local objects=("$build_dir/tinflate.o")
+  local src
+  for src in xmlparse xmlrole xmltok; do
+    cc -O2 -DXML_GE=0 -DXML_CONTEXT_BYTES=1024 -I"$root_dir/lib/expat" -c "$root_dir/lib/expat/$src.c" \
+      -o "$build_dir/$src.o"
+    objects+=("$build_dir/$src.o")
+  done
+  c++ "${cxxflags[@]}" "${sources[@]}" "${objects[@]}" "${ldflags[@]}" -o "$binary"
+}
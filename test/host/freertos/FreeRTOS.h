@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS configuration the libraries read
+
+#define configMAX_TASK_NAME_LEN 16
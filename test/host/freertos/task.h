@@ -0,0 +1,14 @@
+#pragma once
+
+// Host stand-in for the FreeRTOS task queries the libraries use: every thread is its own task
+
+#include "FreeRTOS.h"
+
+using TaskHandle_t = const void*;
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+  static thread_local const char marker = 0;
+  return &marker;
+}
+
+inline const char* pcTaskGetName(TaskHandle_t) { return "host"; }
@@ -0,0 +1,202 @@
+// Microbenchmark for EpdFont's kerning and ligature lookups, which drawText(), getTextBounds(), getSpaceAdvance() and
+// the line breaker run for every glyph pair. Measures a paragraph of Latin, Cyrillic and Greek text in Noto Serif 14
+// (the default reader font) and Ubuntu 12 (the UI font) through the binary searches over the sorted class and pair
+// tables the fonts used before and through the direct-indexed tables they now carry, and reports lookups/second.
+//
+// Before timing anything it checks that both paths agree on the kerning and ligature of every codepoint pair below
+// EPD_DIRECT_LOOKUP_LIMIT, on pairs with the kerned codepoints above it, and on the measured width of every word.
+//
+// Usage: KerningLookupBenchmark [--iterations <n>]
+
+#include <EpdFont.h>
+#include <Utf8.h>
+#include <builtinFonts/notoserif_14_regular.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char TEXT[] =
+    "The office was quiet after five. Iffy light fell through the tall windows, and Vera waited, affixing a final "
+    "stamp to the parcel before she took off her coat. \"We'll fly to Kyiv tomorrow,\" she wrote; \"AVA travels "
+    "with us.\" Тогда она вышла на улицу, где шёл тихий снег, и долго смотрела на огни города. Ἐν ἀρχῇ ἦν ὁ λόγος, "
+    "καὶ ὁ λόγος ἦν πρὸς τὸν θεόν. Toward evening, the efficient staff offloaded fifty-five boxes of waffles.";
+
+struct FontPair {
+  const char* name;
+  EpdFontData searchData;  // the font with its direct tables removed
+  EpdFont direct;
+  EpdFont search;
+
+  FontPair(const char* name, const EpdFontData* data) : name(name), searchData(*data), direct(data), search(nullptr) {
+    searchData.kernLeftDirect = nullptr;
+    searchData.kernRightDirect = nullptr;
+    searchData.ligatureStartBits = nullptr;
+    search.data = &searchData;
+  }
+};
+
+std::vector<uint32_t> codepoints(const char* text) {
+  std::vector<uint32_t> cps;
+  const auto* p = reinterpret_cast<const uint8_t*>(text);
+  while (const uint32_t cp = utf8NextCodepoint(&p)) cps.push_back(cp);
+  return cps;
+}
+
+std::vector<std::string> words(const char* text) {
+  std::vector<std::string> result;
+  std::string word;
+  for (const char* c = text;; c++) {
+    if (*c == ' ' || *c == '\0') {
+      if (!word.empty()) result.push_back(word);
+      word.clear();
+      if (*c == '\0') break;
+    } else {
+      word += *c;
+    }
+  }
+  return result;
+}
+
+int textWidth(const EpdFont& font, const char* text) {
+  int w = 0, h = 0;
+  font.getTextDimensions(text, &w, &h);
+  return w;
+}
+
+bool check(const FontPair& font) {
+  const EpdFontData* data = font.direct.data;
+  if (!data->kernLeftDirect || !data->kernRightDirect || !data->ligatureStartBits) {
+    fprintf(stderr, "FAIL %s: font has no direct lookup tables\n", font.name);
+    return false;
+  }
+
+  // Every pair below the limit, plus the kerned codepoints above it against each other and the low range
+  std::vector<uint32_t> high;
+  for (uint16_t i = 0; i < data->kernLeftEntryCount; i++) high.push_back(data->kernLeftClasses[i].codepoint);
+  for (uint16_t i = 0; i < data->kernRightEntryCount; i++) high.push_back(data->kernRightClasses[i].codepoint);
+  for (uint32_t i = 0; i < data->ligaturePairCount; i++) high.push_back(data->ligaturePairs[i].pair >> 16);
+  high.erase(std::remove_if(high.begin(), high.end(), [](uint32_t cp) { return cp < EPD_DIRECT_LOOKUP_LIMIT; }),
+             high.end());
+  std::vector<uint32_t> all(EPD_DIRECT_LOOKUP_LIMIT);
+  for (uint32_t cp = 0; cp < EPD_DIRECT_LOOKUP_LIMIT; cp++) all[cp] = cp;
+  all.insert(all.end(), high.begin(), high.end());
+
+  uint64_t pairs = 0;
+  uint32_t kerned = 0;
+  for (const uint32_t left : all) {
+    for (const uint32_t right : all) {
+      if (left >= EPD_DIRECT_LOOKUP_LIMIT && right >= EPD_DIRECT_LOOKUP_LIMIT && left != right) continue;
+      pairs++;
+      const int8_t kern = font.direct.getKerning(left, right);
+      if (kern != font.search.getKerning(left, right)) {
+        fprintf(stderr, "FAIL %s: kerning U+%04X U+%04X differs\n", font.name, left, right);
+        return false;
+      }
+      if (font.direct.getLigature(left, right) != font.search.getLigature(left, right)) {
+        fprintf(stderr, "FAIL %s: ligature U+%04X U+%04X differs\n", font.name, left, right);
+        return false;
+      }
+      kerned += kern != 0;
+    }
+  }
+
+  for (const auto& word : words(TEXT)) {
+    if (textWidth(font.direct, word.c_str()) != textWidth(font.search, word.c_str())) {
+      fprintf(stderr, "FAIL %s: width of \"%s\" differs\n", font.name, word.c_str());
+      return false;
+    }
+  }
+  printf("%s: %llu pairs (%u kerned) and every word width match\n", font.name, static_cast<unsigned long long>(pairs),
+         kerned);
+  return true;
+}
+
+template <typename Op>
+double perSecond(const int iterations, const size_t opsPerIteration, Op op) {
+  const auto start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    op();
+  }
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return static_cast<double>(opsPerIteration) * iterations / seconds;
+}
+
+volatile int sink;
+
+void benchmark(const FontPair& font, const int iterations) {
+  const std::vector<uint32_t> cps = codepoints(TEXT);
+  const std::vector<std::string> textWords = words(TEXT);
+
+  const auto kerning = [&](const EpdFont& f) {
+    return perSecond(iterations, cps.size() - 1, [&] {
+      int sum = 0;
+      for (size_t i = 1; i < cps.size(); i++) sum += f.getKerning(cps[i - 1], cps[i]);
+      sink = sum;
+    });
+  };
+  const auto ligatures = [&](const EpdFont& f) {
+    return perSecond(iterations, cps.size(), [&] {
+      uint32_t sum = 0;
+      const char* text = TEXT;
+      while (const uint32_t cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text))) {
+        sum += f.applyLigatures(cp, text);
+      }
+      sink = static_cast<int>(sum);
+    });
+  };
+  const auto widths = [&](const EpdFont& f) {
+    return perSecond(iterations, textWords.size(), [&] {
+      int sum = 0;
+      for (const auto& word : textWords) sum += textWidth(f, word.c_str());
+      sink = sum;
+    });
+  };
+
+  const double kernBefore = kerning(font.search);
+  const double kernAfter = kerning(font.direct);
+  const double ligBefore = ligatures(font.search);
+  const double ligAfter = ligatures(font.direct);
+  const double widthBefore = widths(font.search);
+  const double widthAfter = widths(font.direct);
+  printf("%-12s getKerning: %6.1f -> %6.1f M/s (%4.1fx)  applyLigatures: %6.1f -> %6.1f M/s (%4.1fx)  "
+         "word widths: %5.2f -> %5.2f M/s (%4.2fx)\n",
+         font.name, kernBefore / 1e6, kernAfter / 1e6, kernAfter / kernBefore, ligBefore / 1e6, ligAfter / 1e6,
+         ligAfter / ligBefore, widthBefore / 1e6, widthAfter / 1e6, widthAfter / widthBefore);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = 20000;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = std::max(1, atoi(argv[++i]));
+    } else {
+      fprintf(stderr, "Usage: %s [--iterations <n>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FontPair fonts[] = {{"notoserif_14", &notoserif_14_regular}, {"ubuntu_12", &ubuntu_12_regular}};
+  for (const auto& font : fonts) {
+    if (!check(font)) {
+      return 1;
+    }
+  }
+
+  printf("Mixed Latin/Cyrillic/Greek paragraph, %d iterations, binary search -> direct tables\n", iterations);
+  for (const auto& font : fonts) {
+    benchmark(font, iterations);
+  }
+  return 0;
+}
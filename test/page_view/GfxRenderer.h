@@ -0,0 +1,65 @@
+#pragma once
+
+// Recording stand-in for lib/GfxRenderer/GfxRenderer.h: only the calls PageView makes, logged so the test can check
+// what a page would draw. Every glyph is 10px wide and the ascender is 8px. Display lists keep the real format but
+// only get lines and images: text is logged as it is drawn, recording or not.
+
+#include <DisplayList.h>
+#include <EpdFontFamily.h>
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+class GfxRenderer {
+ public:
+  struct TextCall {
+    int x;
+    int y;
+    std::string text;
+    EpdFontFamily::Style style;
+  };
+  struct LineCall {
+    int x1;
+    int y1;
+    int x2;
+    int y2;
+  };
+
+  mutable std::vector<TextCall> texts;
+  mutable std::vector<LineCall> lines;
+  DisplayList* recorder = nullptr;
+
+  void drawText(int /*fontId*/, const int x, const int y, const char* text, bool /*black*/ = true,
+                const EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    texts.push_back({x, y, text, style});
+  }
+  void drawLine(const int x1, const int y1, const int x2, const int y2, const bool state = true) const {
+    if (recorder) {
+      recorder->addLine(x1, y1, x2, y2, state);
+      return;
+    }
+    lines.push_back({x1, y1, x2, y2});
+  }
+  void setDisplayListRecorder(DisplayList* list) { recorder = list; }
+  void drawDisplayList(const DisplayList& list,
+                       const std::function<void(uint16_t index, int x, int y)>& drawImage = nullptr) const {
+    const auto& ops = list.getOps();
+    for (size_t i = 0; i < ops.size(); i++) {
+      if (ops[i].kind() == DisplayList::OpKind::Line) {
+        drawLine(ops[i].x, ops[i].y, ops[i + 1].x, ops[i + 1].y, ops[i].flag());
+        i++;
+      } else if (ops[i].kind() == DisplayList::OpKind::Image && drawImage) {
+        drawImage(static_cast<uint16_t>(ops[i].index()), ops[i].x, ops[i].y);
+      }
+    }
+  }
+  int getTextWidth(int /*fontId*/, const char* text, EpdFontFamily::Style /*style*/ = EpdFontFamily::REGULAR) const {
+    return static_cast<int>(strlen(text)) * 10;
+  }
+  int getTextAdvanceX(int fontId, const char* text, const EpdFontFamily::Style style) const {
+    return getTextWidth(fontId, text, style);
+  }
+  int getFontAscenderSize(int /*fontId*/) const { return 8; }
+};
@@ -0,0 +1,309 @@
+// Round-trips pages through Page::serialize and PageView::fromBlob, and checks what PageView::render draws against
+// a recording GfxRenderer. Image decoding is replaced by a recorder below; only the blob format is under test.
+// Pages recorded into a display list have to replay their lines and images where render() draws them.
+
+#include <BufferedFile.h>
+#include <DisplayList.h>
+#include <Epub/Page.h>
+#include <Epub/PageView.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_EQ(a, b)                                                                                       \
+  do {                                                                                                        \
+    if ((a) != (b)) {                                                                                         \
+      fprintf(stderr, "  FAIL: %s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #a,                   \
+              static_cast<long long>(a), static_cast<long long>(b));                                          \
+      testsFailed++;                                                                                          \
+      return;                                                                                                 \
+    }                                                                                                         \
+  } while (0)
+
+#define ASSERT_TRUE(cond)                                                \
+  do {                                                                   \
+    if (!(cond)) {                                                       \
+      fprintf(stderr, "  FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      testsFailed++;                                                     \
+      return;                                                            \
+    }                                                                    \
+  } while (0)
+
+#define PASS() testsPassed++
+
+// ============================================================================
+// ImageBlock stand-in: PageView hands images to ImageBlock::render, which decodes from SD on device
+// ============================================================================
+
+struct ImageCall {
+  std::string path;
+  int x;
+  int y;
+  int width;
+  int height;
+};
+static std::vector<ImageCall> imageCalls;
+
+ImageBlock::ImageBlock(const std::string& imagePath, const int16_t width, const int16_t height)
+    : imagePath(imagePath), width(width), height(height) {}
+
+void ImageBlock::render(GfxRenderer& /*renderer*/, const int x, const int y) {
+  imageCalls.push_back({imagePath, x, y, width, height});
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static std::string scratchPath;
+
+static std::shared_ptr<TextBlock> makeLine(std::vector<std::string> words, std::vector<int16_t> xs,
+                                           std::vector<EpdFontFamily::Style> styles,
+                                           std::vector<uint8_t> focusBoundary = {},
+                                           std::vector<uint16_t> focusSuffixX = {}) {
+  return std::make_shared<TextBlock>(std::move(words), std::move(xs), std::move(styles), std::move(focusBoundary),
+                                     std::move(focusSuffixX));
+}
+
+// Serialize the page to the scratch file and load the whole file back as one blob
+static std::unique_ptr<PageView> roundTrip(const Page& page, size_t* blobSize = nullptr) {
+  FsFile file;
+  if (!Storage.openFileForWrite("TST", scratchPath, file)) {
+    return nullptr;
+  }
+  {
+    BufferedFileWriter out(file);
+    if (!page.serialize(out) || !out.flush()) {
+      return nullptr;
+    }
+  }
+  const size_t size = file.size();
+  auto* blob = static_cast<uint8_t*>(malloc(size));
+  file.seek(0);
+  if (file.read(blob, size) != static_cast<int>(size)) {
+    free(blob);
+    return nullptr;
+  }
+  if (blobSize) {
+    *blobSize = size;
+  }
+  return PageView::fromBlob(blob, size);
+}
+
+static uint8_t* copyBlob(const std::vector<uint8_t>& bytes) {
+  auto* blob = static_cast<uint8_t*>(malloc(bytes.size()));
+  memcpy(blob, bytes.data(), bytes.size());
+  return blob;
+}
+
+static std::vector<uint8_t> serializeToBytes(const Page& page) {
+  size_t size = 0;
+  if (!roundTrip(page, &size)) {
+    return {};
+  }
+  std::vector<uint8_t> bytes(size);
+  FILE* f = fopen(scratchPath.c_str(), "rb");
+  const size_t n = fread(bytes.data(), 1, size, f);
+  fclose(f);
+  bytes.resize(n);
+  return bytes;
+}
+
+static Page makeMixedPage() {
+  Page page;
+  page.elements.push_back(std::make_shared<PageLine>(
+      makeLine({"Hello", "world"}, {0, 60}, {EpdFontFamily::REGULAR, EpdFontFamily::ITALIC}), 5, 10));
+  page.elements.push_back(std::make_shared<PageImage>(std::make_shared<ImageBlock>("/img/a.png", 100, 50), 20, 40));
+  page.elements.push_back(std::make_shared<PageLine>(
+      makeLine({"focus", "\xe2\x80\x83under"}, {0, 70}, {EpdFontFamily::REGULAR, EpdFontFamily::UNDERLINE}, {2, 0},
+               {21, 0}),
+      0, 100));
+  page.elements.push_back(std::make_shared<PageImage>(std::make_shared<ImageBlock>("/img/b.jpg", 30, 90), 150, 30));
+  page.addFootnote("1", "notes.xhtml#n1");
+  page.addFootnote("2", "notes.xhtml#n2");
+  return page;
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+void testRoundTripContents() {
+  printf("testRoundTripContents...\n");
+  size_t blobSize = 0;
+  const auto view = roundTrip(makeMixedPage(), &blobSize);
+  ASSERT_TRUE(view != nullptr);
+  ASSERT_EQ(view->size(), blobSize);
+  ASSERT_TRUE(view->getText() == "Hello world focus \xe2\x80\x83under");
+
+  ASSERT_EQ(view->getFootnoteCount(), 2);
+  ASSERT_TRUE(std::string(view->getFootnotes()[0].number) == "1");
+  ASSERT_TRUE(std::string(view->getFootnotes()[1].href) == "notes.xhtml#n2");
+
+  ASSERT_TRUE(view->hasImages());
+  int16_t x, y, w, h;
+  ASSERT_TRUE(view->getImageBoundingBox(x, y, w, h));
+  ASSERT_EQ(x, 20);
+  ASSERT_EQ(y, 30);
+  ASSERT_EQ(w, 160);
+  ASSERT_EQ(h, 90);
+  PASS();
+}
+
+void testRenderDrawsWordsInPlace() {
+  printf("testRenderDrawsWordsInPlace...\n");
+  const auto view = roundTrip(makeMixedPage());
+  ASSERT_TRUE(view != nullptr);
+
+  GfxRenderer renderer;
+  imageCalls.clear();
+  view->render(renderer, 0, 1000, 2000);
+
+  ASSERT_EQ(imageCalls.size(), 2);
+  ASSERT_TRUE(imageCalls[0].path == "/img/a.png");
+  ASSERT_EQ(imageCalls[0].x, 1020);
+  ASSERT_EQ(imageCalls[0].y, 2040);
+  ASSERT_EQ(imageCalls[1].width, 30);
+  ASSERT_EQ(imageCalls[1].height, 90);
+
+  // "Hello", "world", bold "fo" + "cus", then the underlined word
+  ASSERT_EQ(renderer.texts.size(), 5);
+  ASSERT_TRUE(renderer.texts[0].text == "Hello");
+  ASSERT_EQ(renderer.texts[0].x, 1005);
+  ASSERT_EQ(renderer.texts[0].y, 2010);
+  ASSERT_EQ(renderer.texts[1].x, 1065);
+  ASSERT_EQ(renderer.texts[1].style, EpdFontFamily::ITALIC);
+  ASSERT_TRUE(renderer.texts[2].text == "fo");
+  ASSERT_EQ(renderer.texts[2].style, EpdFontFamily::BOLD);
+  ASSERT_EQ(renderer.texts[2].x, 1000);
+  ASSERT_TRUE(renderer.texts[3].text == "cus");
+  ASSERT_EQ(renderer.texts[3].x, 1021);
+  ASSERT_EQ(renderer.texts[3].style, EpdFontFamily::REGULAR);
+  ASSERT_EQ(renderer.texts[4].x, 1070);
+
+  // Underline skips the leading em-space: starts after its 30px and spans the 5 visible glyphs
+  ASSERT_EQ(renderer.lines.size(), 1);
+  ASSERT_EQ(renderer.lines[0].x1, 1100);
+  ASSERT_EQ(renderer.lines[0].x2, 1150);
+  ASSERT_EQ(renderer.lines[0].y1, 2100 + 8 + 2);
+  PASS();
+}
+
+void testRecordedPageReplays() {
+  printf("testRecordedPageReplays...\n");
+  const auto view = roundTrip(makeMixedPage());
+  ASSERT_TRUE(view != nullptr);
+
+  GfxRenderer renderer;
+  DisplayList list;
+  imageCalls.clear();
+  view->record(renderer, 0, 1000, 2000, list);
+  ASSERT_TRUE(list.isComplete());
+  ASSERT_TRUE(renderer.recorder == nullptr);
+  // Recording draws nothing: two image ops and the underline (start and end op)
+  ASSERT_EQ(imageCalls.size(), 0);
+  ASSERT_EQ(renderer.lines.size(), 0);
+  ASSERT_EQ(list.size(), 4);
+
+  renderer.texts.clear();
+  view->render(renderer, 0, 1000, 2000, &list);
+  ASSERT_EQ(renderer.texts.size(), 0);
+  ASSERT_EQ(imageCalls.size(), 2);
+  ASSERT_TRUE(imageCalls[1].path == "/img/b.jpg");
+  ASSERT_EQ(imageCalls[1].x, 1150);
+  ASSERT_EQ(imageCalls[1].y, 2030);
+  ASSERT_EQ(renderer.lines.size(), 1);
+  ASSERT_EQ(renderer.lines[0].x1, 1100);
+  ASSERT_EQ(renderer.lines[0].x2, 1150);
+  ASSERT_EQ(renderer.lines[0].y1, 2100 + 8 + 2);
+
+  // An incomplete list is ignored and the page laid out again
+  list.markIncomplete();
+  imageCalls.clear();
+  view->render(renderer, 0, 1000, 2000, &list);
+  ASSERT_EQ(renderer.texts.size(), 5);
+  ASSERT_EQ(imageCalls.size(), 2);
+  PASS();
+}
+
+void testEmptyPage() {
+  printf("testEmptyPage...\n");
+  const auto view = roundTrip(Page());
+  ASSERT_TRUE(view != nullptr);
+  ASSERT_EQ(view->size(), sizeof(PageBlobHeader));
+  ASSERT_TRUE(!view->hasImages());
+  ASSERT_TRUE(view->getText().empty());
+  int16_t x, y, w, h;
+  ASSERT_TRUE(!view->getImageBoundingBox(x, y, w, h));
+  PASS();
+}
+
+void testRejectsTruncatedBlob() {
+  printf("testRejectsTruncatedBlob...\n");
+  const auto bytes = serializeToBytes(makeMixedPage());
+  ASSERT_TRUE(!bytes.empty());
+  ASSERT_TRUE(PageView::fromBlob(copyBlob(bytes), bytes.size() - 1) == nullptr);
+  ASSERT_TRUE(PageView::fromBlob(copyBlob(bytes), 4) == nullptr);
+  PASS();
+}
+
+void testRejectsOutOfPoolWord() {
+  printf("testRejectsOutOfPoolWord...\n");
+  auto bytes = serializeToBytes(makeMixedPage());
+  ASSERT_TRUE(!bytes.empty());
+  const auto* header = reinterpret_cast<const PageBlobHeader*>(bytes.data());
+  const size_t firstWord = sizeof(PageBlobHeader) + header->lineCount * sizeof(PageLineRecord) +
+                           header->imageCount * sizeof(PageImageRecord);
+  auto* word = reinterpret_cast<PageWordRecord*>(bytes.data() + firstWord);
+  word->length += 1;  // no longer ends on its NUL
+  ASSERT_TRUE(PageView::fromBlob(copyBlob(bytes), bytes.size()) == nullptr);
+  PASS();
+}
+
+void testRejectsUnterminatedFootnote() {
+  printf("testRejectsUnterminatedFootnote...\n");
+  auto bytes = serializeToBytes(makeMixedPage());
+  ASSERT_TRUE(!bytes.empty());
+  const auto* header = reinterpret_cast<const PageBlobHeader*>(bytes.data());
+  ASSERT_TRUE(header->footnoteCount > 0);
+  const size_t firstFootnote = sizeof(PageBlobHeader) + header->lineCount * sizeof(PageLineRecord) +
+                               header->imageCount * sizeof(PageImageRecord) +
+                               header->wordCount * sizeof(PageWordRecord);
+  auto* footnote = reinterpret_cast<FootnoteEntry*>(bytes.data() + firstFootnote);
+
+  memset(footnote->number, 'x', FOOTNOTE_NUMBER_LEN);
+  ASSERT_TRUE(PageView::fromBlob(copyBlob(bytes), bytes.size()) == nullptr);
+
+  footnote->number[0] = '\0';
+  memset(footnote->href, 'x', FOOTNOTE_HREF_LEN);
+  ASSERT_TRUE(PageView::fromBlob(copyBlob(bytes), bytes.size()) == nullptr);
+  PASS();
+}
+
+int main(int argc, char** argv) {
+  const std::string scratchDir = argc > 1 ? argv[1] : "build/page_view/scratch";
+  std::filesystem::create_directories(scratchDir);
+  scratchPath = scratchDir + "/page.bin";
+
+  printf("=== PageView Tests ===\n\n");
+  testRoundTripContents();
+  testRenderDrawsWordsInPlace();
+  testRecordedPageReplays();
+  testEmptyPage();
+  testRejectsTruncatedBlob();
+  testRejectsOutOfPoolWord();
+  testRejectsUnterminatedFootnote();
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}
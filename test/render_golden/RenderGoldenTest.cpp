@@ -0,0 +1,314 @@
+// Golden-image test for the reader's rendering. Lays out selected pages of the sample EPUBs with the reader's
+// defaults (see HostReader), draws each one in all four orientations into the BW, grayscale LSB and grayscale MSB
+// planes the way EpubReaderActivity does, and compares every plane bit for bit against the images checked in under
+// test/render_golden/golden. Drawing the page without its recorded display list, and a whole anti-aliased page turn
+// with all three planes drawn in one BW_AND_GRAYSCALE pass, have to reproduce the same planes. It then times the same
+// renders and reports pages/second.
+//
+// Images are P4 PBMs of the physical 800x480 framebuffer: the BW plane looks like the page, the gray planes show in
+// black the pixels each pass marks. A mismatching plane is written next to the build as
+// <name>.pbm together with <name>_diff.pgm, which shows the page faintly and the differing pixels in black.
+//
+// Usage: RenderGoldenTest <epub dir> <golden dir> <output dir> [--update] [--iterations <n>]
+// --update rewrites the golden images from the current renderer instead of comparing. Missing goldens are written
+// and reported as failures so that a new page cannot pass without its images being checked in.
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/PageView.h>
+#include <Epub/Section.h>
+#include <HalDisplay.h>
+#include <HostReader.h>
+#include <RenderFixtures.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Pages that exercise the parts of layout most likely to regress: kerning and ligatures, table flattening,
+// inline images and display:none content
+struct GoldenPage {
+  const char* epub;
+  int spineIndex;
+  int page;
+};
+
+constexpr GoldenPage GOLDEN_PAGES[] = {
+    {"test_kerning_ligature", 2, 0},
+    {"test_tables", 3, 0},
+    {"test_mixed_images", 3, 0},
+    {"test_display_none", 9, 0},
+};
+
+struct PlaneName {
+  GfxRenderer::RenderMode mode;
+  const char* name;
+};
+
+constexpr PlaneName PLANES[] = {
+    {GfxRenderer::BW, "bw"},
+    {GfxRenderer::GRAYSCALE_LSB, "lsb"},
+    {GfxRenderer::GRAYSCALE_MSB, "msb"},
+};
+
+constexpr int WIDTH = HalDisplay::DISPLAY_WIDTH;
+constexpr int HEIGHT = HalDisplay::DISPLAY_HEIGHT;
+
+using Plane = std::vector<uint8_t>;
+using Clock = std::chrono::steady_clock;
+
+// The BW framebuffer keeps white as a set bit and PBM has black as a set bit. In the grayscale planes a set bit
+// marks a pixel the pass darkens, so those are kept as they are.
+Plane capturePlane(const GfxRenderer::RenderMode mode) {
+  const uint8_t* frameBuffer = display.getFrameBuffer();
+  Plane plane(frameBuffer, frameBuffer + HalDisplay::BUFFER_SIZE);
+  if (mode == GfxRenderer::BW) {
+    for (auto& byte : plane) {
+      byte = ~byte;
+    }
+  }
+  return plane;
+}
+
+bool readPbm(const std::filesystem::path& path, Plane& plane) {
+  std::ifstream in(path, std::ios::binary);
+  std::string magic;
+  int width = 0, height = 0;
+  if (!(in >> magic >> width >> height) || magic != "P4" || width != WIDTH || height != HEIGHT) {
+    return false;
+  }
+  in.get();  // single whitespace before the raster
+  plane.resize(HalDisplay::BUFFER_SIZE);
+  return static_cast<bool>(in.read(reinterpret_cast<char*>(plane.data()), plane.size()));
+}
+
+bool writePbm(const std::filesystem::path& path, const Plane& plane) {
+  std::ofstream out(path, std::ios::binary);
+  out << "P4\n" << WIDTH << " " << HEIGHT << "\n";
+  out.write(reinterpret_cast<const char*>(plane.data()), plane.size());
+  return static_cast<bool>(out);
+}
+
+bool pixelSet(const Plane& plane, const int i) { return plane[i / 8] & (0x80 >> (i % 8)); }
+
+bool writeDiffPgm(const std::filesystem::path& path, const Plane& expected, const Plane& actual) {
+  std::ofstream out(path, std::ios::binary);
+  out << "P5\n" << WIDTH << " " << HEIGHT << "\n255\n";
+  for (int i = 0; i < WIDTH * HEIGHT; i++) {
+    uint8_t value = 255;
+    if (pixelSet(expected, i) != pixelSet(actual, i)) {
+      value = 0;
+    } else if (pixelSet(actual, i)) {
+      value = 200;
+    }
+    out.put(static_cast<char>(value));
+  }
+  return static_cast<bool>(out);
+}
+
+int countDifferentPixels(const Plane& expected, const Plane& actual) {
+  int count = 0;
+  for (size_t i = 0; i < expected.size(); i++) {
+    count += __builtin_popcount(expected[i] ^ actual[i]);
+  }
+  return count;
+}
+
+struct Options {
+  std::filesystem::path epubDir;
+  std::filesystem::path goldenDir;
+  std::filesystem::path outputDir;
+  bool update = false;
+  int iterations = 20;
+};
+
+struct Throughput {
+  int bwPages = 0;
+  int grayPages = 0;
+  double bwMs = 0;
+  double grayMs = 0;
+  double singlePassGrayMs = 0;
+};
+
+// Draw the page into one plane; the grayscale passes follow the reader's anti-aliasing sequence, BW goes last so
+// the renderer is left in its normal mode
+void renderPlane(HostReader& reader, const PageView& page, const GfxRenderer::RenderMode mode,
+                 const bool useDisplayList = true) {
+  reader.getRenderer().setRenderMode(mode);
+  reader.renderPage(page, useDisplayList);
+  reader.getRenderer().setRenderMode(GfxRenderer::BW);
+}
+
+double elapsedMs(const Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool checkPage(HostReader& reader, const GoldenPage& golden, const Options& options, Throughput& throughput) {
+  const std::filesystem::path scratchDir = options.outputDir / "scratch";
+  std::filesystem::remove_all(scratchDir);
+  std::filesystem::create_directories(scratchDir);
+
+  const std::string epubPath = (options.epubDir / (std::string(golden.epub) + ".epub")).string();
+  auto epub = std::make_shared<Epub>(epubPath, scratchDir.string());
+  if (!epub->load(true)) {
+    fprintf(stderr, "FAIL %s: could not load the book\n", golden.epub);
+    return false;
+  }
+
+  bool ok = true;
+  GfxRenderer& renderer = reader.getRenderer();
+  for (const auto& orientation : ORIENTATIONS) {
+    renderer.setOrientation(orientation.orientation);
+    Section section(epub, golden.spineIndex, renderer);
+    std::unique_ptr<PageView> page;
+    if (reader.buildSection(section)) {
+      page = section.loadPage(golden.page);
+    }
+    if (!page) {
+      fprintf(stderr, "FAIL %s spine %d page %d %s: could not lay out the page\n", golden.epub, golden.spineIndex,
+              golden.page, orientation.name);
+      ok = false;
+      continue;
+    }
+
+    Plane rendered[std::size(PLANES)];
+    for (size_t planeIndex = 0; planeIndex < std::size(PLANES); planeIndex++) {
+      const auto& plane = PLANES[planeIndex];
+      char name[96];
+      snprintf(name, sizeof(name), "%s_s%d_p%d_%s_%s", golden.epub, golden.spineIndex, golden.page, orientation.name,
+               plane.name);
+      renderPlane(reader, *page, plane.mode);
+      const Plane actual = capturePlane(plane.mode);
+      rendered[planeIndex] = actual;
+
+      // Replaying the recorded display list has to match laying the page out again
+      renderPlane(reader, *page, plane.mode, false);
+      const int relaidDifferent = countDifferentPixels(actual, capturePlane(plane.mode));
+      if (relaidDifferent != 0) {
+        fprintf(stderr, "FAIL %s: %d pixels differ between the display list and a direct render\n", name,
+                relaidDifferent);
+        ok = false;
+      }
+      const auto goldenPath = options.goldenDir / (std::string(name) + ".pbm");
+
+      Plane expected;
+      if (options.update || !readPbm(goldenPath, expected)) {
+        if (!writePbm(goldenPath, actual)) {
+          fprintf(stderr, "FAIL %s: could not write %s\n", name, goldenPath.c_str());
+          ok = false;
+        } else if (!options.update) {
+          fprintf(stderr, "FAIL %s: no golden image, wrote %s\n", name, goldenPath.c_str());
+          ok = false;
+        }
+        continue;
+      }
+
+      const int different = countDifferentPixels(expected, actual);
+      if (different != 0) {
+        const auto actualPath = options.outputDir / (std::string(name) + ".pbm");
+        const auto diffPath = options.outputDir / (std::string(name) + "_diff.pgm");
+        writePbm(actualPath, actual);
+        writeDiffPgm(diffPath, expected, actual);
+        fprintf(stderr, "FAIL %s: %d pixels differ, see %s\n", name, different, diffPath.c_str());
+        ok = false;
+      }
+    }
+
+    // The reader's anti-aliased page turn drawn in a single pass must hand the display the same planes as the
+    // separate passes, and leave the BW frame restored from the LSB plane's chunks
+    reader.renderPageAntiAliased(*page);
+    const Plane singlePass[] = {capturePlane(GfxRenderer::BW),
+                                Plane(display.getGrayscaleLsbBuffer(),
+                                      display.getGrayscaleLsbBuffer() + HalDisplay::BUFFER_SIZE),
+                                Plane(display.getGrayscaleMsbBuffer(),
+                                      display.getGrayscaleMsbBuffer() + HalDisplay::BUFFER_SIZE)};
+    for (size_t planeIndex = 0; planeIndex < std::size(PLANES); planeIndex++) {
+      const int different = countDifferentPixels(rendered[planeIndex], singlePass[planeIndex]);
+      if (different != 0) {
+        fprintf(stderr, "FAIL %s spine %d page %d %s %s: %d pixels differ after a single-pass anti-aliased render\n",
+                golden.epub, golden.spineIndex, golden.page, orientation.name, PLANES[planeIndex].name, different);
+        ok = false;
+      }
+    }
+
+    // Same page again, timed: the BW pass alone, and a whole anti-aliased page turn with separate BW, LSB and MSB
+    // passes and with a single pass
+    auto start = Clock::now();
+    for (int i = 0; i < options.iterations; i++) {
+      renderPlane(reader, *page, GfxRenderer::BW);
+    }
+    throughput.bwMs += elapsedMs(start);
+    throughput.bwPages += options.iterations;
+
+    start = Clock::now();
+    for (int i = 0; i < options.iterations; i++) {
+      reader.renderPageAntiAliased(*page, false);
+    }
+    throughput.grayMs += elapsedMs(start);
+    throughput.grayPages += options.iterations;
+
+    start = Clock::now();
+    for (int i = 0; i < options.iterations; i++) {
+      reader.renderPageAntiAliased(*page, true);
+    }
+    throughput.singlePassGrayMs += elapsedMs(start);
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  std::filesystem::remove_all(scratchDir);
+  return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 4) {
+    fprintf(stderr, "Usage: %s <epub dir> <golden dir> <output dir> [--update] [--iterations <n>]\n", argv[0]);
+    return 2;
+  }
+  Options options;
+  options.epubDir = argv[1];
+  options.goldenDir = argv[2];
+  options.outputDir = argv[3];
+  for (int i = 4; i < argc; i++) {
+    if (strcmp(argv[i], "--update") == 0) {
+      options.update = true;
+    } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      options.iterations = std::max(1, atoi(argv[++i]));
+    }
+  }
+  std::filesystem::create_directories(options.goldenDir);
+  // Only this run's mismatches are left in the output directory
+  std::filesystem::remove_all(options.outputDir);
+  std::filesystem::create_directories(options.outputDir);
+
+  HostReader reader;
+  Throughput throughput;
+  int failed = 0;
+  for (const auto& golden : GOLDEN_PAGES) {
+    failed += checkPage(reader, golden, options, throughput) ? 0 : 1;
+  }
+
+  const size_t planeCount = std::size(GOLDEN_PAGES) * std::size(ORIENTATIONS) * std::size(PLANES);
+  printf("%zu pages, %zu planes %s\n", std::size(GOLDEN_PAGES), planeCount, options.update ? "updated" : "compared");
+  printf("BW render:          %8.1f pages/s (%.3f ms/page)\n", throughput.bwPages * 1000.0 / throughput.bwMs,
+         throughput.bwMs / throughput.bwPages);
+  printf("AA, three passes:   %8.1f pages/s (%.3f ms/page)\n", throughput.grayPages * 1000.0 / throughput.grayMs,
+         throughput.grayMs / throughput.grayPages);
+  printf("AA, single pass:    %8.1f pages/s (%.3f ms/page, %.0f%% less time)\n",
+         throughput.grayPages * 1000.0 / throughput.singlePassGrayMs,
+         throughput.singlePassGrayMs / throughput.grayPages,
+         100.0 * (1.0 - throughput.singlePassGrayMs / throughput.grayMs));
+  if (failed != 0) {
+    fprintf(stderr, "%d of %zu pages failed\n", failed, std::size(GOLDEN_PAGES));
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,11 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/epub_pipeline"
+BINARY="$BUILD_DIR/EpubPipelineBenchmark"
+
+source "$ROOT_DIR/test/host/epub_pipeline.sh"
+build_epub_pipeline "$BUILD_DIR" "$BINARY" "$ROOT_DIR/test/epub_pipeline/EpubPipelineBenchmark.cpp"
+
+"$BINARY" "$ROOT_DIR/test/epubs" "$BUILD_DIR/scratch" "$@"
@@ -0,0 +1,12 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/render_golden"
+BINARY="$BUILD_DIR/RenderGoldenTest"
+
+source "$ROOT_DIR/test/host/epub_pipeline.sh"
+build_epub_pipeline "$BUILD_DIR" "$BINARY" "$ROOT_DIR/test/render_golden/RenderGoldenTest.cpp"
+
+# Pass --update to regenerate test/render_golden/golden after an intended rendering change
+"$BINARY" "$ROOT_DIR/test/epubs" "$ROOT_DIR/test/render_golden/golden" "$BUILD_DIR/out" "$@"
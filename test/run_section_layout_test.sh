@@ -0,0 +1,11 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/section_layout"
+BINARY="$BUILD_DIR/SectionLayoutTest"
+
+source "$ROOT_DIR/test/host/epub_pipeline.sh"
+build_epub_pipeline "$BUILD_DIR" "$BINARY" "$ROOT_DIR/test/section_layout/SectionLayoutTest.cpp"
+
+"$BINARY" "$ROOT_DIR/test/epubs" "$BUILD_DIR/scratch" "$@"
@@ -0,0 +1,220 @@
+// Microbenchmark for GfxRenderer::drawScreenBitmap(), the XTC reader's page writer. Draws random screen-sized XTG
+// (1-bit rows) and XTH (two column-major bit planes) pages with the per-pixel drawPixel() loops the reader used before
+// and with drawScreenBitmap(), and reports pages/second for each orientation.
+//
+// Before timing anything it checks that both paths leave identical framebuffers for every orientation, for the XTG
+// page and for each of the BW, LSB and MSB frames of the XTH page, and that a page of the wrong size is refused.
+//
+// Usage: ScreenBitmapBenchmark [--iterations <n>]
+
+#include <HalDisplay.h>
+#include <HostReader.h>
+#include <RenderFixtures.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Layout = GfxRenderer::ScreenBitmapLayout;
+using Op = GfxRenderer::ScreenBitmapOp;
+
+// The frames the reader draws from an XTH page: BW (every non-white pixel black), then the LSB and MSB gray planes
+enum class XthFrame { Bw, Lsb, Msb };
+constexpr XthFrame XTH_FRAMES[] = {XthFrame::Bw, XthFrame::Lsb, XthFrame::Msb};
+const char* frameName(const XthFrame frame) {
+  return frame == XthFrame::Bw ? "BW" : frame == XthFrame::Lsb ? "LSB" : "MSB";
+}
+
+struct Page {
+  int width;
+  int height;
+  std::vector<uint8_t> xtg;
+  std::vector<uint8_t> xth;
+};
+
+Page randomPage(const int width, const int height, const uint32_t seed) {
+  std::mt19937 rng(seed);
+  Page page{width, height, std::vector<uint8_t>((width + 7) / 8 * height),
+            std::vector<uint8_t>((static_cast<size_t>(width) * height + 7) / 8 * 2)};
+  for (auto& b : page.xtg) b = static_cast<uint8_t>(rng());
+  for (auto& b : page.xth) b = static_cast<uint8_t>(rng());
+  return page;
+}
+
+// XtcReaderActivity's per-pixel loops
+void drawXtgPerPixel(const GfxRenderer& renderer, const Page& page) {
+  const size_t rowBytes = (page.width + 7) / 8;
+  renderer.clearScreen();
+  for (int y = 0; y < page.height; y++) {
+    for (int x = 0; x < page.width; x++) {
+      if (!((page.xtg[y * rowBytes + x / 8] >> (7 - (x % 8))) & 1)) {
+        renderer.drawPixel(x, y, true);
+      }
+    }
+  }
+}
+
+uint8_t xthValue(const Page& page, const int x, const int y) {
+  const size_t planeSize = (static_cast<size_t>(page.width) * page.height + 7) / 8;
+  const size_t colBytes = (page.height + 7) / 8;
+  const size_t offset = (page.width - 1 - x) * colBytes + y / 8;
+  const int bit = 7 - (y % 8);
+  return ((page.xth[offset] >> bit) & 1) << 1 | ((page.xth[planeSize + offset] >> bit) & 1);
+}
+
+void drawXthPerPixel(const GfxRenderer& renderer, const Page& page, const XthFrame frame) {
+  renderer.clearScreen(frame == XthFrame::Bw ? 0xFF : 0x00);
+  for (int y = 0; y < page.height; y++) {
+    for (int x = 0; x < page.width; x++) {
+      const uint8_t value = xthValue(page, x, y);
+      if (frame == XthFrame::Bw && value >= 1) {
+        renderer.drawPixel(x, y, true);
+      } else if ((frame == XthFrame::Lsb && value == 1) || (frame == XthFrame::Msb && (value == 1 || value == 2))) {
+        renderer.drawPixel(x, y, false);
+      }
+    }
+  }
+}
+
+bool drawXtgDirect(const GfxRenderer& renderer, const Page& page) {
+  return renderer.drawScreenBitmap(page.xtg.data(), page.width, page.height);
+}
+
+// The same combinations XtcReaderActivity uses: BW = ~(bit1 | bit2), LSB = bit2 & ~bit1, MSB = bit1 ^ bit2
+bool drawXthDirect(const GfxRenderer& renderer, const Page& page, const XthFrame frame) {
+  const uint8_t* plane1 = page.xth.data();
+  const uint8_t* plane2 = plane1 + page.xth.size() / 2;
+  const int w = page.width;
+  const int h = page.height;
+  switch (frame) {
+    case XthFrame::Bw:
+      return renderer.drawScreenBitmap(plane1, w, h, Layout::ColumnsRightToLeft, Op::CopyInverted) &&
+             renderer.drawScreenBitmap(plane2, w, h, Layout::ColumnsRightToLeft, Op::AndNot);
+    case XthFrame::Lsb:
+      return renderer.drawScreenBitmap(plane2, w, h, Layout::ColumnsRightToLeft, Op::Copy) &&
+             renderer.drawScreenBitmap(plane1, w, h, Layout::ColumnsRightToLeft, Op::AndNot);
+    case XthFrame::Msb:
+      return renderer.drawScreenBitmap(plane1, w, h, Layout::ColumnsRightToLeft, Op::Copy) &&
+             renderer.drawScreenBitmap(plane2, w, h, Layout::ColumnsRightToLeft, Op::Xor);
+  }
+  return false;
+}
+
+template <typename Direct, typename PerPixel>
+bool sameFrame(GfxRenderer& renderer, const char* what, const char* orientation, Direct direct, PerPixel perPixel) {
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  perPixel();
+  const std::vector<uint8_t> expected(frameBuffer, frameBuffer + HalDisplay::BUFFER_SIZE);
+  // Every byte of the frame must be written, whatever was there before
+  fillNoise(frameBuffer, 7);
+  if (!direct()) {
+    fprintf(stderr, "FAIL %s %s: drawScreenBitmap() refused a screen-sized page\n", what, orientation);
+    return false;
+  }
+  if (std::memcmp(expected.data(), frameBuffer, expected.size()) != 0) {
+    fprintf(stderr, "FAIL %s %s: drawScreenBitmap() output differs from drawPixel\n", what, orientation);
+    return false;
+  }
+  return true;
+}
+
+bool check(GfxRenderer& renderer) {
+  int failures = 0;
+  int cases = 0;
+  uint32_t seed = 1;
+  for (const auto& orientation : ORIENTATIONS) {
+    renderer.setOrientation(orientation.orientation);
+    const Page page = randomPage(renderer.getScreenWidth(), renderer.getScreenHeight(), seed++);
+
+    cases++;
+    if (!sameFrame(
+            renderer, "XTG", orientation.name, [&] { return drawXtgDirect(renderer, page); },
+            [&] { drawXtgPerPixel(renderer, page); })) {
+      failures++;
+    }
+    for (const auto frame : XTH_FRAMES) {
+      cases++;
+      if (!sameFrame(
+              renderer, frameName(frame), orientation.name, [&] { return drawXthDirect(renderer, page, frame); },
+              [&] { drawXthPerPixel(renderer, page, frame); })) {
+        failures++;
+      }
+    }
+
+    // A page rendered for the other orientation doesn't fit
+    cases++;
+    const Page rotated = randomPage(page.height, page.width, seed++);
+    if (drawXtgDirect(renderer, rotated) || drawXthDirect(renderer, rotated, XthFrame::Bw)) {
+      fprintf(stderr, "FAIL %s: drawScreenBitmap() accepted a %dx%d page\n", orientation.name, rotated.width,
+              rotated.height);
+      failures++;
+    }
+  }
+  printf("%d/%d orientation/page combinations match\n", cases - failures, cases);
+  return failures == 0;
+}
+
+template <typename Draw>
+double pagesPerSecond(const int iterations, Draw draw) {
+  const auto start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    draw();
+  }
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return iterations / seconds;
+}
+
+void benchmark(GfxRenderer& renderer, const int iterations) {
+  for (const auto& orientation : ORIENTATIONS) {
+    renderer.setOrientation(orientation.orientation);
+    const Page page = randomPage(renderer.getScreenWidth(), renderer.getScreenHeight(), 1);
+
+    const double xtgBefore = pagesPerSecond(iterations, [&] { drawXtgPerPixel(renderer, page); });
+    const double xtgAfter = pagesPerSecond(iterations, [&] { drawXtgDirect(renderer, page); });
+    // The reader draws the BW frame twice (before and after the gray refresh) and each gray plane once
+    const auto xthPage = [&](const auto& draw) {
+      return pagesPerSecond(iterations, [&] {
+        draw(XthFrame::Bw);
+        draw(XthFrame::Lsb);
+        draw(XthFrame::Msb);
+        draw(XthFrame::Bw);
+      });
+    };
+    const double xthBefore = xthPage([&](const XthFrame frame) { drawXthPerPixel(renderer, page, frame); });
+    const double xthAfter = xthPage([&](const XthFrame frame) { drawXthDirect(renderer, page, frame); });
+    printf("%-18s XTG drawPixel: %8.1f pages/s  direct: %8.1f pages/s (%5.1fx)   XTH drawPixel: %7.1f pages/s  "
+           "direct: %7.1f pages/s (%5.1fx)\n",
+           orientation.name, xtgBefore, xtgAfter, xtgAfter / xtgBefore, xthBefore, xthAfter, xthAfter / xthBefore);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = 20;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = std::max(1, atoi(argv[++i]));
+    } else {
+      fprintf(stderr, "Usage: %s [--iterations <n>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  HostReader reader;
+  GfxRenderer& renderer = reader.getRenderer();
+  if (!check(renderer)) {
+    return 1;
+  }
+
+  printf("Random screen-sized pages, %d iterations\n", iterations);
+  benchmark(renderer, iterations);
+  return 0;
+}
@@ -0,0 +1,367 @@
+// Checks SdCardFont's SD reads against a small synthetic .cpfont: prewarm serves the right records and bitmaps while
+// merging neighbouring glyphs into a few reads, a page turn only reads codepoints the glyph store hasn't seen, glyphs
+// loaded on a miss come from the same store, and the store stays within its budget while glyphs churn through it.
+// The same font written as v5 serves identical glyphs, prewarming a page of hot glyphs in a read or two.
+//
+// Usage: SdCardFontTest <scratch dir>
+
+#include <EpdFontFamily.h>
+#include <SdCardFont.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_TRUE(cond)                                                 \
+  do {                                                                    \
+    if (!(cond)) {                                                        \
+      fprintf(stderr, "  FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      testsFailed++;                                                      \
+      return;                                                             \
+    }                                                                     \
+  } while (0)
+
+#define PASS() testsPassed++
+
+namespace {
+
+// One regular style covering ASCII, Cyrillic and the replacement glyph. Every glyph's metrics and bitmap bytes are
+// derived from its codepoint so any mix-up between glyphs shows.
+struct Range {
+  uint32_t first;
+  uint32_t last;
+};
+constexpr Range RANGES[] = {{0x20, 0x7E}, {0x400, 0x4FF}, {0xFFFD, 0xFFFD}};
+
+uint16_t bitmapLength(const uint32_t cp) { return cp == ' ' ? 0 : 24 + cp % 40; }
+uint16_t advanceOf(const uint32_t cp) { return static_cast<uint16_t>((8 + cp % 7) << 4); }
+uint8_t bitmapByte(const uint32_t cp, const uint32_t i) { return static_cast<uint8_t>(cp * 31 + i * 7); }
+
+void putU16(std::vector<uint8_t>& out, const uint32_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back((v >> 8) & 0xFF);
+}
+void putU32(std::vector<uint8_t>& out, const uint32_t v) {
+  putU16(out, v & 0xFFFF);
+  putU16(out, v >> 16);
+}
+
+// The hot set of the v5 file, in rank order: what a page of English prose mostly uses
+constexpr char HOT_TEXT[] = " etaoinshrdlucmfwypvbgkTHIAS.,'";
+constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+// 8 pixels wide at 1 bit per pixel: one byte per row
+void putGlyph(std::vector<uint8_t>& out, const uint32_t cp, const uint32_t dataOffset) {
+  const uint16_t length = bitmapLength(cp);
+  EpdGlyph glyph = {8, static_cast<uint8_t>(length), advanceOf(cp), 1, 12, length, dataOffset};
+  out.insert(out.end(), reinterpret_cast<uint8_t*>(&glyph), reinterpret_cast<uint8_t*>(&glyph + 1));
+}
+void putBitmap(std::vector<uint8_t>& out, const uint32_t cp) {
+  for (uint32_t i = 0; i < bitmapLength(cp); i++) out.push_back(bitmapByte(cp, i));
+}
+
+// v5 files lead the bitmap section with the hot block (each hot glyph's record followed by its bitmap); the main
+// table points hot glyphs at the bitmap inside it
+std::string writeFont(const std::string& dir, const uint16_t version) {
+  std::vector<uint32_t> hot;
+  if (version >= 5) {
+    hot.push_back(REPLACEMENT);
+    for (const char* c = HOT_TEXT; *c; c++) hot.push_back(static_cast<unsigned char>(*c));
+  }
+  std::vector<uint8_t> intervals, hotIndex, glyphs, bitmaps;
+  std::map<uint32_t, uint32_t> hotBitmapOffsets;
+  for (const uint32_t cp : hot) {
+    putU32(hotIndex, cp);
+    putU16(hotIndex, bitmapLength(cp));
+    putU16(hotIndex, 0);
+    putGlyph(bitmaps, cp, bitmaps.size() + sizeof(EpdGlyph));
+    hotBitmapOffsets[cp] = bitmaps.size();
+    putBitmap(bitmaps, cp);
+  }
+
+  uint32_t glyphCount = 0;
+  for (const auto& range : RANGES) {
+    putU32(intervals, range.first);
+    putU32(intervals, range.last);
+    putU32(intervals, glyphCount);
+    for (uint32_t cp = range.first; cp <= range.last; cp++, glyphCount++) {
+      const auto hotBitmap = hotBitmapOffsets.find(cp);
+      if (hotBitmap != hotBitmapOffsets.end()) {
+        putGlyph(glyphs, cp, hotBitmap->second);
+      } else {
+        putGlyph(glyphs, cp, bitmaps.size());
+        putBitmap(bitmaps, cp);
+      }
+    }
+  }
+
+  std::vector<uint8_t> file = {'C', 'P', 'F', 'O', 'N', 'T', 0, 0};
+  putU16(file, version);
+  putU16(file, 0);  // 1-bit
+  file.push_back(1);
+  file.resize(32);
+  // Style TOC entry: regular, no kerning or ligatures, data right after the TOC
+  file.push_back(EpdFontFamily::REGULAR);
+  file.resize(36);
+  putU32(file, sizeof(RANGES) / sizeof(RANGES[0]));
+  putU32(file, glyphCount);
+  file.push_back(20);  // advanceY
+  putU16(file, 16);    // ascender
+  putU16(file, static_cast<uint16_t>(-4));
+  file.resize(56);
+  putU32(file, 64);
+  if (version >= 5) putU16(file, hot.size());
+  file.resize(64);
+  file.insert(file.end(), intervals.begin(), intervals.end());
+  file.insert(file.end(), hotIndex.begin(), hotIndex.end());
+  file.insert(file.end(), glyphs.begin(), glyphs.end());
+  file.insert(file.end(), bitmaps.begin(), bitmaps.end());
+
+  const std::string name = "synthetic-v" + std::to_string(version) + ".cpfont";
+  const std::string path = (std::filesystem::path(dir) / name).string();
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+  return path;
+}
+
+// Resolves a glyph and its bitmap the way GfxRenderer::getGlyphBitmap() does
+bool glyphMatches(SdCardFont& font, const uint32_t cp) {
+  const EpdFont* epdFont = font.getEpdFont(EpdFontFamily::REGULAR);
+  const EpdGlyph* glyph = epdFont->getGlyph(cp);
+  if (!glyph || glyph->advanceX != advanceOf(cp) || glyph->dataLength != bitmapLength(cp)) {
+    fprintf(stderr, "  U+%04X: wrong glyph record\n", cp);
+    return false;
+  }
+  const uint8_t* bitmap = font.isOverflowGlyph(glyph) ? font.getOverflowBitmap(glyph)
+                                                      : &epdFont->data->bitmap[glyph->dataOffset];
+  for (uint32_t i = 0; i < glyph->dataLength; i++) {
+    if (bitmap[i] != bitmapByte(cp, i)) {
+      fprintf(stderr, "  U+%04X: wrong bitmap byte %u\n", cp, i);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool textMatches(SdCardFont& font, const char* ascii) {
+  for (const char* c = ascii; *c; c++) {
+    if (!glyphMatches(font, static_cast<unsigned char>(*c))) return false;
+  }
+  return true;
+}
+
+// A page's worth of Cyrillic starting at `first`, as UTF-8
+std::string cyrillic(const uint32_t first, const uint32_t count) {
+  std::string text;
+  for (uint32_t cp = first; cp < first + count; cp++) {
+    text += static_cast<char>(0xC0 | (cp >> 6));
+    text += static_cast<char>(0x80 | (cp & 0x3F));
+  }
+  return text;
+}
+
+}  // namespace
+
+void testPrewarmMergesReads(SdCardFont& font) {
+  printf("testPrewarmMergesReads...\n");
+  font.clearPersistentCache();
+  font.clearCache();
+  font.resetStats();
+  const char* text = "The quick brown fox jumps over the lazy dog";
+  ASSERT_TRUE(font.prewarm(text) == 0);
+  ASSERT_TRUE(textMatches(font, text));
+  const SdCardFont::Stats& stats = font.getStats();
+  printf("  %u glyphs in %u reads (%u seeks)\n", stats.uniqueGlyphs, stats.readCount, stats.seekCount);
+  // One glyph record read plus one bitmap read each was the old cost
+  ASSERT_TRUE(stats.readCount < stats.uniqueGlyphs / 2);
+  ASSERT_TRUE(stats.storeHits == 0);
+  PASS();
+}
+
+void testPageTurnReadsOnlyNewGlyphs(SdCardFont& font) {
+  printf("testPageTurnReadsOnlyNewGlyphs...\n");
+  font.clearPersistentCache();
+  font.clearCache();
+  ASSERT_TRUE(font.prewarm("Hello world") == 0);
+
+  font.clearCache();
+  font.resetStats();
+  ASSERT_TRUE(font.prewarm("Hello there") == 0);
+  ASSERT_TRUE(textMatches(font, "Hello there"));
+  // 't' and 'h' are new; 'H', 'e', 'l', 'o', ' ', 'r' and the replacement glyph come from the store
+  ASSERT_TRUE(font.getStats().storeMisses == 2);
+  ASSERT_TRUE(font.getStats().storeHits == 7);
+
+  // Turning back reads nothing
+  font.clearCache();
+  font.resetStats();
+  ASSERT_TRUE(font.prewarm("Hello world") == 0);
+  ASSERT_TRUE(textMatches(font, "Hello world"));
+  ASSERT_TRUE(font.getStats().readCount == 0);
+  PASS();
+}
+
+void testLayoutRecordsAreReused(SdCardFont& font) {
+  printf("testLayoutRecordsAreReused...\n");
+  font.clearPersistentCache();
+  font.clearCache();
+  font.resetStats();
+  ASSERT_TRUE(font.prewarm("layout") == 0);
+  const uint32_t coldReads = font.getStats().readCount;
+
+  font.clearPersistentCache();
+  font.clearCache();
+  ASSERT_TRUE(font.prewarm("layout", 0x0F, true) == 0);
+
+  // The render prewarm still needs the bitmaps, but not the records again
+  font.clearCache();
+  font.resetStats();
+  ASSERT_TRUE(font.prewarm("layout") == 0);
+  ASSERT_TRUE(textMatches(font, "layout"));
+  ASSERT_TRUE(font.getStats().storeHits == 0);
+  ASSERT_TRUE(font.getStats().readCount < coldReads);
+  PASS();
+}
+
+void testGlyphMissUsesStore(SdCardFont& font) {
+  printf("testGlyphMissUsesStore...\n");
+  font.clearPersistentCache();
+  font.clearCache();
+  ASSERT_TRUE(font.prewarm("abc") == 0);
+
+  font.resetStats();
+  const EpdGlyph* glyph = font.getEpdFont(EpdFontFamily::REGULAR)->getGlyph('z');
+  ASSERT_TRUE(font.isOverflowGlyph(glyph));
+  ASSERT_TRUE(glyphMatches(font, 'z'));
+  const uint32_t reads = font.getStats().readCount;
+  ASSERT_TRUE(reads == 2);
+
+  // Asking again, or prewarming the next page with it, reads nothing more
+  ASSERT_TRUE(font.getEpdFont(EpdFontFamily::REGULAR)->getGlyph('z') == glyph);
+  font.clearCache();
+  ASSERT_TRUE(font.prewarm("abz") == 0);
+  ASSERT_TRUE(textMatches(font, "abz"));
+  ASSERT_TRUE(font.getStats().readCount == reads);
+  PASS();
+}
+
+void testStoreStaysWithinBudget(SdCardFont& font) {
+  printf("testStoreStaysWithinBudget...\n");
+  font.clearPersistentCache();
+  for (uint32_t page = 0; page < 8; page++) {
+    font.clearCache();
+    const uint32_t first = 0x400 + page * 24;
+    ASSERT_TRUE(font.prewarm(cyrillic(first, 64).c_str()) == 0);
+    for (uint32_t cp = first; cp < first + 64; cp++) {
+      ASSERT_TRUE(glyphMatches(font, cp));
+    }
+    ASSERT_TRUE(font.getStats().storeBytes <= SdCardFont::GLYPH_STORE_BUDGET);
+  }
+  ASSERT_TRUE(font.getStats().storeBytes > SdCardFont::GLYPH_STORE_BUDGET / 2);
+
+  // Glyphs loaded on a miss are evicted like any other, and still read correctly
+  for (uint32_t cp = 0x21; cp <= 0x7E; cp++) {
+    ASSERT_TRUE(glyphMatches(font, cp));
+  }
+  ASSERT_TRUE(font.getStats().storeBytes <= SdCardFont::GLYPH_STORE_BUDGET);
+  PASS();
+}
+
+void testClearGlyphStore(SdCardFont& font) {
+  printf("testClearGlyphStore...\n");
+  font.clearCache();
+  ASSERT_TRUE(font.prewarm("Hello") == 0);
+  font.clearGlyphStore();
+  ASSERT_TRUE(font.getStats().storeBytes == 0);
+  // The prewarmed page is unaffected; the next one reads from SD again
+  ASSERT_TRUE(textMatches(font, "Hello"));
+  font.clearCache();
+  font.resetStats();
+  ASSERT_TRUE(font.prewarm("Hello") == 0);
+  ASSERT_TRUE(font.getStats().storeHits == 0);
+  ASSERT_TRUE(textMatches(font, "Hello"));
+  PASS();
+}
+
+void testHotBlockPrewarm(SdCardFont& v4, SdCardFont& v5) {
+  printf("testHotBlockPrewarm...\n");
+  const char* text = "This is the start of a page, and the reader is on it at last.";
+  uint32_t reads[2];
+  SdCardFont* fonts[] = {&v4, &v5};
+  for (int i = 0; i < 2; i++) {
+    fonts[i]->clearPersistentCache();
+    fonts[i]->clearCache();
+    fonts[i]->resetStats();
+    ASSERT_TRUE(fonts[i]->prewarm(text) == 0);
+    ASSERT_TRUE(textMatches(*fonts[i], text));
+    reads[i] = fonts[i]->getStats().readCount;
+  }
+  printf("  %u glyphs: %u reads from v4, %u from v5\n", v5.getStats().uniqueGlyphs, reads[0], reads[1]);
+  // Records and bitmaps of the whole page sit in one contiguous block
+  ASSERT_TRUE(reads[1] <= 2);
+  ASSERT_TRUE(reads[1] < reads[0]);
+  PASS();
+}
+
+void testColdGlyphsMatchV4(SdCardFont& v4, SdCardFont& v5) {
+  printf("testColdGlyphsMatchV4...\n");
+  // Mixes hot glyphs, cold ASCII and Cyrillic outside the hot set
+  const std::string text = "Quiz: 0-9 [x] " + cyrillic(0x410, 40);
+  for (SdCardFont* font : {&v4, &v5}) {
+    font->clearPersistentCache();
+    font->clearCache();
+    ASSERT_TRUE(font->prewarm(text.c_str()) == 0);
+    ASSERT_TRUE(textMatches(*font, "Quiz: 0-9 [x] "));
+    for (uint32_t cp = 0x410; cp < 0x410 + 40; cp++) {
+      ASSERT_TRUE(glyphMatches(*font, cp));
+    }
+    // Layout-only prewarm takes hot records from the hot block too
+    font->clearPersistentCache();
+    font->clearCache();
+    ASSERT_TRUE(font->prewarm("the Quiz", 0x0F, true) == 0);
+    const EpdGlyph* glyph = font->getEpdFont(EpdFontFamily::REGULAR)->getGlyph('e');
+    ASSERT_TRUE(glyph && glyph->advanceX == advanceOf('e') && glyph->dataLength == bitmapLength('e'));
+    // Glyph misses read from the main table, which points hot glyphs into the hot block
+    font->clearPersistentCache();
+    font->clearCache();
+    ASSERT_TRUE(font->prewarm("Q") == 0);
+    ASSERT_TRUE(glyphMatches(*font, 'e'));
+    ASSERT_TRUE(glyphMatches(*font, '~'));
+  }
+  PASS();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <scratch dir>\n", argv[0]);
+    return 2;
+  }
+  std::filesystem::create_directories(argv[1]);
+
+  SdCardFont font;
+  SdCardFont v4;
+  if (!font.load(writeFont(argv[1], CPFONT_VERSION).c_str()) || !v4.load(writeFont(argv[1], 4).c_str())) {
+    fprintf(stderr, "FAIL: synthetic .cpfont did not load\n");
+    return 1;
+  }
+
+  printf("=== SD Card Font Tests ===\n\n");
+  testPrewarmMergesReads(font);
+  testPageTurnReadsOnlyNewGlyphs(font);
+  // v5 reads hot records along with their bitmaps, so only v4 has record reads to save
+  testLayoutRecordsAreReused(v4);
+  testGlyphMissUsesStore(font);
+  testStoreStaysWithinBudget(font);
+  testClearGlyphStore(font);
+  testHotBlockPrewarm(v4, font);
+  testColdGlyphsMatchV4(v4, font);
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,108 @@
+// Checks that section files keyed by layout are rebuilt after their directory goes away behind the layout index:
+// the reader's Delete cache action removes the whole book cache, and a CSS change removes sections/. The same
+// section at the same layout must build again, with its layout recorded in sections/layouts.bin.
+//
+// Usage: SectionLayoutTest <epub dir> <scratch dir>
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <HalStorage.h>
+#include <HostReader.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_TRUE(cond)                                                 \
+  do {                                                                    \
+    if (!(cond)) {                                                        \
+      fprintf(stderr, "  FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      testsFailed++;                                                      \
+      return;                                                             \
+    }                                                                     \
+  } while (0)
+
+#define PASS() testsPassed++
+
+namespace {
+
+std::shared_ptr<Epub> openBook(const std::string& epubPath, const std::string& cacheDir) {
+  auto epub = std::make_shared<Epub>(epubPath, cacheDir);
+  if (!epub->load(true)) {
+    return nullptr;
+  }
+  return epub;
+}
+
+bool hasLayoutIndex(const Epub& epub) { return Storage.exists((epub.getCachePath() + "/sections/layouts.bin").c_str()); }
+
+}  // namespace
+
+void testRebuildAfterDeleteCache(HostReader& reader, const std::string& epubPath, const std::string& cacheDir) {
+  printf("testRebuildAfterDeleteCache...\n");
+  auto epub = openBook(epubPath, cacheDir);
+  ASSERT_TRUE(epub);
+  uint16_t pageCount = 0;
+  {
+    Section section(epub, 0, reader.getRenderer());
+    ASSERT_TRUE(reader.buildSection(section));
+    pageCount = section.pageCount;
+  }
+  ASSERT_TRUE(hasLayoutIndex(*epub));
+
+  // What the reader menu's Delete cache does before going home
+  ASSERT_TRUE(epub->clearCache());
+  epub->setupCacheDir();
+
+  // Opening the book again lays the chapter out again at the same layout
+  epub = openBook(epubPath, cacheDir);
+  ASSERT_TRUE(epub);
+  Section section(epub, 0, reader.getRenderer());
+  ASSERT_TRUE(reader.buildSection(section));
+  ASSERT_TRUE(section.pageCount == pageCount);
+  ASSERT_TRUE(hasLayoutIndex(*epub));
+  ASSERT_TRUE(section.clearCache());
+  PASS();
+}
+
+void testRebuildAfterSectionsRemoved(HostReader& reader, const std::string& epubPath, const std::string& cacheDir) {
+  printf("testRebuildAfterSectionsRemoved...\n");
+  auto epub = openBook(epubPath, cacheDir);
+  ASSERT_TRUE(epub);
+  Section section(epub, 0, reader.getRenderer());
+  ASSERT_TRUE(reader.buildSection(section));
+  const uint16_t pageCount = section.pageCount;
+
+  // What a CSS change does to the sections when the book is loaded
+  ASSERT_TRUE(Storage.removeDir((epub->getCachePath() + "/sections").c_str()));
+
+  Section rebuilt(epub, 0, reader.getRenderer());
+  ASSERT_TRUE(reader.buildSection(rebuilt));
+  ASSERT_TRUE(rebuilt.pageCount == pageCount);
+  ASSERT_TRUE(hasLayoutIndex(*epub));
+  ASSERT_TRUE(rebuilt.clearCache());
+  PASS();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <epub dir> <scratch dir>\n", argv[0]);
+    return 2;
+  }
+
+  HostReader reader;
+  const std::string epubPath = (std::filesystem::path(argv[1]) / "test_kerning_ligature.epub").string();
+  std::filesystem::remove_all(argv[2]);
+  std::filesystem::create_directories(argv[2]);
+
+  printf("=== Section Layout Tests ===\n\n");
+  testRebuildAfterDeleteCache(reader, epubPath, argv[2]);
+  testRebuildAfterSectionsRemoved(reader, epubPath, argv[2]);
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}
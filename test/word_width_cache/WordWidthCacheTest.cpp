@@ -0,0 +1,243 @@
+// Checks the renderer's word width cache over real section builds: rebuilding a chapter takes its word widths and
+// hyphenation prefix widths from the cache and lays out the same pages, a later chapter reuses the widths of words
+// an earlier one measured, and changing the fonts empties the cache. Also checks the table on its own: prefixes
+// belong to their word, over-long words aren't kept, and it stays within CAPACITY entries.
+//
+// Usage: WordWidthCacheTest <epub dir> <scratch dir>
+
+#include <Epub.h>
+#include <Epub/PageView.h>
+#include <Epub/Section.h>
+#include <HalDisplay.h>
+#include <HostReader.h>
+#include <WordWidthCache.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+static int testsPassed = 0;
+static int testsFailed = 0;
+
+#define ASSERT_TRUE(cond)                                                 \
+  do {                                                                    \
+    if (!(cond)) {                                                        \
+      fprintf(stderr, "  FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      testsFailed++;                                                      \
+      return;                                                             \
+    }                                                                     \
+  } while (0)
+
+#define PASS() testsPassed++
+
+namespace {
+
+// The reader's layout, with hyphenation on so the line breaker measures prefixes
+bool buildHyphenated(HostReader& reader, Section& section) {
+  const HostReader::Viewport viewport = reader.getViewport();
+  return section.createSectionFile(reader.getFontId(), 1.0f, true, 0, viewport.width, viewport.height, true, true, 0,
+                                   false);
+}
+
+// A hash of every page of the section, drawn. The frames themselves would count against the host's device heap.
+std::vector<uint64_t> renderSection(HostReader& reader, Section& section) {
+  std::vector<uint64_t> hashes;
+  for (int page = 0; page < section.pageCount; page++) {
+    const auto view = section.loadPage(page);
+    if (!view) {
+      return {};
+    }
+    reader.renderPage(*view);
+    const uint8_t* frameBuffer = reader.getRenderer().getFrameBuffer();
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+      hash = (hash ^ frameBuffer[i]) * 1099511628211ull;
+    }
+    hashes.push_back(hash);
+  }
+  return hashes;
+}
+
+// Spine indexes of the chapters with at least two pages, longest first
+std::vector<int> textChapters(HostReader& reader, const std::shared_ptr<Epub>& epub) {
+  std::vector<std::pair<int, int>> chapters;  // pages, spine
+  for (int spine = 0; spine < epub->getSpineItemsCount(); spine++) {
+    Section section(epub, spine, reader.getRenderer());
+    if (reader.buildSection(section) && section.pageCount >= 2) {
+      chapters.emplace_back(section.pageCount, spine);
+    }
+    section.clearCache();
+  }
+  std::sort(chapters.begin(), chapters.end(), std::greater<>());
+  std::vector<int> spines;
+  for (const auto& chapter : chapters) spines.push_back(chapter.second);
+  return spines;
+}
+
+}  // namespace
+
+void testRebuildUsesCache(HostReader& reader, const std::shared_ptr<Epub>& epub, const int spine) {
+  printf("testRebuildUsesCache...\n");
+  WordWidthCache& cache = reader.getRenderer().getWordWidthCache();
+  cache.clear();
+
+  Section cold(epub, spine, reader.getRenderer());
+  ASSERT_TRUE(buildHyphenated(reader, cold));
+  const WordWidthCache::Stats coldStats = cache.getStats();
+  const auto coldPages = renderSection(reader, cold);
+  ASSERT_TRUE(!coldPages.empty());
+  ASSERT_TRUE(coldStats.misses > 0);
+  ASSERT_TRUE(cold.clearCache());
+
+  Section warm(epub, spine, reader.getRenderer());
+  ASSERT_TRUE(buildHyphenated(reader, warm));
+  const WordWidthCache::Stats warmStats = cache.getStats();
+  printf("  cold build: %u of %u widths cached, rebuild: %u of %u widths and %u of %u prefixes cached\n",
+         coldStats.hits, coldStats.hits + coldStats.misses, warmStats.hits, warmStats.hits + warmStats.misses,
+         warmStats.prefixHits, warmStats.prefixHits + warmStats.prefixMisses);
+  // The chapter has more distinct words than the cache holds: its common ones stay
+  ASSERT_TRUE(warmStats.hits > coldStats.hits);
+  ASSERT_TRUE(warmStats.hits > warmStats.misses);
+  ASSERT_TRUE(warmStats.prefixHits > 0);
+  ASSERT_TRUE(renderSection(reader, warm) == coldPages);
+  ASSERT_TRUE(warm.clearCache());
+  PASS();
+}
+
+void testCacheSharedAcrossSections(HostReader& reader, const std::shared_ptr<Epub>& epub,
+                                   const std::vector<int>& spines) {
+  printf("testCacheSharedAcrossSections...\n");
+  WordWidthCache& cache = reader.getRenderer().getWordWidthCache();
+  cache.clear();
+
+  Section first(epub, spines[0], reader.getRenderer());
+  ASSERT_TRUE(reader.buildSection(first));
+  Section second(epub, spines[1], reader.getRenderer());
+  ASSERT_TRUE(reader.buildSection(second));
+  const WordWidthCache::Stats stats = cache.getStats();
+  printf("  second chapter: %u of %u widths measured by the first\n", stats.hits, stats.hits + stats.misses);
+  ASSERT_TRUE(stats.hits > 0);
+  ASSERT_TRUE(first.clearCache());
+  ASSERT_TRUE(second.clearCache());
+  PASS();
+}
+
+void testFontChangeEmptiesCache(HostReader& reader, const std::shared_ptr<Epub>& epub, const int spine) {
+  printf("testFontChangeEmptiesCache...\n");
+  GfxRenderer& renderer = reader.getRenderer();
+  WordWidthCache& cache = renderer.getWordWidthCache();
+  Section section(epub, spine, renderer);
+  ASSERT_TRUE(reader.buildSection(section));
+  ASSERT_TRUE(cache.getStats().entries > 0);
+
+  const int fontId = reader.getFontId();
+  const EpdFontFamily family = renderer.getFontMap().at(fontId);
+  renderer.removeFont(fontId);
+  ASSERT_TRUE(cache.getStats().entries == 0);
+
+  renderer.insertFont(fontId, family);
+  ASSERT_TRUE(section.clearCache());
+  ASSERT_TRUE(reader.buildSection(section));
+  ASSERT_TRUE(cache.getStats().entries > 0);
+  renderer.insertFont(fontId + 1, family);
+  ASSERT_TRUE(cache.getStats().entries == 0);
+  renderer.removeFont(fontId + 1);
+  ASSERT_TRUE(section.clearCache());
+  PASS();
+}
+
+void testPrefixesBelongToTheirWord() {
+  printf("testPrefixesBelongToTheirWord...\n");
+  WordWidthCache cache;
+  const auto word = WordWidthCache::makeKey(1, 0, "hyphenation", 11);
+  const auto otherStyle = WordWidthCache::makeKey(1, 1, "hyphenation", 11);
+  const auto otherFont = WordWidthCache::makeKey(2, 0, "hyphenation", 11);
+  uint16_t width = 0;
+
+  // No prefix without its word
+  cache.putPrefixWidth(word, 6, true, 40);
+  ASSERT_TRUE(!cache.findPrefixWidth(word, 6, true, width));
+
+  cache.putWidth(word, 77);
+  ASSERT_TRUE(cache.findWidth(word, width) && width == 77);
+  ASSERT_TRUE(!cache.findWidth(otherStyle, width));
+  ASSERT_TRUE(!cache.findWidth(otherFont, width));
+
+  cache.putPrefixWidth(word, 6, true, 40);
+  cache.putPrefixWidth(word, 6, false, 35);
+  ASSERT_TRUE(cache.findPrefixWidth(word, 6, true, width) && width == 40);
+  ASSERT_TRUE(cache.findPrefixWidth(word, 6, false, width) && width == 35);
+  ASSERT_TRUE(!cache.findPrefixWidth(word, 2, true, width));
+
+  // Re-measuring the word forgets its prefixes
+  cache.putWidth(word, 78);
+  ASSERT_TRUE(!cache.findPrefixWidth(word, 6, true, width));
+  PASS();
+}
+
+void testTableStaysBounded() {
+  printf("testTableStaysBounded...\n");
+  WordWidthCache cache;
+  const std::string longWord(WordWidthCache::MAX_WORD_BYTES + 1, 'x');
+  const auto longKey = WordWidthCache::makeKey(1, 0, longWord.data(), longWord.size());
+  cache.putWidth(longKey, 100);
+  uint16_t width = 0;
+  ASSERT_TRUE(!cache.findWidth(longKey, width));
+  ASSERT_TRUE(cache.getStats().entries == 0);
+
+  char word[16];
+  for (int i = 0; i < 4 * WordWidthCache::CAPACITY; i++) {
+    const int length = snprintf(word, sizeof(word), "word%d", i);
+    cache.putWidth(WordWidthCache::makeKey(1, 0, word, length), static_cast<uint16_t>(i));
+  }
+  ASSERT_TRUE(cache.getStats().entries <= WordWidthCache::CAPACITY);
+  ASSERT_TRUE(cache.getStats().entries > WordWidthCache::CAPACITY / 2);
+  ASSERT_TRUE(cache.getStats().evictions > 0);
+  // The word just measured is there
+  const int length = snprintf(word, sizeof(word), "word%d", 4 * WordWidthCache::CAPACITY - 1);
+  ASSERT_TRUE(cache.findWidth(WordWidthCache::makeKey(1, 0, word, length), width));
+  ASSERT_TRUE(width == 4 * WordWidthCache::CAPACITY - 1);
+
+  cache.clear();
+  ASSERT_TRUE(cache.getStats().entries == 0);
+  ASSERT_TRUE(!cache.findWidth(WordWidthCache::makeKey(1, 0, word, length), width));
+  PASS();
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <epub dir> <scratch dir>\n", argv[0]);
+    return 2;
+  }
+
+  HostReader reader;
+  const std::string epubPath = (std::filesystem::path(argv[1]) / "test_kerning_ligature.epub").string();
+  std::filesystem::remove_all(argv[2]);
+  std::filesystem::create_directories(argv[2]);
+  const auto epub = std::make_shared<Epub>(epubPath, argv[2]);
+  if (!epub->load(true)) {
+    fprintf(stderr, "FAIL: couldn't load %s\n", epubPath.c_str());
+    return 1;
+  }
+  const std::vector<int> spines = textChapters(reader, epub);
+  if (spines.size() < 2) {
+    fprintf(stderr, "FAIL: %s has fewer than two chapters of two pages\n", epubPath.c_str());
+    return 1;
+  }
+
+  printf("=== Word Width Cache Tests ===\n\n");
+  testRebuildUsesCache(reader, epub, spines[0]);
+  testCacheSharedAcrossSections(reader, epub, spines);
+  testFontChangeEmptiesCache(reader, epub, spines[0]);
+  testPrefixesBelongToTheirWord();
+  testTableStaysBounded();
+
+  printf("\n=== Results: %d passed, %d failed ===\n", testsPassed, testsFailed);
+  return testsFailed > 0 ? 1 : 0;
+}